@@ -0,0 +1,230 @@
+// Font 4 as span encoded glyphs, generated by tools/font_compiler:
+//   ./font_compiler --name dashFont4 --out include/dash_font4.h --chars '0123456789:,.- ' --scan src/main.cpp 4
+// Only these glyphs are kept:  ,-./0123456789:ACDITadeghiklmprstv
+// Register it with tft.setSpanFont(font, &dashFont4)
+
+const uint8_t dashFont4Rows[] PROGMEM = {
+  // 0x2C ','
+  0x01, 0x00, 0x03, 0x81, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02,
+  // 0x2D '-'
+  0x01, 0x00, 0x06, 0x80,
+  // 0x2E '.'
+  0x01, 0x00, 0x03, 0x81,
+  // 0x2F '/'
+  0x01, 0x06, 0x02, 0x80, 0x01, 0x06, 0x01, 0x01, 0x05, 0x02, 0x80, 0x01, 0x05, 0x01, 0x01, 0x04,
+  0x02, 0x80, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x80, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x80,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x80, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x80,
+  // 0x30 '0'
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x08, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x85, 0x02, 0x00, 0x03, 0x06, 0x03,
+  0x02, 0x01, 0x02, 0x06, 0x02, 0x02, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02, 0x08, 0x01, 0x04, 0x04,
+  // 0x31 '1'
+  0x01, 0x04, 0x02, 0x80, 0x01, 0x03, 0x03, 0x01, 0x00, 0x06, 0x80, 0x01, 0x04, 0x02, 0x8A,
+  // 0x32 '2'
+  0x01, 0x03, 0x06, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x03, 0x04, 0x03, 0x02, 0x00, 0x03, 0x07, 0x02,
+  0x02, 0x00, 0x02, 0x08, 0x02, 0x80, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x07, 0x04, 0x01,
+  0x05, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x0C, 0x80,
+  // 0x33 '3'
+  0x01, 0x03, 0x06, 0x01, 0x02, 0x08, 0x02, 0x01, 0x03, 0x04, 0x03, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x02, 0x00, 0x03, 0x06, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x06, 0x01, 0x09, 0x03, 0x01, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x80, 0x02, 0x00, 0x03,
+  0x06, 0x03, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x0A, 0x01, 0x03, 0x06,
+  // 0x34 '4'
+  0x01, 0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x80, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02,
+  0x04, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x80, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02,
+  0x01, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x00, 0x0C, 0x80, 0x01, 0x08, 0x02,
+  0x82,
+  // 0x35 '5'
+  0x01, 0x01, 0x0A, 0x80, 0x01, 0x01, 0x02, 0x81, 0x02, 0x01, 0x02, 0x01, 0x05, 0x01, 0x01, 0x0A,
+  0x02, 0x00, 0x04, 0x04, 0x03, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x0A, 0x02, 0x81, 0x02, 0x00,
+  0x02, 0x08, 0x02, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x0A,
+  0x01, 0x03, 0x06,
+  // 0x36 '6'
+  0x01, 0x04, 0x05, 0x01, 0x02, 0x09, 0x02, 0x01, 0x03, 0x05, 0x02, 0x02, 0x01, 0x02, 0x07, 0x02,
+  0x80, 0x01, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x05, 0x01, 0x00, 0x0B, 0x02, 0x00, 0x04, 0x04,
+  0x03, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x81, 0x02, 0x01, 0x02, 0x06,
+  0x03, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x09, 0x01, 0x03, 0x06,
+  // 0x37 '7'
+  0x01, 0x00, 0x0C, 0x80, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x02,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x80, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02,
+  0x81, 0x01, 0x03, 0x02, 0x81,
+  // 0x38 '8'
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x08, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x81, 0x02, 0x02, 0x02, 0x04, 0x02, 0x01, 0x03, 0x06, 0x01, 0x02, 0x08, 0x02, 0x01, 0x03, 0x04,
+  0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x82, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x0A, 0x01,
+  0x03, 0x06,
+  // 0x39 '9'
+  0x01, 0x03, 0x06, 0x01, 0x01, 0x09, 0x02, 0x01, 0x03, 0x04, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02,
+  0x02, 0x00, 0x02, 0x08, 0x02, 0x81, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x01, 0x03, 0x04, 0x04,
+  0x01, 0x01, 0x0B, 0x02, 0x03, 0x05, 0x02, 0x02, 0x01, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02,
+  0x80, 0x02, 0x01, 0x02, 0x05, 0x03, 0x01, 0x01, 0x09, 0x01, 0x02, 0x07,
+  // 0x3A ':'
+  0x01, 0x00, 0x03, 0x81, 0x00, 0x85, 0x01, 0x00, 0x03, 0x81,
+  // 0x41 'A'
+  0x01, 0x06, 0x04, 0x81, 0x02, 0x05, 0x02, 0x02, 0x02, 0x81, 0x02, 0x04, 0x02, 0x04, 0x02, 0x81,
+  0x02, 0x03, 0x02, 0x06, 0x02, 0x80, 0x01, 0x03, 0x0A, 0x01, 0x02, 0x0C, 0x02, 0x02, 0x02, 0x08,
+  0x02, 0x80, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x80, 0x02, 0x00, 0x03, 0x0A, 0x03,
+  // 0x43 'C'
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x05, 0x04, 0x02, 0x01, 0x03, 0x09, 0x02,
+  0x02, 0x01, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x03, 0x0B, 0x02, 0x01, 0x00, 0x02, 0x83, 0x02, 0x00,
+  0x02, 0x0C, 0x02, 0x02, 0x00, 0x03, 0x0B, 0x02, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x02, 0x01, 0x03,
+  0x09, 0x02, 0x02, 0x02, 0x04, 0x05, 0x04, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07,
+  // 0x44 'D'
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0C, 0x02, 0x00, 0x02, 0x07, 0x04, 0x02, 0x00, 0x02, 0x09, 0x03,
+  0x02, 0x00, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x0A, 0x03, 0x02, 0x00, 0x02, 0x0B, 0x02, 0x84,
+  0x02, 0x00, 0x02, 0x0A, 0x03, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02,
+  0x00, 0x02, 0x07, 0x04, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0A,
+  // 0x49 'I'
+  0x01, 0x00, 0x02, 0x90,
+  // 0x54 'T'
+  0x01, 0x00, 0x0E, 0x80, 0x01, 0x06, 0x02, 0x8E,
+  // 0x61 'a'
+  0x01, 0x03, 0x06, 0x01, 0x01, 0x09, 0x02, 0x01, 0x02, 0x05, 0x03, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x01, 0x09, 0x02, 0x01, 0x03, 0x08, 0x01, 0x01, 0x0A, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00,
+  0x02, 0x07, 0x02, 0x80, 0x02, 0x00, 0x03, 0x04, 0x04, 0x02, 0x01, 0x07, 0x01, 0x04, 0x02, 0x02,
+  0x05, 0x03, 0x03,
+  // 0x64 'd'
+  0x01, 0x0A, 0x02, 0x83, 0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x01,
+  0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x06, 0x03, 0x02, 0x00, 0x03, 0x07, 0x02, 0x02, 0x00, 0x02,
+  0x08, 0x02, 0x81, 0x02, 0x00, 0x03, 0x07, 0x02, 0x02, 0x01, 0x02, 0x06, 0x03, 0x02, 0x01, 0x04,
+  0x02, 0x05, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02,
+  // 0x65 'e'
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x08, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+  0x01, 0x02, 0x06, 0x03, 0x02, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02, 0x08, 0x01, 0x04, 0x04,
+  // 0x67 'g'
+  0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x01, 0x04, 0x02, 0x05, 0x02,
+  0x01, 0x02, 0x06, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x82, 0x02, 0x00, 0x03, 0x07, 0x02, 0x02,
+  0x01, 0x02, 0x06, 0x03, 0x02, 0x01, 0x04, 0x02, 0x05, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x04,
+  0x04, 0x02, 0x02, 0x01, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x00, 0x02, 0x07, 0x03,
+  0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x0A, 0x01, 0x03, 0x06,
+  // 0x68 'h'
+  0x01, 0x00, 0x02, 0x83, 0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x01, 0x07, 0x02, 0x00,
+  0x04, 0x04, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02, 0x87,
+  // 0x69 'i'
+  0x01, 0x00, 0x02, 0x81, 0x00, 0x80, 0x01, 0x00, 0x02, 0x8B,
+  // 0x6B 'k'
+  0x01, 0x00, 0x02, 0x82, 0x02, 0x00, 0x02, 0x05, 0x03, 0x02, 0x00, 0x02, 0x04, 0x03, 0x02, 0x00,
+  0x02, 0x03, 0x03, 0x02, 0x00, 0x02, 0x02, 0x03, 0x02, 0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x07, 0x02, 0x00, 0x03, 0x02, 0x02, 0x02, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 0x02,
+  0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x03, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05,
+  0x03,
+  // 0x6C 'l'
+  0x01, 0x00, 0x02, 0x90,
+  // 0x6D 'm'
+  0x03, 0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x03, 0x00, 0x02, 0x01, 0x06, 0x01, 0x07, 0x03, 0x00,
+  0x04, 0x03, 0x05, 0x03, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x05, 0x02, 0x03, 0x00, 0x02, 0x06,
+  0x02, 0x06, 0x02, 0x87,
+  // 0x70 'p'
+  0x02, 0x00, 0x02, 0x02, 0x04, 0x02, 0x00, 0x02, 0x01, 0x07, 0x02, 0x00, 0x05, 0x02, 0x04, 0x02,
+  0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x81, 0x02,
+  0x00, 0x02, 0x07, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x05, 0x02, 0x04, 0x02, 0x00,
+  0x02, 0x01, 0x07, 0x02, 0x00, 0x02, 0x02, 0x04, 0x01, 0x00, 0x02, 0x83,
+  // 0x72 'r'
+  0x02, 0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x88,
+  // 0x73 's'
+  0x01, 0x02, 0x05, 0x01, 0x01, 0x08, 0x02, 0x00, 0x03, 0x04, 0x02, 0x02, 0x00, 0x02, 0x06, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x07, 0x01, 0x05, 0x05, 0x01, 0x08, 0x02, 0x02,
+  0x00, 0x02, 0x06, 0x02, 0x02, 0x00, 0x03, 0x04, 0x03, 0x01, 0x01, 0x08, 0x01, 0x02, 0x06,
+  // 0x74 't'
+  0x01, 0x02, 0x02, 0x82, 0x01, 0x00, 0x06, 0x80, 0x01, 0x02, 0x02, 0x87, 0x01, 0x02, 0x04, 0x01,
+  0x03, 0x03,
+  // 0x76 'v'
+  0x02, 0x00, 0x02, 0x07, 0x02, 0x80, 0x02, 0x01, 0x02, 0x05, 0x02, 0x81, 0x02, 0x02, 0x02, 0x03,
+  0x02, 0x81, 0x02, 0x03, 0x02, 0x01, 0x02, 0x80, 0x01, 0x03, 0x05, 0x01, 0x04, 0x03, 0x80,
+};
+
+const tftSpanGlyph dashFont4Glyphs[] PROGMEM = {
+  {     0,   5,   0,   0,    0,    0 }, // 0x20 ' '
+  {     0,   0,   0,   0,    0,    0 }, // 0x21 '!'
+  {     0,   0,   0,   0,    0,    0 }, // 0x22 '"'
+  {     0,   0,   0,   0,    0,    0 }, // 0x23 '#'
+  {     0,   0,   0,   0,    0,    0 }, // 0x24 '$'
+  {     0,   0,   0,   0,    0,    0 }, // 0x25 '%'
+  {     0,   0,   0,   0,    0,    0 }, // 0x26 '&'
+  {     0,   0,   0,   0,    0,    0 }, // 0x27 '''
+  {     0,   0,   0,   0,    0,    0 }, // 0x28 '('
+  {     0,   0,   0,   0,    0,    0 }, // 0x29 ')'
+  {     0,   0,   0,   0,    0,    0 }, // 0x2A '*'
+  {     0,   0,   0,   0,    0,    0 }, // 0x2B '+'
+  {     0,   7,   3,   7,    2,   16 }, // 0x2C ','
+  {    16,   8,   6,   2,    1,   11 }, // 0x2D '-'
+  {    20,   7,   3,   3,    2,   16 }, // 0x2E '.'
+  {    24,   8,   8,  20,    0,    1 }, // 0x2F '/'
+  {    70,  14,  12,  17,    1,    2 }, // 0x30 '0'
+  {   118,  14,   6,  17,    3,    2 }, // 0x31 '1'
+  {   133,  14,  12,  17,    1,    2 }, // 0x32 '2'
+  {   186,  14,  12,  17,    1,    2 }, // 0x33 '3'
+  {   247,  14,  12,  17,    1,    2 }, // 0x34 '4'
+  {   296,  14,  12,  17,    1,    2 }, // 0x35 '5'
+  {   347,  14,  12,  17,    1,    2 }, // 0x36 '6'
+  {   407,  14,  12,  17,    1,    2 }, // 0x37 '7'
+  {   444,  14,  12,  17,    1,    2 }, // 0x38 '8'
+  {   494,  14,  12,  17,    1,    2 }, // 0x39 '9'
+  {   554,   7,   3,  13,    2,    6 }, // 0x3A ':'
+  {   564,   0,   0,   0,    0,    0 }, // 0x3B ';'
+  {   564,   0,   0,   0,    0,    0 }, // 0x3C '<'
+  {   564,   0,   0,   0,    0,    0 }, // 0x3D '='
+  {   564,   0,   0,   0,    0,    0 }, // 0x3E '>'
+  {   564,   0,   0,   0,    0,    0 }, // 0x3F '?'
+  {   564,   0,   0,   0,    0,    0 }, // 0x40 '@'
+  {   564,  16,  16,  18,    0,    1 }, // 0x41 'A'
+  {   609,   0,   0,   0,    0,    0 }, // 0x42 'B'
+  {   609,  18,  16,  18,    1,    1 }, // 0x43 'C'
+  {   670,  18,  15,  18,    2,    1 }, // 0x44 'D'
+  {   728,   0,   0,   0,    0,    0 }, // 0x45 'E'
+  {   728,   0,   0,   0,    0,    0 }, // 0x46 'F'
+  {   728,   0,   0,   0,    0,    0 }, // 0x47 'G'
+  {   728,   0,   0,   0,    0,    0 }, // 0x48 'H'
+  {   728,   6,   2,  18,    2,    1 }, // 0x49 'I'
+  {   732,   0,   0,   0,    0,    0 }, // 0x4A 'J'
+  {   732,   0,   0,   0,    0,    0 }, // 0x4B 'K'
+  {   732,   0,   0,   0,    0,    0 }, // 0x4C 'L'
+  {   732,   0,   0,   0,    0,    0 }, // 0x4D 'M'
+  {   732,   0,   0,   0,    0,    0 }, // 0x4E 'N'
+  {   732,   0,   0,   0,    0,    0 }, // 0x4F 'O'
+  {   732,   0,   0,   0,    0,    0 }, // 0x50 'P'
+  {   732,   0,   0,   0,    0,    0 }, // 0x51 'Q'
+  {   732,   0,   0,   0,    0,    0 }, // 0x52 'R'
+  {   732,   0,   0,   0,    0,    0 }, // 0x53 'S'
+  {   732,  14,  14,  18,    0,    1 }, // 0x54 'T'
+  {   740,   0,   0,   0,    0,    0 }, // 0x55 'U'
+  {   740,   0,   0,   0,    0,    0 }, // 0x56 'V'
+  {   740,   0,   0,   0,    0,    0 }, // 0x57 'W'
+  {   740,   0,   0,   0,    0,    0 }, // 0x58 'X'
+  {   740,   0,   0,   0,    0,    0 }, // 0x59 'Y'
+  {   740,   0,   0,   0,    0,    0 }, // 0x5A 'Z'
+  {   740,   0,   0,   0,    0,    0 }, // 0x5B '['
+  {   740,   0,   0,   0,    0,    0 }, // 0x5C
+  {   740,   0,   0,   0,    0,    0 }, // 0x5D ']'
+  {   740,   0,   0,   0,    0,    0 }, // 0x5E '^'
+  {   740,   0,   0,   0,    0,    0 }, // 0x5F '_'
+  {   740,   0,   0,   0,    0,    0 }, // 0x60 '`'
+  {   740,  14,  13,  13,    1,    6 }, // 0x61 'a'
+  {   791,   0,   0,   0,    0,    0 }, // 0x62 'b'
+  {   791,   0,   0,   0,    0,    0 }, // 0x63 'c'
+  {   791,  15,  12,  18,    1,    1 }, // 0x64 'd'
+  {   851,  14,  12,  13,    1,    6 }, // 0x65 'e'
+  {   898,   0,   0,   0,    0,    0 }, // 0x66 'f'
+  {   898,  15,  12,  19,    1,    6 }, // 0x67 'g'
+  {   973,  15,  11,  18,    2,    1 }, // 0x68 'h'
+  {  1003,   6,   2,  18,    2,    1 }, // 0x69 'i'
+  {  1013,   0,   0,   0,    0,    0 }, // 0x6A 'j'
+  {  1013,  12,  10,  17,    2,    2 }, // 0x6B 'k'
+  {  1078,   6,   2,  18,    2,    1 }, // 0x6C 'l'
+  {  1082,  22,  18,  13,    2,    6 }, // 0x6D 'm'
+  {  1118,   0,   0,   0,    0,    0 }, // 0x6E 'n'
+  {  1118,   0,   0,   0,    0,    0 }, // 0x6F 'o'
+  {  1118,  15,  12,  18,    2,    6 }, // 0x70 'p'
+  {  1178,   0,   0,   0,    0,    0 }, // 0x71 'q'
+  {  1178,   8,   6,  13,    2,    6 }, // 0x72 'r'
+  {  1193,  12,  10,  13,    1,    6 }, // 0x73 's'
+  {  1240,   7,   6,  17,    0,    2 }, // 0x74 't'
+  {  1258,   0,   0,   0,    0,    0 }, // 0x75 'u'
+  {  1258,  12,  11,  13,    0,    6 }, // 0x76 'v'
+};
+
+const tftSpanFont dashFont4 PROGMEM = {
+  dashFont4Rows, dashFont4Glyphs, 0x20, 0x76, 26, 19
+};
@@ -0,0 +1,101 @@
+// Font 6 as span encoded glyphs, generated by tools/font_compiler:
+//   ./font_compiler --name dashFont6 --out include/dash_font6.h --chars 0123456789 6
+// Only these glyphs are kept: 0123456789
+// Register it with tft.setSpanFont(font, &dashFont6)
+
+const uint8_t dashFont6Rows[] PROGMEM = {
+  // 0x30 '0'
+  0x01, 0x08, 0x08, 0x01, 0x05, 0x0E, 0x01, 0x04, 0x10, 0x01, 0x03, 0x12, 0x02, 0x02, 0x07, 0x06,
+  0x07, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x02, 0x02, 0x04, 0x0C, 0x04, 0x02, 0x01, 0x05, 0x0C, 0x05,
+  0x02, 0x01, 0x04, 0x0E, 0x04, 0x81, 0x02, 0x00, 0x04, 0x10, 0x04, 0x8C, 0x02, 0x01, 0x04, 0x0E,
+  0x04, 0x81, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x05, 0x0A,
+  0x05, 0x02, 0x02, 0x07, 0x06, 0x07, 0x01, 0x03, 0x12, 0x01, 0x04, 0x10, 0x01, 0x05, 0x0E, 0x01,
+  0x08, 0x08,
+  // 0x31 '1'
+  0x01, 0x0A, 0x03, 0x80, 0x01, 0x09, 0x04, 0x80, 0x01, 0x08, 0x05, 0x01, 0x07, 0x06, 0x01, 0x05,
+  0x08, 0x01, 0x00, 0x0D, 0x80, 0x02, 0x00, 0x08, 0x01, 0x04, 0x02, 0x00, 0x05, 0x04, 0x04, 0x01,
+  0x09, 0x04, 0x96,
+  // 0x32 '2'
+  0x01, 0x08, 0x08, 0x01, 0x06, 0x0D, 0x01, 0x04, 0x10, 0x01, 0x03, 0x12, 0x02, 0x03, 0x06, 0x06,
+  0x07, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x02, 0x02, 0x05, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x0C, 0x05,
+  0x02, 0x01, 0x05, 0x0D, 0x04, 0x02, 0x01, 0x04, 0x0E, 0x04, 0x81, 0x01, 0x13, 0x04, 0x01, 0x12,
+  0x05, 0x80, 0x01, 0x11, 0x05, 0x01, 0x10, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0D, 0x07, 0x01, 0x0B,
+  0x08, 0x01, 0x09, 0x09, 0x01, 0x08, 0x09, 0x01, 0x06, 0x09, 0x01, 0x05, 0x08, 0x01, 0x04, 0x07,
+  0x01, 0x03, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x80,
+  0x01, 0x00, 0x17, 0x82,
+  // 0x33 '3'
+  0x01, 0x08, 0x08, 0x01, 0x05, 0x0E, 0x01, 0x04, 0x11, 0x01, 0x03, 0x12, 0x02, 0x02, 0x07, 0x06,
+  0x07, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x80, 0x02, 0x01, 0x04, 0x0E,
+  0x04, 0x81, 0x01, 0x12, 0x05, 0x80, 0x01, 0x11, 0x05, 0x01, 0x10, 0x06, 0x01, 0x09, 0x0C, 0x01,
+  0x09, 0x0A, 0x01, 0x09, 0x0C, 0x01, 0x09, 0x0D, 0x01, 0x10, 0x07, 0x01, 0x12, 0x05, 0x01, 0x13,
+  0x05, 0x80, 0x02, 0x00, 0x04, 0x10, 0x04, 0x81, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05,
+  0x0D, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x06, 0x0A, 0x06, 0x02, 0x02, 0x07, 0x06,
+  0x07, 0x01, 0x03, 0x12, 0x01, 0x04, 0x10, 0x01, 0x05, 0x0E, 0x01, 0x08, 0x08,
+  // 0x34 '4'
+  0x01, 0x0F, 0x04, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x06, 0x01, 0x0C, 0x07, 0x80, 0x01, 0x0B, 0x08,
+  0x02, 0x0A, 0x04, 0x01, 0x04, 0x80, 0x02, 0x09, 0x04, 0x02, 0x04, 0x02, 0x08, 0x04, 0x03, 0x04,
+  0x02, 0x07, 0x05, 0x03, 0x04, 0x02, 0x07, 0x04, 0x04, 0x04, 0x02, 0x06, 0x04, 0x05, 0x04, 0x02,
+  0x05, 0x04, 0x06, 0x04, 0x02, 0x04, 0x05, 0x06, 0x04, 0x02, 0x04, 0x04, 0x07, 0x04, 0x02, 0x03,
+  0x04, 0x08, 0x04, 0x02, 0x02, 0x05, 0x08, 0x04, 0x02, 0x02, 0x04, 0x09, 0x04, 0x02, 0x01, 0x04,
+  0x0A, 0x04, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x01, 0x00, 0x18, 0x82, 0x01, 0x0F, 0x04, 0x87,
+  // 0x35 '5'
+  0x01, 0x03, 0x12, 0x82, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x81, 0x01, 0x02, 0x03, 0x81, 0x02,
+  0x01, 0x04, 0x03, 0x08, 0x02, 0x01, 0x04, 0x01, 0x0C, 0x01, 0x01, 0x12, 0x01, 0x01, 0x13, 0x02,
+  0x01, 0x07, 0x06, 0x07, 0x02, 0x01, 0x05, 0x0A, 0x06, 0x02, 0x01, 0x04, 0x0C, 0x05, 0x01, 0x12,
+  0x04, 0x01, 0x12, 0x05, 0x01, 0x13, 0x04, 0x83, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04,
+  0x0E, 0x05, 0x02, 0x00, 0x04, 0x0E, 0x04, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0A,
+  0x06, 0x02, 0x01, 0x07, 0x06, 0x07, 0x01, 0x02, 0x12, 0x01, 0x03, 0x10, 0x01, 0x04, 0x0E, 0x01,
+  0x07, 0x08,
+  // 0x36 '6'
+  0x01, 0x09, 0x07, 0x01, 0x07, 0x0C, 0x01, 0x05, 0x0F, 0x01, 0x04, 0x11, 0x02, 0x03, 0x07, 0x06,
+  0x06, 0x02, 0x02, 0x06, 0x0A, 0x05, 0x02, 0x02, 0x05, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x05,
+  0x02, 0x01, 0x05, 0x0E, 0x04, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x01, 0x01, 0x04, 0x80, 0x01, 0x00,
+  0x04, 0x02, 0x00, 0x04, 0x05, 0x07, 0x02, 0x00, 0x04, 0x03, 0x0C, 0x02, 0x00, 0x04, 0x01, 0x0F,
+  0x01, 0x00, 0x15, 0x02, 0x00, 0x09, 0x06, 0x07, 0x02, 0x00, 0x07, 0x0A, 0x05, 0x02, 0x00, 0x06,
+  0x0C, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x04, 0x10,
+  0x04, 0x83, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x02, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x01, 0x05, 0x0C,
+  0x05, 0x02, 0x02, 0x05, 0x0A, 0x06, 0x02, 0x02, 0x07, 0x06, 0x07, 0x01, 0x03, 0x12, 0x01, 0x04,
+  0x10, 0x01, 0x06, 0x0D, 0x01, 0x08, 0x09,
+  // 0x37 '7'
+  0x01, 0x00, 0x17, 0x82, 0x01, 0x13, 0x04, 0x01, 0x12, 0x04, 0x01, 0x11, 0x04, 0x01, 0x10, 0x04,
+  0x01, 0x0F, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x05, 0x01,
+  0x0B, 0x05, 0x80, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01,
+  0x08, 0x05, 0x80, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x80, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x04, 0x82, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04, 0x81,
+  // 0x38 '8'
+  0x01, 0x09, 0x06, 0x01, 0x06, 0x0C, 0x01, 0x04, 0x10, 0x01, 0x03, 0x12, 0x02, 0x02, 0x07, 0x06,
+  0x07, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x80, 0x02, 0x01, 0x04, 0x0E,
+  0x04, 0x81, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x05, 0x0A,
+  0x05, 0x02, 0x03, 0x06, 0x06, 0x06, 0x01, 0x04, 0x10, 0x01, 0x05, 0x0E, 0x01, 0x04, 0x10, 0x01,
+  0x03, 0x12, 0x02, 0x02, 0x06, 0x08, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x04, 0x0E,
+  0x04, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x04, 0x10, 0x04, 0x83, 0x02, 0x00, 0x05, 0x0E,
+  0x05, 0x80, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x07, 0x08, 0x07, 0x01, 0x02, 0x14, 0x01,
+  0x03, 0x12, 0x01, 0x04, 0x10, 0x01, 0x07, 0x0A,
+  // 0x39 '9'
+  0x01, 0x07, 0x09, 0x01, 0x05, 0x0D, 0x01, 0x04, 0x10, 0x01, 0x03, 0x12, 0x02, 0x02, 0x07, 0x06,
+  0x07, 0x02, 0x01, 0x06, 0x0A, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x04, 0x0E, 0x04,
+  0x02, 0x00, 0x05, 0x0E, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x83, 0x02, 0x00, 0x05, 0x0E, 0x05,
+  0x02, 0x01, 0x04, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x02, 0x05, 0x0A, 0x07, 0x02,
+  0x02, 0x07, 0x06, 0x09, 0x01, 0x03, 0x15, 0x02, 0x04, 0x0F, 0x01, 0x04, 0x02, 0x05, 0x0C, 0x03,
+  0x04, 0x02, 0x08, 0x07, 0x05, 0x04, 0x01, 0x14, 0x04, 0x01, 0x13, 0x04, 0x80, 0x02, 0x00, 0x04,
+  0x0F, 0x04, 0x02, 0x00, 0x04, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x04, 0x02, 0x01, 0x04, 0x0C,
+  0x05, 0x02, 0x01, 0x05, 0x0A, 0x06, 0x02, 0x02, 0x06, 0x06, 0x07, 0x01, 0x03, 0x11, 0x01, 0x04,
+  0x0F, 0x01, 0x05, 0x0C, 0x01, 0x08, 0x07,
+};
+
+const tftSpanGlyph dashFont6Glyphs[] PROGMEM = {
+  {     0,  27,  24,  36,    1,    1 }, // 0x30 '0'
+  {    82,  27,  13,  35,    5,    1 }, // 0x31 '1'
+  {   117,  27,  23,  35,    2,    1 }, // 0x32 '2'
+  {   217,  27,  24,  35,    1,    1 }, // 0x33 '3'
+  {   326,  27,  24,  34,    1,    2 }, // 0x34 '4'
+  {   421,  27,  23,  35,    2,    2 }, // 0x35 '5'
+  {   519,  27,  24,  36,    1,    1 }, // 0x36 '6'
+  {   654,  27,  23,  34,    2,    2 }, // 0x37 '7'
+  {   729,  27,  24,  36,    1,    1 }, // 0x38 '8'
+  {   849,  27,  24,  36,    1,    1 }, // 0x39 '9'
+};
+
+const tftSpanFont dashFont6 PROGMEM = {
+  dashFont6Rows, dashFont6Glyphs, 0x30, 0x39, 48, 36
+};
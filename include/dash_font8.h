@@ -0,0 +1,154 @@
+// Font 8 as span encoded glyphs, generated by tools/font_compiler:
+//   ./font_compiler --name dashFont8 --out include/dash_font8.h --chars 0123456789 8
+// Only these glyphs are kept: 0123456789
+// Register it with tft.setSpanFont(font, &dashFont8)
+
+const uint8_t dashFont8Rows[] PROGMEM = {
+  // 0x30 '0'
+  0x01, 0x11, 0x0B, 0x01, 0x0E, 0x11, 0x01, 0x0C, 0x15, 0x01, 0x0A, 0x19, 0x01, 0x09, 0x1B, 0x01,
+  0x08, 0x1D, 0x01, 0x07, 0x1F, 0x01, 0x06, 0x21, 0x02, 0x06, 0x0D, 0x07, 0x0D, 0x02, 0x05, 0x0C,
+  0x0B, 0x0C, 0x02, 0x04, 0x0B, 0x0F, 0x0A, 0x02, 0x04, 0x0A, 0x11, 0x0A, 0x02, 0x04, 0x09, 0x13,
+  0x09, 0x02, 0x03, 0x0A, 0x13, 0x0A, 0x02, 0x03, 0x09, 0x15, 0x09, 0x02, 0x02, 0x0A, 0x15, 0x09,
+  0x02, 0x02, 0x09, 0x17, 0x09, 0x81, 0x02, 0x01, 0x09, 0x19, 0x09, 0x84, 0x02, 0x00, 0x09, 0x1B,
+  0x09, 0x92, 0x02, 0x01, 0x09, 0x19, 0x09, 0x84, 0x02, 0x02, 0x09, 0x17, 0x09, 0x81, 0x02, 0x02,
+  0x0A, 0x15, 0x0A, 0x02, 0x03, 0x09, 0x15, 0x09, 0x02, 0x03, 0x0A, 0x13, 0x0A, 0x02, 0x04, 0x09,
+  0x13, 0x09, 0x02, 0x04, 0x0A, 0x11, 0x0A, 0x02, 0x04, 0x0B, 0x0F, 0x0B, 0x02, 0x05, 0x0C, 0x0B,
+  0x0C, 0x02, 0x06, 0x0D, 0x07, 0x0D, 0x01, 0x06, 0x21, 0x01, 0x07, 0x1F, 0x01, 0x08, 0x1D, 0x01,
+  0x09, 0x1B, 0x01, 0x0A, 0x19, 0x01, 0x0C, 0x15, 0x01, 0x0E, 0x11, 0x01, 0x11, 0x0B,
+  // 0x31 '1'
+  0x01, 0x13, 0x06, 0x01, 0x12, 0x07, 0x80, 0x01, 0x11, 0x08, 0x01, 0x10, 0x09, 0x80, 0x01, 0x0F,
+  0x0A, 0x01, 0x0E, 0x0B, 0x01, 0x0D, 0x0C, 0x01, 0x0C, 0x0D, 0x01, 0x0A, 0x0F, 0x01, 0x09, 0x10,
+  0x01, 0x08, 0x11, 0x01, 0x07, 0x12, 0x01, 0x05, 0x14, 0x01, 0x03, 0x16, 0x02, 0x01, 0x0E, 0x01,
+  0x09, 0x02, 0x00, 0x0D, 0x03, 0x09, 0x02, 0x00, 0x0C, 0x04, 0x09, 0x02, 0x00, 0x0B, 0x05, 0x09,
+  0x02, 0x00, 0x09, 0x07, 0x09, 0x02, 0x00, 0x08, 0x08, 0x09, 0x02, 0x00, 0x06, 0x0A, 0x09, 0x02,
+  0x00, 0x04, 0x0C, 0x09, 0x02, 0x00, 0x02, 0x0E, 0x09, 0x01, 0x10, 0x09, 0xAA,
+  // 0x32 '2'
+  0x01, 0x11, 0x0B, 0x01, 0x0D, 0x13, 0x01, 0x0B, 0x17, 0x01, 0x09, 0x1B, 0x01, 0x08, 0x1D, 0x01,
+  0x07, 0x1F, 0x01, 0x06, 0x21, 0x01, 0x05, 0x23, 0x02, 0x04, 0x0F, 0x08, 0x0E, 0x02, 0x04, 0x0C,
+  0x0D, 0x0D, 0x02, 0x03, 0x0B, 0x11, 0x0B, 0x02, 0x03, 0x0A, 0x13, 0x0B, 0x02, 0x02, 0x0A, 0x15,
+  0x0A, 0x80, 0x02, 0x02, 0x09, 0x17, 0x0A, 0x80, 0x02, 0x01, 0x09, 0x19, 0x09, 0x81, 0x02, 0x05,
+  0x05, 0x19, 0x09, 0x01, 0x23, 0x09, 0x81, 0x01, 0x22, 0x0A, 0x01, 0x22, 0x09, 0x01, 0x21, 0x0A,
+  0x80, 0x01, 0x20, 0x0A, 0x80, 0x01, 0x1F, 0x0A, 0x01, 0x1E, 0x0B, 0x01, 0x1D, 0x0B, 0x01, 0x1C,
+  0x0C, 0x01, 0x1B, 0x0C, 0x01, 0x1A, 0x0C, 0x01, 0x19, 0x0C, 0x01, 0x18, 0x0C, 0x01, 0x17, 0x0D,
+  0x01, 0x16, 0x0D, 0x01, 0x15, 0x0D, 0x01, 0x14, 0x0D, 0x01, 0x13, 0x0D, 0x01, 0x11, 0x0D, 0x01,
+  0x10, 0x0D, 0x01, 0x0F, 0x0D, 0x01, 0x0E, 0x0D, 0x01, 0x0D, 0x0D, 0x01, 0x0B, 0x0E, 0x01, 0x0A,
+  0x0E, 0x01, 0x09, 0x0D, 0x01, 0x08, 0x0D, 0x01, 0x07, 0x0D, 0x01, 0x07, 0x0C, 0x01, 0x06, 0x0C,
+  0x01, 0x05, 0x0B, 0x01, 0x04, 0x0B, 0x01, 0x04, 0x0A, 0x01, 0x03, 0x0B, 0x01, 0x03, 0x0A, 0x01,
+  0x02, 0x0A, 0x01, 0x02, 0x2B, 0x01, 0x01, 0x2C, 0x81, 0x01, 0x00, 0x2D, 0x83,
+  // 0x33 '3'
+  0x01, 0x10, 0x0A, 0x01, 0x0D, 0x11, 0x01, 0x0B, 0x15, 0x01, 0x09, 0x18, 0x01, 0x08, 0x1B, 0x01,
+  0x07, 0x1D, 0x01, 0x06, 0x1F, 0x01, 0x05, 0x21, 0x02, 0x05, 0x0D, 0x07, 0x0D, 0x02, 0x04, 0x0C,
+  0x0B, 0x0C, 0x02, 0x03, 0x0B, 0x0F, 0x0A, 0x02, 0x03, 0x0A, 0x11, 0x0A, 0x02, 0x03, 0x09, 0x13,
+  0x09, 0x02, 0x02, 0x0A, 0x13, 0x0A, 0x02, 0x02, 0x09, 0x15, 0x09, 0x80, 0x02, 0x01, 0x0A, 0x15,
+  0x09, 0x02, 0x01, 0x09, 0x16, 0x09, 0x02, 0x05, 0x05, 0x16, 0x09, 0x01, 0x20, 0x09, 0x80, 0x01,
+  0x1F, 0x09, 0x80, 0x01, 0x1E, 0x0A, 0x01, 0x1D, 0x0A, 0x01, 0x1C, 0x0A, 0x01, 0x1A, 0x0C, 0x01,
+  0x18, 0x0D, 0x01, 0x12, 0x12, 0x01, 0x12, 0x10, 0x01, 0x12, 0x0E, 0x01, 0x12, 0x10, 0x01, 0x11,
+  0x13, 0x01, 0x11, 0x15, 0x01, 0x11, 0x16, 0x02, 0x11, 0x02, 0x08, 0x0D, 0x01, 0x1D, 0x0C, 0x01,
+  0x1F, 0x0B, 0x01, 0x20, 0x0A, 0x01, 0x21, 0x0A, 0x01, 0x22, 0x0A, 0x80, 0x01, 0x23, 0x09, 0x01,
+  0x23, 0x0A, 0x01, 0x24, 0x09, 0x84, 0x02, 0x04, 0x05, 0x1B, 0x09, 0x02, 0x00, 0x09, 0x1B, 0x09,
+  0x02, 0x00, 0x0A, 0x19, 0x0A, 0x02, 0x00, 0x0A, 0x19, 0x09, 0x02, 0x01, 0x09, 0x19, 0x09, 0x02,
+  0x01, 0x0A, 0x17, 0x0A, 0x02, 0x01, 0x0A, 0x16, 0x0A, 0x02, 0x02, 0x0A, 0x15, 0x0A, 0x02, 0x02,
+  0x0B, 0x13, 0x0A, 0x02, 0x03, 0x0B, 0x11, 0x0B, 0x02, 0x03, 0x0C, 0x0E, 0x0C, 0x02, 0x04, 0x0E,
+  0x08, 0x0E, 0x01, 0x05, 0x23, 0x01, 0x06, 0x21, 0x01, 0x07, 0x1E, 0x01, 0x08, 0x1C, 0x01, 0x09,
+  0x1A, 0x01, 0x0B, 0x16, 0x01, 0x0D, 0x12, 0x01, 0x11, 0x0A,
+  // 0x34 '4'
+  0x01, 0x21, 0x07, 0x01, 0x20, 0x08, 0x01, 0x1F, 0x09, 0x01, 0x1E, 0x0A, 0x80, 0x01, 0x1D, 0x0B,
+  0x01, 0x1C, 0x0C, 0x01, 0x1B, 0x0D, 0x01, 0x1A, 0x0E, 0x80, 0x01, 0x19, 0x0F, 0x01, 0x18, 0x10,
+  0x01, 0x17, 0x11, 0x80, 0x01, 0x16, 0x12, 0x01, 0x15, 0x13, 0x01, 0x14, 0x14, 0x80, 0x02, 0x13,
+  0x0B, 0x01, 0x09, 0x02, 0x12, 0x0B, 0x02, 0x09, 0x02, 0x11, 0x0B, 0x03, 0x09, 0x02, 0x10, 0x0C,
+  0x03, 0x09, 0x02, 0x10, 0x0B, 0x04, 0x09, 0x02, 0x0F, 0x0B, 0x05, 0x09, 0x02, 0x0E, 0x0B, 0x06,
+  0x09, 0x02, 0x0D, 0x0B, 0x07, 0x09, 0x80, 0x02, 0x0C, 0x0B, 0x08, 0x09, 0x02, 0x0B, 0x0B, 0x09,
+  0x09, 0x02, 0x0A, 0x0B, 0x0A, 0x09, 0x80, 0x02, 0x09, 0x0B, 0x0B, 0x09, 0x02, 0x08, 0x0B, 0x0C,
+  0x09, 0x02, 0x07, 0x0B, 0x0D, 0x09, 0x80, 0x02, 0x06, 0x0B, 0x0E, 0x09, 0x02, 0x05, 0x0B, 0x0F,
+  0x09, 0x02, 0x04, 0x0B, 0x10, 0x09, 0x02, 0x03, 0x0C, 0x10, 0x09, 0x02, 0x03, 0x0B, 0x11, 0x09,
+  0x02, 0x02, 0x0B, 0x12, 0x09, 0x02, 0x01, 0x0B, 0x13, 0x09, 0x02, 0x00, 0x0B, 0x14, 0x09, 0x01,
+  0x00, 0x30, 0x87, 0x01, 0x1F, 0x09, 0x8E,
+  // 0x35 '5'
+  0x01, 0x08, 0x21, 0x80, 0x01, 0x07, 0x22, 0x83, 0x01, 0x06, 0x23, 0x80, 0x01, 0x06, 0x09, 0x81,
+  0x01, 0x05, 0x0A, 0x01, 0x05, 0x09, 0x82, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x09, 0x82, 0x02, 0x03,
+  0x0A, 0x07, 0x09, 0x02, 0x03, 0x0A, 0x04, 0x0F, 0x02, 0x03, 0x09, 0x03, 0x13, 0x02, 0x03, 0x09,
+  0x01, 0x17, 0x01, 0x03, 0x22, 0x01, 0x02, 0x24, 0x01, 0x02, 0x25, 0x01, 0x02, 0x26, 0x02, 0x02,
+  0x10, 0x08, 0x0F, 0x02, 0x02, 0x0D, 0x0E, 0x0D, 0x02, 0x01, 0x0C, 0x12, 0x0B, 0x02, 0x01, 0x0B,
+  0x14, 0x0B, 0x02, 0x01, 0x0A, 0x16, 0x0A, 0x02, 0x05, 0x05, 0x18, 0x0A, 0x01, 0x22, 0x0A, 0x01,
+  0x23, 0x09, 0x80, 0x01, 0x23, 0x0A, 0x01, 0x24, 0x09, 0x87, 0x02, 0x04, 0x05, 0x1B, 0x09, 0x02,
+  0x00, 0x09, 0x1A, 0x09, 0x02, 0x00, 0x0A, 0x19, 0x09, 0x80, 0x02, 0x01, 0x09, 0x18, 0x0A, 0x02,
+  0x01, 0x0A, 0x17, 0x09, 0x02, 0x01, 0x0A, 0x16, 0x0A, 0x02, 0x02, 0x0A, 0x14, 0x0A, 0x02, 0x02,
+  0x0B, 0x12, 0x0B, 0x02, 0x02, 0x0C, 0x10, 0x0B, 0x02, 0x03, 0x0C, 0x0E, 0x0B, 0x02, 0x04, 0x0E,
+  0x08, 0x0E, 0x01, 0x04, 0x23, 0x01, 0x05, 0x21, 0x01, 0x06, 0x1F, 0x01, 0x08, 0x1C, 0x01, 0x09,
+  0x19, 0x01, 0x0B, 0x16, 0x01, 0x0D, 0x11, 0x01, 0x10, 0x0B,
+  // 0x36 '6'
+  0x01, 0x14, 0x0A, 0x01, 0x10, 0x11, 0x01, 0x0E, 0x16, 0x01, 0x0C, 0x19, 0x01, 0x0B, 0x1B, 0x01,
+  0x0A, 0x1D, 0x01, 0x09, 0x1F, 0x01, 0x08, 0x21, 0x02, 0x07, 0x0E, 0x07, 0x0E, 0x02, 0x06, 0x0C,
+  0x0C, 0x0C, 0x02, 0x06, 0x0B, 0x0F, 0x0B, 0x02, 0x05, 0x0A, 0x12, 0x0A, 0x02, 0x04, 0x0B, 0x13,
+  0x0A, 0x02, 0x04, 0x0A, 0x14, 0x0A, 0x02, 0x04, 0x09, 0x16, 0x09, 0x02, 0x03, 0x0A, 0x16, 0x0A,
+  0x02, 0x03, 0x09, 0x17, 0x0A, 0x02, 0x02, 0x0A, 0x18, 0x09, 0x02, 0x02, 0x09, 0x19, 0x05, 0x01,
+  0x02, 0x09, 0x01, 0x02, 0x08, 0x01, 0x01, 0x09, 0x81, 0x02, 0x01, 0x09, 0x0B, 0x09, 0x02, 0x01,
+  0x08, 0x09, 0x0F, 0x02, 0x01, 0x08, 0x07, 0x13, 0x02, 0x00, 0x09, 0x05, 0x17, 0x02, 0x00, 0x09,
+  0x04, 0x19, 0x02, 0x00, 0x09, 0x03, 0x1B, 0x02, 0x00, 0x09, 0x02, 0x1D, 0x02, 0x00, 0x09, 0x01,
+  0x1F, 0x02, 0x00, 0x13, 0x08, 0x0F, 0x02, 0x00, 0x11, 0x0D, 0x0D, 0x02, 0x00, 0x0F, 0x11, 0x0B,
+  0x02, 0x00, 0x0E, 0x13, 0x0B, 0x02, 0x00, 0x0D, 0x15, 0x0A, 0x02, 0x00, 0x0C, 0x17, 0x0A, 0x02,
+  0x00, 0x0B, 0x18, 0x0A, 0x02, 0x00, 0x0A, 0x1A, 0x09, 0x80, 0x02, 0x00, 0x0A, 0x1A, 0x0A, 0x02,
+  0x00, 0x09, 0x1C, 0x09, 0x82, 0x02, 0x01, 0x08, 0x1C, 0x09, 0x82, 0x02, 0x01, 0x09, 0x1B, 0x09,
+  0x02, 0x02, 0x08, 0x1A, 0x0A, 0x02, 0x02, 0x08, 0x1A, 0x09, 0x02, 0x02, 0x09, 0x19, 0x09, 0x02,
+  0x02, 0x09, 0x18, 0x0A, 0x02, 0x03, 0x09, 0x17, 0x09, 0x02, 0x03, 0x09, 0x16, 0x0A, 0x02, 0x04,
+  0x09, 0x15, 0x0A, 0x02, 0x04, 0x0A, 0x13, 0x0A, 0x02, 0x05, 0x0A, 0x11, 0x0B, 0x02, 0x05, 0x0C,
+  0x0D, 0x0C, 0x02, 0x06, 0x0D, 0x08, 0x0E, 0x01, 0x07, 0x22, 0x01, 0x08, 0x20, 0x01, 0x09, 0x1E,
+  0x01, 0x0A, 0x1C, 0x01, 0x0C, 0x18, 0x01, 0x0D, 0x16, 0x01, 0x10, 0x10, 0x01, 0x13, 0x0A,
+  // 0x37 '7'
+  0x01, 0x00, 0x2C, 0x86, 0x01, 0x00, 0x2B, 0x01, 0x23, 0x07, 0x01, 0x22, 0x07, 0x01, 0x21, 0x08,
+  0x01, 0x20, 0x08, 0x01, 0x1F, 0x08, 0x01, 0x1E, 0x08, 0x80, 0x01, 0x1D, 0x08, 0x01, 0x1C, 0x08,
+  0x80, 0x01, 0x1B, 0x08, 0x01, 0x1A, 0x09, 0x01, 0x1A, 0x08, 0x01, 0x19, 0x08, 0x01, 0x18, 0x09,
+  0x01, 0x18, 0x08, 0x01, 0x17, 0x09, 0x01, 0x17, 0x08, 0x01, 0x16, 0x09, 0x01, 0x15, 0x09, 0x80,
+  0x01, 0x14, 0x09, 0x80, 0x01, 0x13, 0x09, 0x80, 0x01, 0x12, 0x09, 0x81, 0x01, 0x11, 0x09, 0x80,
+  0x01, 0x10, 0x09, 0x81, 0x01, 0x0F, 0x09, 0x81, 0x01, 0x0E, 0x09, 0x81, 0x01, 0x0D, 0x09, 0x82,
+  0x01, 0x0C, 0x09, 0x82, 0x01, 0x0B, 0x09, 0x84, 0x01, 0x0A, 0x0A, 0x01, 0x0A, 0x09, 0x83,
+  // 0x38 '8'
+  0x01, 0x11, 0x0A, 0x01, 0x0D, 0x12, 0x01, 0x0B, 0x16, 0x01, 0x09, 0x1A, 0x01, 0x08, 0x1C, 0x01,
+  0x07, 0x1E, 0x01, 0x06, 0x20, 0x01, 0x05, 0x22, 0x02, 0x04, 0x0E, 0x08, 0x0D, 0x02, 0x04, 0x0C,
+  0x0C, 0x0C, 0x02, 0x03, 0x0B, 0x10, 0x0B, 0x02, 0x03, 0x0A, 0x12, 0x0A, 0x02, 0x03, 0x09, 0x14,
+  0x09, 0x02, 0x02, 0x0A, 0x14, 0x0A, 0x02, 0x02, 0x09, 0x16, 0x09, 0x85, 0x02, 0x03, 0x09, 0x14,
+  0x09, 0x80, 0x02, 0x03, 0x0A, 0x12, 0x0A, 0x02, 0x04, 0x0A, 0x10, 0x0A, 0x02, 0x05, 0x0A, 0x0E,
+  0x0A, 0x02, 0x06, 0x0C, 0x08, 0x0D, 0x01, 0x07, 0x1E, 0x01, 0x08, 0x1C, 0x01, 0x0A, 0x18, 0x01,
+  0x0C, 0x14, 0x01, 0x0A, 0x17, 0x01, 0x08, 0x1B, 0x01, 0x07, 0x1E, 0x01, 0x06, 0x20, 0x02, 0x05,
+  0x0D, 0x08, 0x0D, 0x02, 0x04, 0x0B, 0x0D, 0x0C, 0x02, 0x03, 0x0B, 0x10, 0x0B, 0x02, 0x02, 0x0B,
+  0x12, 0x0A, 0x02, 0x02, 0x0A, 0x14, 0x0A, 0x02, 0x01, 0x0A, 0x16, 0x09, 0x02, 0x01, 0x0A, 0x16,
+  0x0A, 0x02, 0x01, 0x09, 0x18, 0x09, 0x80, 0x02, 0x00, 0x09, 0x1A, 0x09, 0x87, 0x02, 0x00, 0x0A,
+  0x18, 0x0A, 0x02, 0x01, 0x09, 0x18, 0x09, 0x02, 0x01, 0x0A, 0x16, 0x0A, 0x80, 0x02, 0x02, 0x0A,
+  0x14, 0x0A, 0x02, 0x02, 0x0B, 0x12, 0x0B, 0x02, 0x03, 0x0B, 0x10, 0x0B, 0x02, 0x03, 0x0D, 0x0D,
+  0x0C, 0x02, 0x04, 0x0E, 0x08, 0x0E, 0x01, 0x05, 0x22, 0x01, 0x06, 0x20, 0x01, 0x07, 0x1E, 0x01,
+  0x08, 0x1C, 0x01, 0x09, 0x1A, 0x01, 0x0B, 0x16, 0x01, 0x0D, 0x12, 0x01, 0x11, 0x0A,
+  // 0x39 '9'
+  0x01, 0x11, 0x09, 0x01, 0x0D, 0x11, 0x01, 0x0B, 0x15, 0x01, 0x0A, 0x18, 0x01, 0x08, 0x1B, 0x01,
+  0x07, 0x1D, 0x01, 0x06, 0x1F, 0x01, 0x05, 0x21, 0x02, 0x04, 0x0F, 0x08, 0x0C, 0x02, 0x04, 0x0D,
+  0x0C, 0x0B, 0x02, 0x03, 0x0C, 0x10, 0x09, 0x02, 0x03, 0x0B, 0x12, 0x09, 0x02, 0x02, 0x0B, 0x14,
+  0x09, 0x02, 0x02, 0x0A, 0x15, 0x09, 0x02, 0x01, 0x0A, 0x17, 0x08, 0x02, 0x01, 0x0A, 0x18, 0x08,
+  0x02, 0x01, 0x09, 0x19, 0x08, 0x80, 0x02, 0x00, 0x0A, 0x1A, 0x08, 0x02, 0x00, 0x09, 0x1B, 0x08,
+  0x83, 0x02, 0x00, 0x09, 0x1B, 0x09, 0x82, 0x02, 0x00, 0x0A, 0x19, 0x0A, 0x02, 0x01, 0x09, 0x19,
+  0x0A, 0x80, 0x02, 0x01, 0x0A, 0x17, 0x0B, 0x80, 0x02, 0x02, 0x0A, 0x15, 0x0C, 0x02, 0x02, 0x0B,
+  0x13, 0x0D, 0x02, 0x03, 0x0B, 0x11, 0x0E, 0x02, 0x03, 0x0D, 0x0D, 0x10, 0x02, 0x04, 0x0F, 0x08,
+  0x12, 0x02, 0x05, 0x1E, 0x01, 0x09, 0x02, 0x06, 0x1C, 0x02, 0x09, 0x02, 0x07, 0x1A, 0x03, 0x09,
+  0x02, 0x08, 0x18, 0x04, 0x09, 0x02, 0x09, 0x16, 0x05, 0x09, 0x02, 0x0A, 0x13, 0x07, 0x08, 0x02,
+  0x0C, 0x0F, 0x09, 0x08, 0x02, 0x0F, 0x09, 0x0B, 0x09, 0x01, 0x23, 0x09, 0x81, 0x01, 0x23, 0x08,
+  0x01, 0x22, 0x09, 0x02, 0x05, 0x05, 0x18, 0x09, 0x02, 0x01, 0x09, 0x18, 0x09, 0x02, 0x01, 0x0A,
+  0x16, 0x09, 0x80, 0x02, 0x02, 0x09, 0x15, 0x0A, 0x02, 0x02, 0x0A, 0x14, 0x09, 0x02, 0x02, 0x0A,
+  0x13, 0x0A, 0x02, 0x03, 0x0A, 0x11, 0x0A, 0x02, 0x03, 0x0B, 0x0F, 0x0B, 0x02, 0x03, 0x0C, 0x0C,
+  0x0C, 0x02, 0x04, 0x0D, 0x08, 0x0D, 0x01, 0x05, 0x20, 0x01, 0x05, 0x1F, 0x01, 0x06, 0x1D, 0x01,
+  0x07, 0x1B, 0x01, 0x09, 0x18, 0x01, 0x0A, 0x15, 0x01, 0x0C, 0x11, 0x01, 0x0F, 0x0A,
+};
+
+const tftSpanGlyph dashFont8Glyphs[] PROGMEM = {
+  {     0,  55,  45,  70,    4,    4 }, // 0x30 '0'
+  {   158,  55,  25,  69,   10,    4 }, // 0x31 '1'
+  {   251,  55,  45,  69,    3,    4 }, // 0x32 '2'
+  {   440,  55,  45,  70,    4,    4 }, // 0x33 '3'
+  {   674,  55,  48,  68,    1,    5 }, // 0x34 '4'
+  {   841,  55,  45,  69,    4,    5 }, // 0x35 '5'
+  {  1027,  55,  46,  70,    3,    4 }, // 0x36 '6'
+  {  1298,  55,  44,  68,    5,    5 }, // 0x37 '7'
+  {  1409,  55,  44,  70,    4,    4 }, // 0x38 '8'
+  {  1631,  55,  45,  70,    4,    4 }, // 0x39 '9'
+};
+
+const tftSpanFont dashFont8 PROGMEM = {
+  dashFont8Rows, dashFont8Glyphs, 0x30, 0x39, 75, 73
+};
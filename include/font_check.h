@@ -0,0 +1,20 @@
+#ifndef FONT_CHECK_H
+#define FONT_CHECK_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// The span fonts are trimmed by tools/font_compiler/subset_fonts.py to the
+// characters of the string literals in src/main.cpp and its FONTn_CHARS
+// defines, a character left out would be drawn as nothing. fontCheck() is
+// called at startup for every define and catches fonts older than the
+// defines; fontCheckReport() catches text no define declared, e.g. a number
+// printed in a new way.
+
+// Prints every character of chars the span font lacks, false if there was one
+bool fontCheck(TFT_eSPI &tft, uint8_t font, const char *chars, Print &out);
+
+// Prints the last character drawn since the previous report that was missing
+void fontCheckReport(TFT_eSPI &tft, Print &out);
+
+#endif
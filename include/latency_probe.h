@@ -0,0 +1,28 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <Arduino.h>
+
+// Wheel pulse to pixel latency. The hall interrupt stamps every pulse, the
+// speed widget picks up the newest stamp when it starts drawing and closes the
+// sample once the last digit has been written to the panel. Each sample is
+// split in two stages:
+//
+//   queue  pulse until the widget starts (waiting for the next screen update)
+//   draw   widget start until the final RAMWR of the speed digits completed
+//
+// Only the first redraw after a new pulse is a sample; redraws of an old
+// value would just measure the loop period.
+
+#define LATENCY_SAMPLES 64 // ring of recent samples the percentiles are taken over
+
+void latencyPulse();       // from the hall interrupt
+void latencyWidgetBegin(); // before the speed widget draws
+void latencyPixelsDone();  // after the last speed digit was pushed
+uint32_t latencyLastUs();  // end to end time of the newest sample, 0 if none
+uint16_t latencySeq();     // samples taken so far, wraps
+
+// Prints count, p50/p90/p99 and max per stage
+void latencyReport(Print &out);
+
+#endif
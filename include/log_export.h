@@ -0,0 +1,17 @@
+#ifndef LOG_EXPORT_H
+#define LOG_EXPORT_H
+
+#include "log_protocol.h"
+
+// Streams a log to the host over Serial using the protocol in log_protocol.h.
+// logExportPoll() is meant for the idle time between screen updates: it only
+// moves what the Serial buffers accept right now and never waits on the link.
+// It returns true if it moved any bytes.
+
+#define LOG_EXPORT_POLL_BYTES 64 // upper bound of bytes moved per poll
+
+void logExportBegin(const LogSource &source);
+bool logExportPoll();
+bool logExportActive();
+
+#endif
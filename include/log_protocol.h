@@ -0,0 +1,129 @@
+#ifndef LOG_PROTOCOL_H
+#define LOG_PROTOCOL_H
+
+// Log export protocol shared by the firmware and the host tools.
+//
+// Every frame is [type][payload][crc32 little endian], COBS encoded and
+// terminated by a 0x00 byte, so a receiver can always resynchronise on the
+// next zero. The host drives the transfer: it asks for a start offset and a
+// byte window, the device streams DATA frames until the window is used up and
+// the host slides the window forward with ACK frames. Resuming an interrupted
+// transfer is just a READ from the number of bytes already on disk.
+//
+// This file has no Arduino dependencies so it builds on the host as well.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define LOG_PROTOCOL_VERSION 1
+
+#define LOG_CHUNK_SIZE 64  // data bytes per DATA frame
+#define LOG_FRAME_MAX (1 + 4 + LOG_CHUNK_SIZE + 4)        // raw frame, before COBS
+#define LOG_WIRE_MAX (LOG_FRAME_MAX + LOG_FRAME_MAX / 254 + 2) // COBS + delimiter
+
+// Host -> device
+#define LOG_CMD_INFO 0x01  // no payload
+#define LOG_CMD_READ 0x02  // u32 offset, u32 window
+#define LOG_CMD_ACK 0x03   // u32 acked offset, u32 window
+#define LOG_CMD_STOP 0x04  // no payload
+
+// Device -> host
+#define LOG_RSP_INFO 0x81  // u32 log size, u16 chunk size, u8 version
+#define LOG_RSP_DATA 0x82  // u32 offset, data
+#define LOG_RSP_END 0x83   // u32 log size
+#define LOG_RSP_ERROR 0x84 // u8 error code
+
+#define LOG_ERR_RANGE 1    // READ offset beyond end of log
+#define LOG_ERR_COMMAND 2  // unknown command
+
+uint32_t logCrc32(const uint8_t *data, size_t len, uint32_t crc = 0);
+
+// Encode len bytes into out (room for len + len / 254 + 2 bytes), including
+// the trailing 0x00 delimiter. Returns the encoded length.
+size_t cobsEncode(const uint8_t *in, size_t len, uint8_t *out);
+
+// Decode a frame without its delimiter, in place is allowed. Returns the
+// decoded length or 0 if the frame is malformed.
+size_t cobsDecode(const uint8_t *in, size_t len, uint8_t *out);
+
+// Build a complete wire frame from a type and payload, returns its length
+size_t logBuildFrame(uint8_t type, const uint8_t *payload, size_t len, uint8_t *wire);
+
+// Check a decoded frame's CRC, returns the payload length (excluding type and
+// CRC) or -1 if the frame is too short or corrupt
+int logCheckFrame(const uint8_t *frame, size_t len);
+
+inline void logPut32(uint8_t *p, uint32_t v)
+{
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+}
+
+inline uint32_t logGet32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Accumulates received bytes into frames
+class LogFrameReader
+{
+public:
+  // Feed one byte, returns the decoded frame length once a delimiter closes a
+  // valid frame (frame() then points at [type][payload]), otherwise 0
+  size_t feed(uint8_t b);
+  const uint8_t *frame() const { return buf; }
+
+private:
+  uint8_t buf[LOG_WIRE_MAX];
+  size_t len = 0;
+  bool overflow = false;
+};
+
+// Where the exporter reads the log from
+struct LogSource
+{
+  uint32_t (*size)(void);
+  void (*read)(uint32_t offset, uint8_t *dst, uint16_t len);
+};
+
+// Device side of the protocol. It never blocks: bytes from the host go in
+// through receive() and the caller pulls as many bytes as the link can take
+// right now with transmit().
+class LogExportSession
+{
+public:
+  explicit LogExportSession(const LogSource &source) : src(source) {}
+
+  // Switches to another log, a transfer in progress ends with the old one
+  void setSource(const LogSource &source);
+
+  void receive(uint8_t b);
+  size_t transmit(uint8_t *out, size_t room);
+
+  bool active() const { return streaming || txLen > txPos; }
+
+private:
+  void handle(const uint8_t *frame, size_t len);
+  void reply(uint8_t type, const uint8_t *payload, uint8_t len);
+  bool nextFrame();
+  void restart();
+
+  LogSource src;
+  LogFrameReader reader;
+
+  uint8_t tx[LOG_WIRE_MAX];
+  size_t txLen = 0, txPos = 0;
+
+  uint8_t replyType = 0; // queued control reply, sent ahead of data
+  uint8_t replyPayload[8];
+  uint8_t replyLen = 0;
+
+  bool streaming = false;
+  bool endPending = false;
+  uint32_t offset = 0;  // next byte to send
+  uint32_t limit = 0;   // host window end, exclusive
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef MEM_MONITOR_H
+#define MEM_MONITOR_H
+
+#include <Arduino.h>
+
+// RAM usage on the F103 (20 KB shared by data, heap and stack).
+//
+// memBegin() paints the gap between the heap and the stack with a pattern as
+// early in setup() as possible; memPoll() scans it from the heap side for the
+// deepest word the stack has touched. Heap figures come from mallinfo(), and
+// when the firmware is linked with the malloc/free wrappers (see
+// platformio.ini, MEM_MONITOR_WRAP) also from counting the calls that go
+// through them, which adds the peak and the number of failed allocations.
+// newlib's internal allocations do not go through the wrappers.
+//
+// "Largest block" is what a single malloc() can get right now: the biggest
+// chunk on newlib-nano's free list, or the untouched room between the heap
+// end and the stack low water mark less MEM_STACK_GUARD if that is bigger.
+// Fragmentation is the share of free memory outside it.
+//
+// The figures are printed by memReport() and sent in every telemetry frame
+// (telemetry_frame.h).
+
+#define MEM_PAINT 0xC5C5C5C5u
+#define MEM_STACK_GUARD 256 // bytes kept free below the deepest stack seen
+
+struct MemStats
+{
+  uint32_t stackUsed;      // bytes, high water mark since boot
+  uint32_t stackPainted;   // bytes from the top of RAM to the painted floor
+  uint32_t heapUsed;       // bytes allocated now
+  uint32_t heapPeak;       // highest heapUsed, sampled by memPoll() without the wrappers
+  uint32_t heapArena;      // bytes taken from sbrk()
+  uint32_t freeTotal;      // free chunks in the arena plus room up to the stack
+  uint32_t largestFree;    // biggest single allocation that would succeed, to within alignment
+  uint16_t fragmentation;  // 0.01 %
+  uint32_t allocs;         // allocation calls, only counted with the wrappers
+  uint32_t failedAllocs;
+};
+
+void memBegin();
+void memPoll();
+const MemStats &memStats();
+void memReport(Print &out);
+
+#endif
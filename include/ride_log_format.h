@@ -0,0 +1,122 @@
+#ifndef RIDE_LOG_FORMAT_H
+#define RIDE_LOG_FORMAT_H
+
+// Ride log file layout, shared by the firmware and the host tools.
+//
+//   block 0 | block 1 | ... | index | footer
+//
+// A block holds up to RIDE_BLOCK_MAX_SAMPLES samples taken every intervalMs
+// starting at startTime. The payload stores each field as its own column so a
+// decoder can run through one column at a time:
+//
+//   speed     zigzag varint deltas, 0.01 km/h
+//   distance  varint per sample increments, cm
+//   altitude  zigzag varint deltas, dm
+//
+// Deltas restart from zero in every block, so any block decodes on its own.
+// The index lists (startTime, file offset) for every block in time order and
+// the fixed size footer at the very end points at it.
+//
+// All multi-byte fields are little endian.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "log_protocol.h"
+
+#define RIDE_BLOCK_MAGIC 0x31424C52 // "RLB1"
+#define RIDE_INDEX_MAGIC 0x58494C52 // "RLIX"
+
+#define RIDE_BLOCK_HEADER_SIZE 16
+#define RIDE_INDEX_ENTRY_SIZE 8
+#define RIDE_FOOTER_SIZE 12
+#define RIDE_BLOCK_MAX_SAMPLES 256
+#define RIDE_BLOCK_MAX_PAYLOAD (RIDE_BLOCK_MAX_SAMPLES * 3 * 5)
+
+struct RideSample
+{
+  uint16_t speed;    // 0.01 km/h, same unit as speedk in main.cpp
+  uint16_t distance; // cm travelled since the previous sample
+  int32_t altitude;  // dm above sea level
+};
+
+// Block header:
+//   u32 magic, u32 startTime (unix seconds), u16 samples, u16 intervalMs,
+//   u16 payloadBytes, u16 payload CRC (low half of CRC32)
+struct RideBlockHeader
+{
+  uint32_t startTime;
+  uint16_t samples;
+  uint16_t intervalMs;
+  uint16_t payloadBytes;
+  uint16_t crc;
+};
+
+inline uint16_t rideGet16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+inline uint32_t rideGet32(const uint8_t *p) { return logGet32(p); }
+inline void ridePut16(uint8_t *p, uint16_t v)
+{
+  p[0] = v;
+  p[1] = v >> 8;
+}
+inline void ridePut32(uint8_t *p, uint32_t v) { logPut32(p, v); }
+
+inline uint32_t rideZigzag(int32_t v) { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+inline int32_t rideUnzigzag(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+inline uint8_t *ridePutVarint(uint8_t *p, uint32_t v)
+{
+  while (v >= 0x80)
+  {
+    *p++ = v | 0x80;
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
+inline bool rideParseHeader(const uint8_t *p, RideBlockHeader &h)
+{
+  if (rideGet32(p) != RIDE_BLOCK_MAGIC)
+    return false;
+  h.startTime = rideGet32(p + 4);
+  h.samples = rideGet16(p + 8);
+  h.intervalMs = rideGet16(p + 10);
+  h.payloadBytes = rideGet16(p + 12);
+  h.crc = rideGet16(p + 14);
+  return h.samples <= RIDE_BLOCK_MAX_SAMPLES;
+}
+
+// Encode a block into out (room for RIDE_BLOCK_HEADER_SIZE +
+// RIDE_BLOCK_MAX_PAYLOAD bytes), returns the block size
+inline size_t rideEncodeBlock(uint8_t *out, uint32_t startTime, uint16_t intervalMs,
+                              const RideSample *s, uint16_t n)
+{
+  uint8_t *p = out + RIDE_BLOCK_HEADER_SIZE;
+  int32_t prev = 0;
+
+  for (uint16_t i = 0; i < n; i++)
+  {
+    p = ridePutVarint(p, rideZigzag(s[i].speed - prev));
+    prev = s[i].speed;
+  }
+  for (uint16_t i = 0; i < n; i++)
+    p = ridePutVarint(p, s[i].distance);
+  prev = 0;
+  for (uint16_t i = 0; i < n; i++)
+  {
+    p = ridePutVarint(p, rideZigzag(s[i].altitude - prev));
+    prev = s[i].altitude;
+  }
+
+  uint16_t payload = p - out - RIDE_BLOCK_HEADER_SIZE;
+  ridePut32(out, RIDE_BLOCK_MAGIC);
+  ridePut32(out + 4, startTime);
+  ridePut16(out + 8, n);
+  ridePut16(out + 10, intervalMs);
+  ridePut16(out + 12, payload);
+  ridePut16(out + 14, logCrc32(out + RIDE_BLOCK_HEADER_SIZE, payload));
+  return RIDE_BLOCK_HEADER_SIZE + payload;
+}
+
+#endif
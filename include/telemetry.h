@@ -0,0 +1,16 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "telemetry_frame.h"
+
+// Bench telemetry on USART3 (PB10 TX). Frames go out by DMA from two
+// alternating buffers, so building and sending a frame costs a memcpy and a
+// few register writes; telemetryPoll() never waits for the UART. It returns
+// true if it built or started a frame.
+
+#define TELEMETRY_BAUD 460800
+
+void telemetryBegin(uint16_t rateHz);
+bool telemetryPoll(const TelemetrySnapshot &snapshot);
+
+#endif
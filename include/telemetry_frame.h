@@ -0,0 +1,48 @@
+#ifndef TELEMETRY_FRAME_H
+#define TELEMETRY_FRAME_H
+
+// Fixed size binary telemetry frame, shared by the firmware and
+// tools/telemetry_decoder. Little endian, 44 bytes:
+//
+//   0  u16 sync        TELEMETRY_SYNC
+//   2  u8  version     TELEMETRY_VERSION
+//   3  u8  seq         increments every frame, gaps mean dropped frames
+//   4  u32 timeUs      micros() when the snapshot was taken
+//   8  u32 pulseMs     last wheel pulse period
+//   12 u32 distanceCm  trip distance
+//   16 u16 speed       0.01 km/h
+//   18 u16 idle        CPU idle over the last screen update, 0.01 %
+//   20 u32 loopUs      time spent updating the screen in the last loop
+//   24 u32 latencyUs   wheel pulse to speed digits on the panel, last sample
+//   28 u16 dropped     frames skipped because both buffers were busy
+//   30 u16 latencySeq  latency samples taken so far, changes with latencyUs
+//   32 u16 stackUsed   stack high water mark in bytes (mem_monitor.h)
+//   34 u16 heapUsed    bytes allocated now
+//   36 u16 heapPeak    highest heapUsed
+//   38 u16 largestFree biggest single allocation that would succeed
+//   40 u16 fragment    share of free memory outside largestFree, 0.01 %
+//   42 u16 crc         low half of logCrc32() over bytes 0..41
+
+#include <stdint.h>
+
+#define TELEMETRY_SYNC 0x5AA5
+#define TELEMETRY_VERSION 4
+#define TELEMETRY_FRAME_SIZE 44
+
+struct TelemetrySnapshot
+{
+  uint32_t pulseMs;
+  uint32_t distanceCm;
+  uint16_t speed;
+  uint16_t idle;
+  uint32_t loopUs;
+  uint32_t latencyUs;
+  uint16_t latencySeq;
+  uint16_t stackUsed;
+  uint16_t heapUsed;
+  uint16_t heapPeak;
+  uint16_t largestFree;
+  uint16_t fragmentation;
+};
+
+#endif
@@ -0,0 +1,109 @@
+/**************************************************************************************
+// The following class draws a ring meter and afterwards only the section of the ring
+// that changed with the value. See ArcMeter.h
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           TFT_eArcMeter
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eArcMeter::TFT_eArcMeter(TFT_eSPI *tft)
+{
+  _tft = tft;     // Pointer to tft class so we can call member functions
+
+  _x = _y = 0;
+  _r  = 20;
+  _ir = 15;
+  _start = 0;
+  _sweep = 360;
+  _min = 0;
+  _max = 100;
+
+  _fill  = TFT_WHITE;
+  _track = TFT_DARKGREY;
+  _bg    = TFT_BLACK;
+
+  _angle = -1;
+}
+
+
+/***************************************************************************************
+** Function name:           setArc, setRange, setColors
+** Description:             Meter geometry, scale and colours
+***************************************************************************************/
+void TFT_eArcMeter::setArc(int32_t x, int32_t y, int32_t r, int32_t ir, int16_t startAngle, uint16_t sweep)
+{
+  _x = x; _y = y;
+  _r = r; _ir = ir;
+  _start = startAngle;
+  _sweep = sweep > 360 ? 360 : sweep;
+  invalidate();
+}
+
+void TFT_eArcMeter::setRange(int32_t minValue, int32_t maxValue)
+{
+  _min = minValue;
+  _max = maxValue > minValue ? maxValue : minValue + 1;
+  invalidate();
+}
+
+void TFT_eArcMeter::setColors(uint16_t fill, uint16_t track, uint16_t bg)
+{
+  _fill  = fill;
+  _track = track;
+  _bg    = bg;
+  invalidate();
+}
+
+
+/***************************************************************************************
+** Function name:           invalidate
+** Description:             Make the next draw() draw the whole scale
+***************************************************************************************/
+void TFT_eArcMeter::invalidate(void)
+{
+  _angle = -1;
+}
+
+
+/***************************************************************************************
+** Function name:           draw
+** Description:             Show value, drawing only what changed since the last one
+***************************************************************************************/
+void TFT_eArcMeter::draw(int32_t value)
+{
+  int16_t a = angleOf(value);
+
+  if (_angle < 0) {
+    section(0, a, _fill);
+    section(a, _sweep, _track);
+  }
+  else if (a > _angle) section(_angle, a, _fill);
+  else if (a < _angle) section(a, _angle, _track);
+
+  _angle = a;
+}
+
+
+/***************************************************************************************
+** Function name:           angleOf
+** Description:             Degrees from the start of the scale for a value
+***************************************************************************************/
+int16_t TFT_eArcMeter::angleOf(int32_t value)
+{
+  if (value <= _min) return 0;
+  if (value >= _max) return _sweep;
+  int32_t range = _max - _min;
+  return ((int64_t)(value - _min) * _sweep + range / 2) / range;
+}
+
+
+/***************************************************************************************
+** Function name:           section
+** Description:             Draw the scale from degree a0 up to before a1
+***************************************************************************************/
+void TFT_eArcMeter::section(int16_t a0, int16_t a1, uint16_t color)
+{
+  if (a1 <= a0) return;
+  _tft->drawSmoothArc(_x, _y, _r, _ir, _start + a0, _start + a1, color, _bg, false);
+}
@@ -0,0 +1,48 @@
+/***************************************************************************************
+// The following class draws a ring meter, an arc filled from the start of the scale up
+// to the value. It remembers the angle last drawn, so a new value only draws the section
+// between the two angles, in the fill colour when the value went up or the track colour
+// when it went down. The sections are cut at pixel centres and meet without a seam, the
+// inner and outer edges are anti-aliased against the background colour.
+***************************************************************************************/
+
+class TFT_eArcMeter {
+
+ public:
+
+  explicit TFT_eArcMeter(TFT_eSPI *tft);
+
+           // Ring centred on x,y between radius ir and r. The scale runs clockwise from
+           // startAngle for sweep degrees (0 at 12 o'clock, sweep up to 360)
+  void     setArc(int32_t x, int32_t y, int32_t r, int32_t ir, int16_t startAngle, uint16_t sweep);
+
+           // Values at the start and end of the scale, values outside are drawn at the ends
+  void     setRange(int32_t minValue, int32_t maxValue);
+
+           // Colour up to the value, of the rest of the scale and around the ring
+  void     setColors(uint16_t fill, uint16_t track, uint16_t bg);
+
+           // Show value, the first time the whole scale is drawn
+  void     draw(int32_t value);
+
+           // The screen no longer shows the meter, the next draw() draws the whole scale
+  void     invalidate(void);
+
+ private:
+
+  TFT_eSPI *_tft;
+
+  int32_t  _x, _y, _r, _ir;
+  int16_t  _start;
+  uint16_t _sweep;
+  int32_t  _min, _max;
+  uint16_t _fill, _track, _bg;
+
+  int16_t  _angle;             // Degrees from the start filled on the screen, -1 if unknown
+
+           // Degrees from the start of the scale for value
+  int16_t  angleOf(int32_t value);
+
+           // Draws the scale from degree a0 up to before a1
+  void     section(int16_t a0, int16_t a1, uint16_t color);
+};
@@ -0,0 +1,405 @@
+/**************************************************************************************
+// The following class keeps characters of a numbered font rasterised in RAM as runs of
+// set pixels and sends them without decoding the font. See DigitAtlas.h
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           TFT_eDigitAtlas
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eDigitAtlas::TFT_eDigitAtlas(TFT_eSPI *tft)
+{
+  _tft = tft;     // Pointer to tft class so we can call member functions
+
+  _glyph = nullptr;
+  _runs  = nullptr;
+  _count = 0;
+  _bytes = 0;
+
+  _font    = 1;
+  _size    = 1;
+  _height  = 0;
+  _left    = 0;
+  _created = false;
+}
+
+
+/***************************************************************************************
+** Function name:           ~TFT_eDigitAtlas
+** Description:             Class destructor
+***************************************************************************************/
+TFT_eDigitAtlas::~TFT_eDigitAtlas(void)
+{
+  deleteAtlas();
+}
+
+
+/***************************************************************************************
+** Function name:           createAtlas
+** Description:             Rasterise characters of a font into RAM
+***************************************************************************************/
+// Each character is drawn twice into a 1 bit Sprite the size of the widest cell, first
+// to find the box around its set pixels and add up the RAM, then to copy it once the RAM
+// is allocated. Nothing is kept on the stack per character
+bool TFT_eDigitAtlas::createAtlas(uint8_t font, uint8_t size, const char *chars)
+{
+  deleteAtlas();
+
+  // Characters missing from the atlas are drawn by the font in this size
+  _font = font;
+  _size = size < 1 ? 1 : size;
+
+  TFT_eSprite spr(_tft);
+  spr.setColorDepth(1);
+  spr.setTextFont(font);       // Not a free font
+  spr.setTextSize(_size);
+  spr.setTextColor(TFT_WHITE); // Transparent, set pixels are 1
+
+  int16_t cellW = 0;
+  uint8_t n = 0;
+  for (const char *p = chars; *p && n < 255; p++, n++) {
+    char s[2] = { *p, 0 };
+    int16_t w = spr.textWidth(s, font);
+    if (w > cellW) cellW = w;
+  }
+  _height = spr.fontHeight(font);
+  if (cellW < 1 || _height < 1) return false;
+
+  // A span font made from a free font may reach outside its cells, the Sprite is made
+  // wide enough for that
+  int16_t right = cellW;
+  _left = 0;
+  const tftSpanFont *sf = _tft->spanFont(font);
+  for (uint8_t i = 0; sf && i < n; i++) {
+    const tftSpanGlyph *sg = _tft->spanGlyph(sf, (uint8_t)chars[i]);
+    if (!sg || !pgm_read_byte(&sg->rows)) continue;
+    int16_t x0 = (int8_t)pgm_read_byte(&sg->xOffset) * _size;
+    int16_t x1 = x0 + pgm_read_byte(&sg->width) * _size;
+    if (-x0 > _left) _left = -x0;
+    if (x1 > right) right = x1;
+  }
+  cellW = _left + right;
+
+  if (!spr.createSprite(cellW, _height)) return false;
+  const uint8_t *img = (const uint8_t *)spr.getPointer();
+  uint16_t stride = (cellW + 7) >> 3; // 1 bit Sprite rows are whole bytes
+
+  // Count the characters the font has and the bytes of their run tables
+  daGlyph  box;
+  uint8_t  count = 0;
+  uint32_t bytes = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    if (!measure(&spr, chars, i, cellW, &box)) continue;
+    count++;
+    bytes += encodeRuns(img, stride, &box, nullptr);
+  }
+
+  if (count == 0 || bytes > 0xFFFF) { spr.deleteSprite(); return false; }
+
+  uint8_t *ram = (uint8_t *)malloc(count * sizeof(daGlyph) + bytes);
+  if (ram == nullptr) { spr.deleteSprite(); return false; }
+  _glyph = (daGlyph *)ram;
+  _runs  = ram + count * sizeof(daGlyph);
+
+  // Draw them again and make the run tables
+  uint8_t k = 0;
+  bytes = 0;
+  for (uint8_t i = 0; i < n && k < count; i++) {
+    daGlyph *g = &_glyph[k];
+    if (!measure(&spr, chars, i, cellW, g)) continue;
+    k++;
+    g->offset = bytes;
+    bytes += encodeRuns(img, stride, g, _runs + g->offset);
+  }
+
+  spr.deleteSprite();
+
+  _count   = count;
+  _bytes   = count * sizeof(daGlyph) + bytes;
+  _created = true;
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           measure
+** Description:             Draw a character into the Sprite and find its box
+***************************************************************************************/
+// Returns false if the font does not have chars[i] or it came earlier in chars
+bool TFT_eDigitAtlas::measure(TFT_eSprite *spr, const char *chars, uint8_t i, int16_t cellW, daGlyph *g)
+{
+  uint8_t c = chars[i];
+  for (uint8_t k = 0; k < i; k++) if ((uint8_t)chars[k] == c) return false;
+
+  spr->fillSprite(0);
+  int16_t advance = spr->drawChar(c, _left, 0, _font);
+  if (advance < 1) return false;
+
+  const uint8_t *img = (const uint8_t *)spr->getPointer();
+  uint16_t stride = (cellW + 7) >> 3;
+  int32_t x0 = cellW, y0 = _height, x1 = -1, y1 = -1;
+  for (int32_t y = 0; y < _height; y++) {
+    for (int32_t x = 0; x < cellW; x++) {
+      if (!(img[y * stride + (x >> 3)] & (0x80 >> (x & 7)))) continue;
+      if (x < x0) x0 = x;
+      if (x > x1) x1 = x;
+      if (y < y0) y0 = y;
+      y1 = y;
+    }
+  }
+
+  g->code    = c;
+  g->advance = advance;
+  g->offset  = 0;
+  if (x1 < 0) { g->x = g->y = g->w = g->h = 0; return true; } // Nothing set, e.g. space
+  g->x = x0 - _left;
+  g->y = y0;
+  g->w = x1 - x0 + 1;
+  g->h = y1 - y0 + 1;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           encodeRuns
+** Description:             Make the run table of a glyph box
+***************************************************************************************/
+uint16_t TFT_eDigitAtlas::encodeRuns(const uint8_t *img, uint16_t stride, const daGlyph *g, uint8_t *dst)
+{
+  uint16_t len = 0;
+  for (int32_t y = 0; y < g->h; y++) {
+    const uint8_t *src = img + (g->y + y) * stride;
+    int32_t x = 0, end = 0; // end of the last run
+    while (true) {
+      while (x < g->w && !(src[(_left + g->x + x) >> 3] & (0x80 >> ((_left + g->x + x) & 7)))) x++;
+      if (x == g->w) break;
+      int32_t s = x;
+      while (x < g->w && (src[(_left + g->x + x) >> 3] & (0x80 >> ((_left + g->x + x) & 7)))) x++;
+
+      int32_t skip = s - end, run = x - s;
+      for (; skip > 255; skip -= 255, len += 2) if (dst) { *dst++ = 255; *dst++ = 0; }
+      for (; run > 0; run -= 255, skip = 0, len += 2) {
+        if (dst) { *dst++ = skip; *dst++ = run > 255 ? 255 : run; }
+      }
+      end = x;
+    }
+    if (dst) { *dst++ = 0; *dst++ = 0; }
+    len += 2;
+  }
+  return len;
+}
+
+
+/***************************************************************************************
+** Function name:           created
+** Description:             Returns true if the atlas has been created
+***************************************************************************************/
+bool TFT_eDigitAtlas::created(void)
+{
+  return _created;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteAtlas
+** Description:             Free the RAM of the atlas
+***************************************************************************************/
+void TFT_eDigitAtlas::deleteAtlas(void)
+{
+  if (_glyph) free(_glyph);
+  _glyph = nullptr;
+  _runs  = nullptr;
+  _count = 0;
+  _bytes = 0;
+  _created = false;
+}
+
+
+/***************************************************************************************
+** Function name:           atlasBytes
+** Description:             RAM used by the atlas
+***************************************************************************************/
+uint32_t TFT_eDigitAtlas::atlasBytes(void)
+{
+  return _bytes;
+}
+
+
+/***************************************************************************************
+** Function name:           glyph
+** Description:             Find a character in the atlas
+***************************************************************************************/
+const TFT_eDigitAtlas::daGlyph *TFT_eDigitAtlas::glyph(uint16_t c)
+{
+  for (uint8_t i = 0; i < _count; i++) if (_glyph[i].code == c) return &_glyph[i];
+  return nullptr;
+}
+
+
+/***************************************************************************************
+** Function name:           drawChar
+** Description:             Draw a character from the atlas
+***************************************************************************************/
+int16_t TFT_eDigitAtlas::drawChar(uint16_t c, int32_t x, int32_t y)
+{
+  const daGlyph *g = glyph(c);
+  if (!g) {
+    uint8_t size = _tft->textsize;
+    _tft->textsize = _size;
+    int16_t w = _tft->drawChar(c, x, y, _font);
+    _tft->textsize = size;
+    return w;
+  }
+
+  if (_tft->_vpOoB) return g->advance;
+
+  uint16_t fg = _tft->textcolor, bg = _tft->textbgcolor;
+  if (fg == bg) drawRuns(g, x, y, fg);
+  else if (!pushGlyph(g, x, y)) {
+    // Partly outside the viewport, the TFT functions clip
+    _tft->fillRect(x, y, g->advance, _height, bg);
+    drawRuns(g, x, y, fg);
+  }
+
+  return g->advance;
+}
+
+
+/***************************************************************************************
+** Function name:           drawString
+** Description:             Draw a string from the atlas
+***************************************************************************************/
+int16_t TFT_eDigitAtlas::drawString(const char *string, int32_t x, int32_t y)
+{
+  int32_t x0 = x;
+  while (*string) x += drawChar((uint8_t)*string++, x, y);
+  return x - x0;
+}
+
+int16_t TFT_eDigitAtlas::drawString(const String& string, int32_t x, int32_t y)
+{
+  return drawString(string.c_str(), x, y);
+}
+
+
+/***************************************************************************************
+** Function name:           textWidth, fontHeight
+** Description:             Size of text drawn from the atlas
+***************************************************************************************/
+int16_t TFT_eDigitAtlas::textWidth(const char *string)
+{
+  int16_t w = 0;
+  while (*string) {
+    uint8_t c = *string++;
+    const daGlyph *g = glyph(c);
+    if (g) { w += g->advance; continue; }
+
+    char s[2] = { (char)c, 0 };
+    uint8_t size = _tft->textsize;
+    _tft->textsize = _size;
+    w += _tft->textWidth(s, _font);
+    _tft->textsize = size;
+  }
+  return w;
+}
+
+int16_t TFT_eDigitAtlas::fontHeight(void)
+{
+  return _height;
+}
+
+
+/***************************************************************************************
+** Function name:           pushGlyph
+** Description:             Send an opaque character cell through one window
+***************************************************************************************/
+// The rows above and below the box are one block of background each, the rows of the box
+// are built a few at a time in a buffer, background and text colour in turn from the runs
+bool TFT_eDigitAtlas::pushGlyph(const daGlyph *g, int32_t x, int32_t y)
+{
+  int32_t w = g->advance;
+  int32_t h = _height;
+  if (w < 1 || w > TFT_SPAN_PIXELS) return false;
+
+  // Set pixels outside the cell, e.g. of a free font in a span font slot, would not fit
+  // in the row
+  if (g->x < 0 || g->x + g->w > w) return false;
+
+  int32_t xd = x + _tft->_xDatum;
+  int32_t yd = y + _tft->_yDatum;
+  if (xd < _tft->_vpX || yd < _tft->_vpY || xd + w > _tft->_vpW || yd + h > _tft->_vpH) return false;
+
+  // pushPixels() sends the buffer as it is in RAM unless bytes are swapped
+  uint16_t fg = _tft->textcolor, bg = _tft->textbgcolor;
+  if (!_tft->_swapBytes) { fg = fg >> 8 | fg << 8; bg = bg >> 8 | bg << 8; }
+
+  uint16_t buf[TFT_SPAN_PIXELS];
+  int32_t  lines = TFT_SPAN_PIXELS / w, filled = 0;
+  const uint8_t *r = _runs + g->offset;
+
+  _tft->begin_tft_write();
+  _tft->setWindow(xd, yd, xd + w - 1, yd + h - 1);
+
+  if (g->y) _tft->pushBlock(_tft->textbgcolor, g->y * w);
+
+  for (int32_t j = 0; j < g->h; j++) {
+    uint16_t *px = buf + filled * w;
+    uint16_t *end = px + w;
+    for (int32_t i = 0; i < g->x; i++) *px++ = bg;
+
+    while (true) {
+      int32_t skip = *r++, run = *r++;
+      if (!skip && !run) break;
+      while (skip--) *px++ = bg;
+      while (run--)  *px++ = fg;
+    }
+
+    while (px < end) *px++ = bg;
+
+    if (++filled == lines || j == g->h - 1) {
+      _tft->pushPixels(buf, filled * w);
+      filled = 0;
+    }
+  }
+
+  int32_t below = h - g->y - g->h;
+  if (below > 0) _tft->pushBlock(_tft->textbgcolor, below * w);
+
+  _tft->end_tft_write();
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           drawRuns
+** Description:             Draw the set pixels of a glyph as lines
+***************************************************************************************/
+void TFT_eDigitAtlas::drawRuns(const daGlyph *g, int32_t x, int32_t y, uint16_t color)
+{
+  const uint8_t *r = _runs + g->offset;
+
+  _tft->begin_tft_write();
+  _tft->inTransaction = true;
+
+  x += g->x;
+  y += g->y;
+  for (int32_t j = 0; j < g->h; j++) {
+    int32_t i = 0;
+    while (true) {
+      int32_t skip = *r++, run = *r++;
+      if (!run) {
+        if (!skip) break; // End of the row
+        i += skip;
+        continue;
+      }
+      i += skip;
+      while (!r[0] && r[1]) { run += r[1]; r += 2; } // Longer than 255
+      _tft->drawFastHLine(x + i, y + j, run, color);
+      i += run;
+    }
+  }
+
+  _tft->inTransaction = _tft->lockTransaction;
+  _tft->end_tft_write();
+}
@@ -0,0 +1,85 @@
+/***************************************************************************************
+// The following class keeps a few characters of a numbered font, normally the digits,
+// rasterised in RAM for numeric fields that are redrawn every update in a big font.
+// createAtlas() draws each character once into a 1 bit Sprite and keeps the box around
+// its set pixels as a table of the runs of set pixels on each row, about 280 bytes for a
+// Font 8 digit. An opaque character is then sent through one window with no font
+// decoding, its rows built from the runs in the text colours. The rows and columns
+// outside the box are background. Transparent characters are drawn as one line per run.
+***************************************************************************************/
+
+class TFT_eDigitAtlas {
+
+ public:
+
+           // Draws on the TFT, tft must not be a Sprite
+  explicit TFT_eDigitAtlas(TFT_eSPI *tft);
+  ~TFT_eDigitAtlas(void);
+
+           // Rasterise the characters of font at text size into RAM. Characters the font
+           // does not have are left out. Returns false if out of RAM or none are in the font
+  bool     createAtlas(uint8_t font, uint8_t size = 1, const char *chars = "0123456789.:");
+
+           // Returns true if the atlas has been created
+  bool     created(void);
+
+           // Delete the atlas to free up the RAM
+  void     deleteAtlas(void);
+
+           // RAM used by the atlas in bytes
+  uint32_t atlasBytes(void);
+
+           // Character or string with its top left corner at x,y in the TFT text colours,
+           // opaque if the background colour differs. Characters not in the atlas are drawn
+           // by the font. Returns the width in pixels
+  int16_t  drawChar(uint16_t c, int32_t x, int32_t y),
+           drawString(const char *string, int32_t x, int32_t y),
+           drawString(const String& string, int32_t x, int32_t y);
+
+           // Width of a string and height of the font at the atlas text size
+  int16_t  textWidth(const char *string);
+  int16_t  fontHeight(void);
+
+ private:
+
+  // Box of set pixels in a character cell, x is negative if the glyph reaches left of its
+  // cell. The runs of each row of the box are at offset in _runs as (skip, length) byte
+  // pairs, skip counted from the end of the last run, and (0, 0) ends the row. (255, 0)
+  // skips 255 and a run longer than 255 goes on with (0, n)
+  typedef struct {
+    uint16_t offset;
+    uint16_t code;
+    uint16_t advance;
+    int16_t  x;
+    uint16_t y, w, h;
+  } daGlyph;
+
+  TFT_eSPI *_tft;
+
+  daGlyph  *_glyph;
+  uint8_t  *_runs;
+  uint8_t   _count;
+  uint32_t  _bytes;
+
+  uint8_t   _font, _size;
+  uint16_t  _height;
+  int16_t   _left;             // Sprite columns left of the cell while it is created
+  bool      _created;
+
+           // Glyph of c in the atlas, nullptr if it is not there
+  const daGlyph *glyph(uint16_t c);
+
+           // Draw chars[i] into spr and set g to its box, false if the font does not have it
+           // or it is in chars before
+  bool     measure(TFT_eSprite *spr, const char *chars, uint8_t i, int16_t cellW, daGlyph *g);
+
+           // Write the run table of the box g of the character drawn in img, a Sprite with rows
+           // of stride bytes, to dst if not nullptr. Returns its length in bytes
+  uint16_t encodeRuns(const uint8_t *img, uint16_t stride, const daGlyph *g, uint8_t *dst);
+
+           // Opaque glyph through one window, false if the cell is not all inside the viewport
+  bool     pushGlyph(const daGlyph *g, int32_t x, int32_t y);
+
+           // One line per run of set pixels, from the run table
+  void     drawRuns(const daGlyph *g, int32_t x, int32_t y, uint16_t color);
+};
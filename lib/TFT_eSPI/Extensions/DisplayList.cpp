@@ -0,0 +1,680 @@
+/**************************************************************************************
+// The following class records draw calls in a RAM command list and replays them with
+// covered commands dropped, fills joined and commands unchanged since the last frame
+// skipped. See DisplayList.h
+***************************************************************************************/
+
+// Command types
+#define DL_FILL   0
+#define DL_LINE   1
+#define DL_TEXT   2
+#define DL_IMAGE  3
+
+// Command flags
+#define DL_OPAQUE 0x01 // Every pixel of the bounding box is written
+#define DL_DEAD   0x02 // Dropped by coalesce()
+#define DL_DRAWN  0x04 // Sent by the current flush()
+#define DL_CHANGED 0x08 // Differs from the command at the same place last frame
+#define DL_STALE  0x10 // Last frame's command that is not the same this frame
+#define DL_ERASE  0x20 // Stale and not painted over, cleared to the background
+
+// Bounding box tests, boxes are never empty
+#define DL_OVERLAP(a, b)  ((a)->x < (b)->x + (b)->w && (b)->x < (a)->x + (a)->w && \
+                           (a)->y < (b)->y + (b)->h && (b)->y < (a)->y + (a)->h)
+#define DL_CONTAINS(a, b) ((a)->x <= (b)->x && (a)->x + (a)->w >= (b)->x + (b)->w && \
+                           (a)->y <= (b)->y && (a)->y + (a)->h >= (b)->y + (b)->h)
+
+/***************************************************************************************
+** Function name:           TFT_eDisplayList
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eDisplayList::TFT_eDisplayList(TFT_eSPI *tft)
+{
+  _tft = tft;     // Pointer to tft class so we can call member functions
+
+  _cmd  = _prevCmd  = nullptr;
+  _text = _prevText = nullptr;
+  _count = _prevCount = 0;
+  _textUsed = 0;
+  _maxCmds  = _maxText = 0;
+
+  _bg          = TFT_BLACK;
+  _textColor   = TFT_WHITE;
+  _textBgColor = TFT_WHITE;
+  _textSize    = 1;
+
+  _created  = false;
+  _valid    = false;
+  _overflow = false;
+  _clear    = false;
+  _spill.w  = _prevSpill.w = 0;
+
+  _recorded = _sent = 0;
+  _lastRecorded = _lastSent = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           ~TFT_eDisplayList
+** Description:             Class destructor
+***************************************************************************************/
+TFT_eDisplayList::~TFT_eDisplayList(void)
+{
+  deleteList();
+}
+
+
+/***************************************************************************************
+** Function name:           createList
+** Description:             Reserve RAM for two frames of commands and text
+***************************************************************************************/
+bool TFT_eDisplayList::createList(uint16_t cmds, uint16_t textBytes, uint16_t bgColor)
+{
+  if (_created) return true;
+
+  if (cmds < 1) return false;
+
+  uint32_t cmdBytes = (uint32_t)cmds * sizeof(dlCommand);
+  uint8_t *ram = (uint8_t *)malloc(2 * (cmdBytes + textBytes));
+  if (ram == nullptr) return false;
+
+  _cmd      = (dlCommand *)ram;
+  _prevCmd  = (dlCommand *)(ram + cmdBytes);
+  _text     = (char *)(ram + 2 * cmdBytes);
+  _prevText = _text + textBytes;
+
+  _maxCmds = cmds;
+  _maxText = textBytes;
+  _bg      = bgColor;
+  _created = true;
+
+  _count = _prevCount = 0;
+  _textUsed = 0;
+  _overflow = false;
+  invalidate();
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           created
+** Description:             Returns true if the list has been created
+***************************************************************************************/
+bool TFT_eDisplayList::created(void)
+{
+  return _created;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteList
+** Description:             Delete the list to free up memory (RAM)
+***************************************************************************************/
+void TFT_eDisplayList::deleteList(void)
+{
+  if (!_created) return;
+
+  // _cmd may be either half after flushes, the block starts at the lower one
+  free(_cmd < _prevCmd ? (void *)_cmd : (void *)_prevCmd);
+
+  _cmd  = _prevCmd  = nullptr;
+  _text = _prevText = nullptr;
+  _created = false;
+}
+
+
+/***************************************************************************************
+** Function name:           invalidate
+** Description:             Make the next flush() draw every command
+***************************************************************************************/
+void TFT_eDisplayList::invalidate(void)
+{
+  _valid = false;
+  _clear = false;
+  _prevCount = 0;
+  _prevSpill.w = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           recorded, sent
+** Description:             Statistics of the last flush()
+***************************************************************************************/
+uint16_t TFT_eDisplayList::recorded(void)
+{
+  return _lastRecorded;
+}
+
+uint16_t TFT_eDisplayList::sent(void)
+{
+  return _lastSent;
+}
+
+
+/***************************************************************************************
+** Function name:           record
+** Description:             Add a command to this frame
+***************************************************************************************/
+void TFT_eDisplayList::record(dlCommand *c, const char *text)
+{
+  if (!_created || c->w < 1 || c->h < 1) return;
+
+  _recorded++;
+
+  uint16_t len = text ? strlen(text) : 0;
+
+  if (!_overflow && (_count >= _maxCmds || (text && _textUsed + len + 1 > _maxText))) startOverflow();
+
+  if (_overflow) {
+    if (c->type == DL_TEXT) c->text.offset = 0; // Drawn straight from the caller's string
+
+    // Grow the spill box, it is cleared before the next frame
+    if (!_spill.w) { _spill.x = c->x; _spill.y = c->y; _spill.w = c->w; _spill.h = c->h; }
+    else {
+      int32_t x1 = _spill.x + _spill.w, y1 = _spill.y + _spill.h;
+      if (c->x + c->w > x1) x1 = c->x + c->w;
+      if (c->y + c->h > y1) y1 = c->y + c->h;
+      if (c->x < _spill.x) _spill.x = c->x;
+      if (c->y < _spill.y) _spill.y = c->y;
+      _spill.w = x1 - _spill.x;
+      _spill.h = y1 - _spill.y;
+    }
+
+    _tft->startWrite();
+    draw(_tft, c, text);
+    _tft->endWrite();
+    _sent++;
+    return;
+  }
+
+  if (text) {
+    c->text.offset = _textUsed;
+    c->text.len    = len;
+    memcpy(_text + _textUsed, text, len + 1);
+    _textUsed += len + 1;
+  }
+
+  _cmd[_count++] = *c;
+}
+
+
+/***************************************************************************************
+** Function name:           startOverflow
+** Description:             Give up on this frame's list, draw everything directly
+***************************************************************************************/
+// The list is too small for the screen. Last frame is cleared from the boxes it drew in,
+// the rest of this one is drawn as it comes and cleared again before the next frame.
+// What was drawn on the TFT directly, outside the list, is left alone.
+void TFT_eDisplayList::startOverflow(void)
+{
+  _overflow = true;
+  _spill.w = 0;
+
+  _tft->startWrite();
+  clearLastFrame();
+  for (uint16_t i = 0; i < _count; i++) draw(_tft, _cmd + i, _text);
+  _tft->endWrite();
+
+  _sent += _count;
+}
+
+
+/***************************************************************************************
+** Function name:           clearLastFrame
+** Description:             Clear what the last frame drew to the background
+***************************************************************************************/
+void TFT_eDisplayList::clearLastFrame(void)
+{
+  if (_valid) {
+    for (uint16_t i = 0; i < _prevCount; i++) {
+      dlCommand *p = _prevCmd + i;
+      _tft->fillRect(p->x, p->y, p->w, p->h, _bg);
+    }
+  }
+  if (_prevSpill.w) _tft->fillRect(_prevSpill.x, _prevSpill.y, _prevSpill.w, _prevSpill.h, _bg);
+}
+
+
+/***************************************************************************************
+** Function name:           fillRect, drawFastHLine, drawFastVLine, drawRect
+** Description:             Record solid fills
+***************************************************************************************/
+void TFT_eDisplayList::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color)
+{
+  dlCommand c;
+  c.type  = DL_FILL;
+  c.flags = DL_OPAQUE;
+  c.x = x; c.y = y; c.w = w; c.h = h;
+  c.color = color;
+  record(&c);
+}
+
+void TFT_eDisplayList::drawFastHLine(int32_t x, int32_t y, int32_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
+
+void TFT_eDisplayList::drawFastVLine(int32_t x, int32_t y, int32_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void TFT_eDisplayList::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+  fillRect(x, y + h - 1, w, 1, color);
+  // Avoid drawing corner pixels twice
+  fillRect(x, y + 1, 1, h - 2, color);
+  fillRect(x + w - 1, y + 1, 1, h - 2, color);
+}
+
+
+/***************************************************************************************
+** Function name:           drawLine
+** Description:             Record a line, its bounding box is used for overlap tests
+***************************************************************************************/
+void TFT_eDisplayList::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color)
+{
+  dlCommand c;
+  c.type  = DL_LINE;
+  c.flags = 0;
+  c.x = x0 < x1 ? x0 : x1;
+  c.y = y0 < y1 ? y0 : y1;
+  c.w = abs(x1 - x0) + 1;
+  c.h = abs(y1 - y0) + 1;
+  c.color = color;
+  c.line.x0 = x0; c.line.y0 = y0;
+  c.line.x1 = x1; c.line.y1 = y1;
+  record(&c);
+}
+
+
+/***************************************************************************************
+** Function name:           pushImage
+** Description:             Record an image held in memory that does not change
+***************************************************************************************/
+void TFT_eDisplayList::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+  dlCommand c;
+  c.type  = DL_IMAGE;
+  c.flags = DL_OPAQUE;
+  c.x = x; c.y = y; c.w = w; c.h = h;
+  c.image = data;
+  record(&c);
+}
+
+
+/***************************************************************************************
+** Function name:           setTextColor, setTextSize
+** Description:             Text attributes for the following drawString() calls
+***************************************************************************************/
+void TFT_eDisplayList::setTextColor(uint16_t color)
+{
+  _textColor = _textBgColor = color; // Same colours mean a transparent background
+}
+
+void TFT_eDisplayList::setTextColor(uint16_t color, uint16_t bgcolor)
+{
+  _textColor   = color;
+  _textBgColor = bgcolor;
+}
+
+void TFT_eDisplayList::setTextSize(uint8_t size)
+{
+  _textSize = size ? size : 1;
+}
+
+
+/***************************************************************************************
+** Function name:           drawString
+** Description:             Record text with its top left corner at x,y
+***************************************************************************************/
+int16_t TFT_eDisplayList::drawString(const char *string, int32_t x, int32_t y, uint8_t font)
+{
+  // The TFT_eSPI measurements scale with the TFT's current text size
+  uint8_t size = _tft->textsize;
+  _tft->textsize = _textSize;
+  int16_t w = _tft->textWidth(string, font);
+  int16_t h = _tft->fontHeight(font);
+  _tft->textsize = size;
+
+  dlCommand c;
+  c.type  = DL_TEXT;
+  // Numbered fonts fill the whole character cell when the background is drawn
+  c.flags = _textColor != _textBgColor ? DL_OPAQUE : 0;
+  c.font  = font;
+  c.size  = _textSize;
+  c.x = x; c.y = y; c.w = w; c.h = h;
+  c.color = _textColor;
+  c.bg    = _textBgColor;
+  record(&c, string);
+
+  return w;
+}
+
+int16_t TFT_eDisplayList::drawString(const String& string, int32_t x, int32_t y, uint8_t font)
+{
+  return drawString(string.c_str(), x, y, font);
+}
+
+
+/***************************************************************************************
+** Function name:           same
+** Description:             Returns true if two commands draw exactly the same pixels
+***************************************************************************************/
+bool TFT_eDisplayList::same(const dlCommand *a, const char *aPool, const dlCommand *b, const char *bPool)
+{
+  if (a->type != b->type || a->x != b->x || a->y != b->y || a->w != b->w || a->h != b->h ||
+      a->color != b->color) return false;
+
+  switch (a->type) {
+    case DL_LINE:
+      return a->line.x0 == b->line.x0 && a->line.y0 == b->line.y0 &&
+             a->line.x1 == b->line.x1 && a->line.y1 == b->line.y1;
+    case DL_TEXT:
+      return a->bg == b->bg && a->font == b->font && a->size == b->size && a->text.len == b->text.len &&
+             !memcmp(aPool + a->text.offset, bPool + b->text.offset, a->text.len);
+    case DL_IMAGE:
+      return a->image == b->image;
+  }
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           draw
+** Description:             Send one command to the TFT or a tile, pool holds its text
+***************************************************************************************/
+void TFT_eDisplayList::draw(TFT_eSPI *dst, const dlCommand *c, const char *pool)
+{
+  switch (c->type) {
+    case DL_FILL:
+      dst->fillRect(c->x, c->y, c->w, c->h, c->color);
+      break;
+    case DL_LINE:
+      dst->drawLine(c->line.x0, c->line.y0, c->line.x1, c->line.y1, c->color);
+      break;
+    case DL_TEXT:
+      dst->setTextColor(c->color, c->bg);
+      dst->setTextSize(c->size);
+      dst->setTextDatum(TL_DATUM);
+      dst->drawString(pool + c->text.offset, c->x, c->y, c->font);
+      break;
+    case DL_IMAGE:
+      // pushImage() is not virtual, anything but the TFT is a tile Sprite
+      if (dst == _tft) _tft->pushImage(c->x, c->y, c->w, c->h, c->image);
+      else ((TFT_eSprite *)dst)->pushImage(c->x, c->y, c->w, c->h, c->image);
+      break;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           coalesce
+** Description:             Drop covered commands and join fills
+***************************************************************************************/
+void TFT_eDisplayList::coalesce(void)
+{
+  // A command is not visible if a later opaque one covers its whole bounding box,
+  // whatever was drawn in between
+  for (uint16_t i = 0; i < _count; i++) {
+    for (uint16_t j = i + 1; j < _count; j++) {
+      if ((_cmd[j].flags & DL_OPAQUE) && DL_CONTAINS(_cmd + j, _cmd + i)) {
+        _cmd[i].flags |= DL_DEAD;
+        break;
+      }
+    }
+  }
+
+  // Join fill j into an earlier fill i of the same colour when together they are a
+  // rectangle. j is then drawn earlier, so nothing in between may overlap it.
+  for (uint16_t i = 0; i < _count; i++) {
+    dlCommand *a = _cmd + i;
+    if (a->type != DL_FILL || (a->flags & DL_DEAD)) continue;
+
+    for (uint16_t j = i + 1; j < _count; j++) {
+      dlCommand *b = _cmd + j;
+      if (b->flags & DL_DEAD) continue;
+
+      bool join = false;
+      if (b->type == DL_FILL && b->color == a->color) {
+        if (b->y == a->y && b->h == a->h) join = b->x <= a->x + a->w && a->x <= b->x + b->w;
+        else if (b->x == a->x && b->w == a->w) join = b->y <= a->y + a->h && a->y <= b->y + b->h;
+      }
+
+      if (join) {
+        for (uint16_t k = i + 1; k < j; k++) {
+          if (!(_cmd[k].flags & DL_DEAD) && DL_OVERLAP(_cmd + k, b)) { join = false; break; }
+        }
+      }
+
+      if (!join) continue;
+
+      int16_t x1 = max(a->x + a->w, b->x + b->w);
+      int16_t y1 = max(a->y + a->h, b->y + b->h);
+      a->x = min(a->x, b->x);
+      a->y = min(a->y, b->y);
+      a->w = x1 - a->x;
+      a->h = y1 - a->y;
+      b->flags |= DL_DEAD;
+      j = i; // The bigger fill may now join ones already passed over
+    }
+  }
+
+  // Remove the dropped commands, the text pool is left as it is
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < _count; i++) {
+    if (!(_cmd[i].flags & DL_DEAD)) _cmd[n++] = _cmd[i];
+  }
+  _count = n;
+}
+
+
+/***************************************************************************************
+** Function name:           markChanges
+** Description:             Compare this frame with the last one
+***************************************************************************************/
+// Sets DL_CHANGED on new commands that differ from the one at the same place last frame,
+// DL_STALE on old ones that differ and DL_ERASE on stale ones nothing new paints over.
+// Returns false if nothing changed.
+bool TFT_eDisplayList::markChanges(void)
+{
+  bool changed = !_valid || _clear || _count != _prevCount;
+
+  for (uint16_t i = 0; i < _prevCount; i++) {
+    dlCommand *p = _prevCmd + i;
+    p->flags &= ~(DL_STALE | DL_ERASE);
+    // After an overflow the spill may have drawn over it, so nothing old is kept
+    if (!_clear && i < _count && same(_cmd + i, _text, p, _prevText)) continue;
+    p->flags |= DL_STALE;
+    changed = true;
+    if (i < _count && (_cmd[i].flags & DL_OPAQUE) && DL_CONTAINS(_cmd + i, p)) continue;
+    p->flags |= DL_ERASE;
+  }
+
+  for (uint16_t j = 0; j < _count; j++) {
+    if (!_valid || _clear || j >= _prevCount || (_prevCmd[j].flags & DL_STALE)) _cmd[j].flags |= DL_CHANGED;
+  }
+
+  return changed;
+}
+
+
+/***************************************************************************************
+** Function name:           flush
+** Description:             Draw what changed since the last frame
+***************************************************************************************/
+void TFT_eDisplayList::flush(void)
+{
+  if (!_created) return;
+
+  if (_overflow) {
+    endFrame();
+    return;
+  }
+
+  coalesce();
+
+  if (markChanges()) {
+    uint32_t color   = _tft->textcolor;
+    uint32_t bgcolor = _tft->textbgcolor;
+    uint8_t  size    = _tft->textsize;
+    uint8_t  datum   = _tft->textdatum;
+
+    _tft->startWrite();
+
+    if (_prevSpill.w) _tft->fillRect(_prevSpill.x, _prevSpill.y, _prevSpill.w, _prevSpill.h, _bg);
+
+    // Old content is cleared unless the new command at the same place paints over all of it
+    for (uint16_t i = 0; i < _prevCount; i++) {
+      dlCommand *p = _prevCmd + i;
+      if (p->flags & DL_ERASE) _tft->fillRect(p->x, p->y, p->w, p->h, _bg);
+    }
+
+    // A command is drawn if it changed, if its area was cleared, or if an earlier command
+    // drawn this time overlaps it and would otherwise be left on top
+    for (uint16_t j = 0; j < _count; j++) {
+      dlCommand *c = _cmd + j;
+      bool drawIt = c->flags & DL_CHANGED;
+
+      for (uint16_t i = 0; !drawIt && i < _prevCount; i++) {
+        drawIt = (_prevCmd[i].flags & DL_ERASE) && DL_OVERLAP(_prevCmd + i, c);
+      }
+      for (uint16_t k = 0; !drawIt && k < j; k++) {
+        drawIt = (_cmd[k].flags & DL_DRAWN) && DL_OVERLAP(_cmd + k, c);
+      }
+
+      if (drawIt) {
+        c->flags |= DL_DRAWN;
+        draw(_tft, c, _text);
+        _sent++;
+      }
+    }
+
+    _tft->endWrite();
+
+    _tft->setTextColor(color, bgcolor);
+    _tft->setTextSize(size);
+    _tft->setTextDatum(datum);
+  }
+
+  endFrame();
+}
+
+
+/***************************************************************************************
+** Function name:           flush
+** Description:             Compose the changed part of the screen in tiles
+***************************************************************************************/
+// Every tile that a changed command touches, now or last frame, is cleared to the
+// background in the Sprite, all commands overlapping it are drawn there in order and
+// the finished tile is pushed. Each pixel crosses the bus once and overlapping
+// commands never show half drawn. The Sprite size sets the tile size, e.g. 64 x 32
+// at 16 bits is 4 kbytes. Partial tiles at the screen edge are clipped by pushSprite().
+// With the STM32 DMA queue a 16 bit tile is queued instead, and in a Sprite with 2
+// frames the next tile is drawn in one while DMA sends the other.
+void TFT_eDisplayList::flush(TFT_eSprite *tile)
+{
+  if (!_created) return;
+
+  if (_overflow || !tile->created()) {
+    endFrame();
+    return;
+  }
+
+  coalesce();
+
+  if (markChanges()) {
+    int32_t tw = tile->width();
+    int32_t th = tile->height();
+    bool all = !_valid;
+
+#ifdef STM32_DMA_QUEUE
+    bool      dma = _tft->DMA_Enabled && tile->getColorDepth() == 16;
+    uint16_t* frame[2] = { (uint16_t*)tile->frameBuffer(1), (uint16_t*)tile->frameBuffer(2) };
+    uint32_t  fence[2] = { 0, 0 }; // Queued commands when each frame was last queued
+    uint8_t   f = 0;
+#endif
+
+    _tft->startWrite();
+
+    for (int32_t ty = 0; ty < _tft->height(); ty += th) {
+      for (int32_t tx = 0; tx < _tft->width(); tx += tw) {
+        dlCommand area;
+        area.x = tx; area.y = ty; area.w = tw; area.h = th;
+
+        bool dirty = all || (_prevSpill.w && DL_OVERLAP(&_prevSpill, &area));
+        for (uint16_t i = 0; !dirty && i < _prevCount; i++) {
+          dirty = (_prevCmd[i].flags & DL_STALE) && DL_OVERLAP(_prevCmd + i, &area);
+        }
+        for (uint16_t j = 0; !dirty && j < _count; j++) {
+          dirty = (_cmd[j].flags & DL_CHANGED) && DL_OVERLAP(_cmd + j, &area);
+        }
+        if (!dirty) continue;
+
+#ifdef STM32_DMA_QUEUE
+        if (dma) {
+          tile->frameBuffer(f + 1);
+          _tft->fenceWait(fence[f]); // Still being sent
+        }
+#endif
+
+        tile->resetViewport();
+        tile->fillSprite(_bg);
+        // Screen coordinates map to the tile, drawing outside it is clipped
+        tile->setViewport(-tx, -ty, tx + tw, ty + th, true);
+
+        for (uint16_t j = 0; j < _count; j++) {
+          if (DL_OVERLAP(_cmd + j, &area)) draw(tile, _cmd + j, _text);
+        }
+
+#ifdef STM32_DMA_QUEUE
+        if (dma) {
+          _tft->queueImage(tx, ty, tw, th, frame[f]);
+          fence[f] = _tft->queueFence();
+          if (frame[1] != frame[0]) f ^= 1;
+        }
+        else
+#endif
+        tile->pushSprite(tx, ty);
+        _sent++;
+      }
+    }
+
+    _tft->endWrite();
+    tile->resetViewport();
+#ifdef STM32_DMA_QUEUE
+    tile->frameBuffer(1);
+#endif
+  }
+
+  endFrame();
+}
+
+
+/***************************************************************************************
+** Function name:           endFrame
+** Description:             Make this frame the one on screen, start recording the next
+***************************************************************************************/
+void TFT_eDisplayList::endFrame(void)
+{
+  // After an overflow everything was drawn as it was recorded. The commands that fitted
+  // in the list and the spill box are what the next frame clears
+  for (uint16_t i = 0; i < _count; i++) _cmd[i].flags &= ~(DL_DRAWN | DL_CHANGED);
+  dlCommand *cmd = _cmd;  _cmd  = _prevCmd;  _prevCmd  = cmd;
+  char     *text = _text; _text = _prevText; _prevText = text;
+  _prevCount = _count;
+  _valid = true;
+  _clear = _overflow;
+  _prevSpill = _spill;
+  _spill.w = 0;
+  _overflow = false;
+
+  _lastRecorded = _recorded;
+  _lastSent     = _sent;
+  _recorded = _sent = 0;
+
+  _count = 0;
+  _textUsed = 0;
+}
@@ -0,0 +1,125 @@
+/***************************************************************************************
+// The following class records draw calls in a RAM command list instead of sending them
+// to the TFT. flush() coalesces the list and replays it in one transaction:
+//  - commands completely covered by a later opaque command are dropped
+//  - fills of one colour that share an edge or overlap in line are joined
+//  - commands identical to the last flush, at the same place in the list and not
+//    touched by anything that changed, are not sent at all
+// A screen rebuilt every update from mostly the same labels then costs only the pixels
+// that changed. Everything drawn through the list sits on a plain background of the
+// colour given to createList(), so the whole screen must be recorded every frame and
+// invalidate() called after the TFT was drawn on directly, e.g. cleared by fillScreen().
+// flush(&sprite) composes the changed areas in a small Sprite tile by tile instead, for
+// overlapping widgets without flicker when a full screen buffer does not fit in RAM.
+***************************************************************************************/
+
+class TFT_eDisplayList {
+
+ public:
+
+  explicit TFT_eDisplayList(TFT_eSPI *tft);
+  ~TFT_eDisplayList(void);
+
+           // Reserve RAM for up to cmds commands and textBytes of string characters per frame.
+           // Two frames are kept: 2 x (cmds x 24 + textBytes) bytes. Returns false if out of RAM
+  bool     createList(uint16_t cmds, uint16_t textBytes, uint16_t bgColor = TFT_BLACK);
+
+           // Returns true if the list has been created
+  bool     created(void);
+
+           // Delete the list to free up the RAM
+  void     deleteList(void);
+
+           // Record draw calls, nothing is sent to the TFT until flush()
+  void     fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color),
+           drawFastHLine(int32_t x, int32_t y, int32_t w, uint16_t color),
+           drawFastVLine(int32_t x, int32_t y, int32_t h, uint16_t color),
+           drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color),
+           drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color),
+           // The image is compared by address only, so it must not change while recorded
+           pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+
+           // Text colours and size for drawString(), the same as the TFT_eSPI functions
+  void     setTextColor(uint16_t color),
+           setTextColor(uint16_t color, uint16_t bgcolor),
+           setTextSize(uint8_t size);
+
+           // Text in a numbered font with its top left corner at x,y. Returns the width in
+           // pixels so the next piece of text can follow on the right
+  int16_t  drawString(const char *string, int32_t x, int32_t y, uint8_t font),
+           drawString(const String& string, int32_t x, int32_t y, uint8_t font);
+
+           // Coalesce and draw the recorded commands, then start recording the next frame
+  void     flush(void);
+
+           // As flush() but the changed tiles of the screen are composed in the Sprite and
+           // pushed whole, so overlapping commands do not flicker. The Sprite size is the tile
+           // size, e.g. 64 x 32. On STM32F1 after initDMA() 16 bit tiles are sent by the DMA
+           // queue, a Sprite created with 2 frames draws the next tile while the last is sent
+  void     flush(TFT_eSprite *tile);
+
+           // The screen no longer shows the last frame, the next flush() draws everything
+  void     invalidate(void);
+
+           // Commands recorded, and commands or tiles sent to the TFT by the last flush()
+  uint16_t recorded(void),
+           sent(void);
+
+ private:
+
+  typedef struct {
+    uint8_t  type;           // DL_FILL, DL_LINE, DL_TEXT or DL_IMAGE
+    uint8_t  flags;          // DL_OPAQUE, DL_DEAD etc.
+    uint8_t  font, size;     // DL_TEXT only
+    int16_t  x, y, w, h;     // Bounding box, for DL_FILL the rectangle itself
+    uint16_t color, bg;
+    union {
+      struct { int16_t x0, y0, x1, y1; } line;
+      struct { uint16_t offset, len; } text; // Characters in the text pool, 0 terminated
+      const uint16_t *image;
+    };
+  } dlCommand;
+
+  TFT_eSPI *_tft;
+
+  dlCommand *_cmd, *_prevCmd;   // This frame and the last one flushed
+  char     *_text, *_prevText;
+  uint16_t _count, _prevCount;
+  uint16_t _textUsed;
+  uint16_t _maxCmds, _maxText;
+
+  uint16_t _bg;                 // Screen background, old content is cleared to this
+  uint16_t _textColor, _textBgColor;
+  uint8_t  _textSize;
+
+  bool     _created;
+  bool     _valid;              // The screen shows _prevCmd
+  bool     _overflow;           // The list ran out of room, this frame is drawn directly
+  bool     _clear;              // Last frame overflowed, clear what it drew before the next
+  tftRect  _spill, _prevSpill;  // Box around the commands drawn directly after an overflow
+
+  uint16_t _recorded, _sent;         // This frame so far
+  uint16_t _lastRecorded, _lastSent; // Last flush()
+
+           // Adds a command to the list, text is copied to the pool. Draws it directly if
+           // the list is full
+  void     record(dlCommand *c, const char *text = nullptr);
+
+           // Draws whatever is recorded so far and sends the rest of the frame directly
+  void     startOverflow(void);
+
+           // Clear the boxes of last frame's commands and its spill to the background
+  void     clearLastFrame(void);
+
+           // Drop covered commands, join fills, remove the dropped ones from the list
+  void     coalesce(void);
+
+           // Flag what differs from the last frame, returns false if nothing does
+  bool     markChanges(void);
+
+           // Make this frame the last one and start recording the next
+  void     endFrame(void);
+
+  bool     same(const dlCommand *a, const char *aPool, const dlCommand *b, const char *bPool);
+  void     draw(TFT_eSPI *dst, const dlCommand *c, const char *pool);
+};
@@ -1987,12 +1987,6 @@ void TFT_eSprite::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uin
 {
   if ( _vpOoB || !_created ) return;
 
-  if ((x >= _vpW - _xDatum)                   || // Clip right
-      (y >= _vpH - _yDatum)                   || // Clip bottom
-      ((x + 6 * size - 1) < (_vpX - _xDatum)) || // Clip left
-      ((y + 8 * size - 1) < (_vpY - _yDatum)))   // Clip top
-    return;
-
   if (c < 32) return;
 #ifdef LOAD_GLCD
 //>>>>>>>>>>>>>>>>>>
@@ -2001,6 +1995,13 @@ void TFT_eSprite::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uin
 #endif
 //>>>>>>>>>>>>>>>>>>
 
+  // The 6 x 8 cell is only the classic font's, a free font glyph is clipped as it is drawn
+  if ((x >= _vpW - _xDatum)                   || // Clip right
+      (y >= _vpH - _yDatum)                   || // Clip bottom
+      ((x + 6 * size - 1) < (_vpX - _xDatum)) || // Clip left
+      ((y + 8 * size - 1) < (_vpY - _yDatum)))   // Clip top
+    return;
+
   bool fillbg = (bg != color);
 
   if ((size==1) && fillbg)
@@ -2171,6 +2172,12 @@ int16_t TFT_eSprite::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t fo
 #endif
   }
 
+  const tftSpanFont *sf = spanFont(font);
+  if (sf) return drawSpanChar(uniCode, x, y, sf);
+
+  // The tables of a font not compiled in are a one entry placeholder
+  if ((font>1) && (font<9) && !(fontsloaded & (1 << font))) return 0;
+
   if ((font>1) && (font<9) && ((uniCode < 32) || (uniCode > 127))) return 0;
 
   int32_t width  = 0;
@@ -2528,6 +2535,7 @@ void TFT_eSprite::printToSprite(char *cbuffer, uint16_t len) //String string)
   if(!fontLoaded) return;
 
   uint16_t n = 0;
+  uint16_t ascii = asciiLength(cbuffer, len); // Characters as they are, no decoding needed
   bool newSprite = !_created;
 
   if (newSprite)
@@ -2537,7 +2545,7 @@ void TFT_eSprite::printToSprite(char *cbuffer, uint16_t len) //String string)
 
     while (n < len)
     {
-      uint16_t unicode = decodeUTF8((uint8_t*)cbuffer, &n, len - n);
+      uint16_t unicode = (n < ascii) ? (uint8_t)cbuffer[n++] : decodeUTF8((uint8_t*)cbuffer, &n, len - n);
       if (getUnicodeIndex(unicode, &index))
       {
         if (n == 0) sWidth -= gdX[index];
@@ -2554,6 +2562,8 @@ void TFT_eSprite::printToSprite(char *cbuffer, uint16_t len) //String string)
 
   n = 0;
 
+  while (n < ascii) drawGlyph((uint8_t)cbuffer[n++]);
+
   while (n < len)
   {
     uint16_t unicode = decodeUTF8((uint8_t*)cbuffer, &n, len - n);
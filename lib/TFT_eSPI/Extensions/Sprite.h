@@ -149,6 +149,15 @@ class TFT_eSprite : public TFT_eSPI {
            // Reserve memory for the Sprite and return a pointer
   void*    callocSprite(int16_t width, int16_t height, uint8_t frames = 1);
 
+#ifdef LOAD_GFXFF
+           // Opaque free font text is filled and drawn over in RAM, there is no flicker to avoid
+  bool     cellsHoldInk(const char * /*string*/, int32_t /*poX*/, int32_t /*left*/, int32_t /*right*/) { return false; }
+#endif
+
+           // The same for span font glyphs
+  bool     pushSpanGlyphs(int32_t /*x*/, int32_t /*y*/, const tftSpanFont * /*sf*/, const tftSpanGlyph * const * /*g*/, uint8_t /*n*/) { return false; }
+  bool     pushAlphaGlyph(int32_t /*x*/, int32_t /*y*/, const tftSpanFont * /*sf*/, const tftSpanGlyph * /*g*/) { return false; }
+
  protected:
 
   uint8_t  _bpp;     // bits per pixel (1, 8 or 16)
@@ -0,0 +1,115 @@
+// Widths and heights of the numbered fonts as compile time constants, so the width of a
+// string literal or of a field of digits costs nothing at run time:
+//
+//   constexpr int16_t w = tftTextWidth(4, "km/h");   // 57
+//   static_assert(tftTextWidth(8, "88") == 110, "");
+//
+// The tables are those of the font files (widtbl_f16 etc.) and are available whether the
+// font is loaded or drawn from a span font made from it by tools/font_compiler, which
+// checks they match. Widths are at text size 1 and match textWidth(), so characters
+// outside 32 to 127 have the width of a space. Font 2 has ` as a degree sign, as Font16.c
+
+#ifndef _TFT_FONT_METRICS_H_
+#define _TFT_FONT_METRICS_H_
+
+constexpr uint8_t tftWidthsFont2[96] =
+{
+        6, 3, 4, 9, 8, 9, 9, 3,             // char 32 - 39
+        7, 7, 8, 6, 3, 6, 5, 7,             // char 40 - 47
+        8, 8, 8, 8, 8, 8, 8, 8,             // char 48 - 55
+        8, 8, 3, 3, 6, 6, 6, 8,             // char 56 - 63
+        9, 8, 8, 8, 8, 8, 8, 8,             // char 64 - 71
+        8, 4, 8, 8, 7, 10, 8, 8,            // char 72 - 79
+        8, 8, 8, 8, 8, 8, 8, 10,            // char 80 - 87
+        8, 8, 8, 4, 7, 4, 7, 9,             // char 88 - 95
+        5, 7, 7, 7, 7, 7, 6, 7,             // char 96 - 103 0x60 is degree symbol
+        7, 4, 5, 6, 4, 8, 7, 8,             // char 104 - 111
+        7, 8, 6, 6, 5, 7, 8, 8,             // char 112 - 119
+        6, 7, 7, 5, 3, 5, 8, 6              // char 120 - 127
+};
+
+constexpr uint8_t tftWidthsFont4[96] =
+{
+        5, 8, 8, 19, 14, 21, 17, 6,         // char 32 - 39
+        8, 8, 12, 10, 7, 8, 7, 8,           // char 40 - 47
+        14, 14, 14, 14, 14, 14, 14, 14,     // char 48 - 55
+        14, 14, 7, 7, 14, 9, 14, 13,        // char 56 - 63
+        25, 16, 17, 18, 18, 16, 15, 19,     // char 64 - 71
+        18, 6, 13, 17, 13, 21, 18, 19,      // char 72 - 79
+        16, 19, 17, 16, 14, 18, 15, 23,     // char 80 - 87
+        15, 16, 16, 9, 13, 9, 12, 13,       // char 88 - 95
+        9, 14, 15, 13, 15, 14, 8, 15,       // char 96 - 103
+        15, 6, 6, 12, 6, 22, 15, 15,        // char 104 - 111
+        15, 15, 8, 12, 7, 14, 12, 18,       // char 112 - 119
+        13, 13, 12, 13, 13, 13, 15, 1       // char 120 - 127
+};
+
+constexpr uint8_t tftWidthsFont6[96] =
+{
+        12, 12, 12, 12, 12, 12, 12, 12,     // char 32 - 39
+        12, 12, 12, 12, 12, 17, 15, 12,     // char 40 - 47
+        27, 27, 27, 27, 27, 27, 27, 27,     // char 48 - 55
+        27, 27, 15, 12, 12, 12, 12, 12,     // char 56 - 63
+        12, 12, 12, 12, 12, 12, 12, 12,     // char 64 - 71
+        12, 12, 12, 12, 12, 12, 12, 12,     // char 72 - 79
+        12, 12, 12, 12, 12, 12, 12, 12,     // char 80 - 87
+        12, 12, 12, 12, 12, 12, 12, 12,     // char 88 - 95
+        12, 27, 12, 12, 12, 12, 12, 12,     // char 96 - 103
+        12, 12, 12, 12, 12, 42, 12, 12,     // char 104 - 111
+        29, 12, 12, 12, 12, 12, 12, 12,     // char 112 - 119
+        12, 12, 12, 12, 7, 12, 12, 12       // char 120 - 127
+};
+
+// Font 7 and 8 have one width for the digits (and - in Font 7) and one for everything else
+constexpr uint8_t tftWidthFont7(uint8_t c)
+{
+  return (c >= '0' && c <= '9') || c == '-' ? 32 : 12;
+}
+
+#ifdef LOAD_FONT8N // Narrower version
+constexpr uint8_t tftWidthFont8(uint8_t c) { return (c >= '0' && c <= '9') ? 53 : 29; }
+#else
+constexpr uint8_t tftWidthFont8(uint8_t c) { return (c >= '0' && c <= '9') ? 55 : 29; }
+#endif
+
+// Width of character c in numbered font 1 to 8 at text size 1, 0 for fonts 3 and 5
+constexpr uint8_t tftCharWidth(uint8_t font, uint8_t c)
+{
+  return font == 1 ? 6
+       : (c < 32 || c > 127) ? tftCharWidth(font, ' ')
+       : font == 2 ? tftWidthsFont2[c - 32]
+       : font == 4 ? tftWidthsFont4[c - 32]
+       : font == 6 ? tftWidthsFont6[c - 32]
+       : font == 7 ? tftWidthFont7(c)
+       : font == 8 ? tftWidthFont8(c)
+       : 0;
+}
+
+// Width of a string in numbered font 1 to 8 at text size size
+constexpr int16_t tftTextWidth(uint8_t font, const char *string, uint8_t size = 1)
+{
+  return *string ? tftCharWidth(font, *string) * size + tftTextWidth(font, string + 1, size) : 0;
+}
+
+// Advance of a digit, which is the same for all ten digits in every numbered font
+constexpr uint8_t tftDigitWidth(uint8_t font)
+{
+  return tftCharWidth(font, '0');
+}
+
+// Height of numbered font 1 to 8 at text size size, as fontHeight()
+constexpr int16_t tftFontHeight(uint8_t font, uint8_t size = 1)
+{
+  return size * (font == 1 ? 8 : font == 2 ? 16 : font == 4 ? 26 : font == 6 ? 48 : font == 7 ? 48 : font == 8 ? 75 : 0);
+}
+
+// textWidth() counts digits without looking them up, which needs this
+constexpr bool tftDigitsFixed(uint8_t font, uint8_t c = '1')
+{
+  return c > '9' || (tftCharWidth(font, c) == tftDigitWidth(font) && tftDigitsFixed(font, c + 1));
+}
+
+static_assert(tftDigitsFixed(2) && tftDigitsFixed(4) && tftDigitsFixed(6) &&
+              tftDigitsFixed(7) && tftDigitsFixed(8), "Numbered font digits differ in width");
+
+#endif
@@ -0,0 +1,480 @@
+// Font 4 as span encoded glyphs, generated by tools/font_compiler:
+//   ./font_compiler --out ../../lib/TFT_eSPI/Fonts/Spans/Font4spans.h 4
+// Register it with tft.setSpanFont(font, &Font4spans)
+
+const uint8_t Font4spansRows[] PROGMEM = {
+  // 0x21 '!'
+  0x01, 0x00, 0x02, 0x8B, 0x00, 0x80, 0x01, 0x00, 0x02, 0x81,
+  // 0x22 '"'
+  0x02, 0x00, 0x01, 0x02, 0x01, 0x85,
+  // 0x23 '#'
+  0x02, 0x07, 0x02, 0x02, 0x02, 0x02, 0x07, 0x01, 0x03, 0x01, 0x80, 0x02, 0x06, 0x02, 0x02, 0x02,
+  0x02, 0x06, 0x01, 0x03, 0x01, 0x80, 0x01, 0x01, 0x0E, 0x02, 0x05, 0x01, 0x03, 0x01, 0x81, 0x01,
+  0x00, 0x0E, 0x02, 0x04, 0x01, 0x03, 0x01, 0x80, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01,
+  0x03, 0x01, 0x80, 0x02, 0x02, 0x02, 0x02, 0x02,
+  // 0x24 '$'
+  0x01, 0x03, 0x06, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x03, 0x04, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02,
+  0x80, 0x01, 0x00, 0x02, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x08, 0x01, 0x02, 0x02,
+  0x82, 0x01, 0x01, 0x02, 0x02, 0x01, 0x07, 0x03, 0x01, 0x01, 0x00, 0x0C, 0x02, 0x00, 0x02, 0x05,
+  0x04,
+  // 0x25 '%'
+  0x02, 0x03, 0x03, 0x08, 0x02, 0x02, 0x01, 0x07, 0x06, 0x01, 0x03, 0x01, 0x02, 0x03, 0x02, 0x05,
+  0x02, 0x03, 0x00, 0x02, 0x05, 0x02, 0x03, 0x02, 0x03, 0x00, 0x02, 0x05, 0x02, 0x03, 0x01, 0x03,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x03, 0x01, 0x02, 0x01, 0x07,
+  0x02, 0x01, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x09, 0x01, 0x02, 0x07, 0x03, 0x08,
+  0x01, 0x03, 0x02, 0x03, 0x02, 0x03, 0x07, 0x02, 0x02, 0x02, 0x05, 0x02, 0x03, 0x07, 0x01, 0x03,
+  0x02, 0x05, 0x02, 0x03, 0x06, 0x02, 0x03, 0x02, 0x05, 0x02, 0x03, 0x05, 0x02, 0x05, 0x02, 0x03,
+  0x02, 0x02, 0x05, 0x01, 0x06, 0x07, 0x02, 0x04, 0x02, 0x08, 0x03, 0x01, 0x04, 0x01,
+  // 0x26 '&'
+  0x01, 0x04, 0x05, 0x01, 0x03, 0x07, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x05, 0x02,
+  0x80, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x01, 0x04, 0x05, 0x01, 0x03,
+  0x04, 0x02, 0x02, 0x06, 0x04, 0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x00, 0x03,
+  0x04, 0x03, 0x02, 0x02, 0x02, 0x00, 0x02, 0x06, 0x05, 0x02, 0x00, 0x02, 0x07, 0x04, 0x02, 0x00,
+  0x02, 0x08, 0x02, 0x02, 0x00, 0x03, 0x05, 0x06, 0x02, 0x01, 0x09, 0x02, 0x03, 0x02, 0x02, 0x06,
+  0x05, 0x03,
+  // 0x27 '''
+  0x01, 0x00, 0x03, 0x81, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02,
+  // 0x28 '('
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x81,
+  0x01, 0x00, 0x02, 0x88, 0x01, 0x01, 0x02, 0x81, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x02,
+  // 0x29 ')'
+  0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x81,
+  0x01, 0x03, 0x02, 0x88, 0x01, 0x02, 0x02, 0x81, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x00, 0x02,
+  // 0x2A '*'
+  0x01, 0x04, 0x02, 0x81, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x02,
+  0x06, 0x01, 0x03, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x02, 0x03, 0x02, 0x02,
+  0x01, 0x04, 0x01,
+  // 0x2B '+'
+  0x01, 0x03, 0x02, 0x81, 0x01, 0x00, 0x08, 0x80, 0x01, 0x03, 0x02, 0x81,
+  // 0x2C ','
+  0x01, 0x00, 0x03, 0x81, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02,
+  // 0x2D '-'
+  0x01, 0x00, 0x06, 0x80,
+  // 0x2E '.'
+  0x01, 0x00, 0x03, 0x81,
+  // 0x2F '/'
+  0x01, 0x06, 0x02, 0x80, 0x01, 0x06, 0x01, 0x01, 0x05, 0x02, 0x80, 0x01, 0x05, 0x01, 0x01, 0x04,
+  0x02, 0x80, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x80, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x80,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x80, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x80,
+  // 0x30 '0'
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x08, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x85, 0x02, 0x00, 0x03, 0x06, 0x03,
+  0x02, 0x01, 0x02, 0x06, 0x02, 0x02, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02, 0x08, 0x01, 0x04, 0x04,
+  // 0x31 '1'
+  0x01, 0x04, 0x02, 0x80, 0x01, 0x03, 0x03, 0x01, 0x00, 0x06, 0x80, 0x01, 0x04, 0x02, 0x8A,
+  // 0x32 '2'
+  0x01, 0x03, 0x06, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x03, 0x04, 0x03, 0x02, 0x00, 0x03, 0x07, 0x02,
+  0x02, 0x00, 0x02, 0x08, 0x02, 0x80, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x07, 0x04, 0x01,
+  0x05, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x0C, 0x80,
+  // 0x33 '3'
+  0x01, 0x03, 0x06, 0x01, 0x02, 0x08, 0x02, 0x01, 0x03, 0x04, 0x03, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x02, 0x00, 0x03, 0x06, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x06, 0x01, 0x09, 0x03, 0x01, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x80, 0x02, 0x00, 0x03,
+  0x06, 0x03, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x0A, 0x01, 0x03, 0x06,
+  // 0x34 '4'
+  0x01, 0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x80, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02,
+  0x04, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x80, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02,
+  0x01, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x00, 0x0C, 0x80, 0x01, 0x08, 0x02,
+  0x82,
+  // 0x35 '5'
+  0x01, 0x01, 0x0A, 0x80, 0x01, 0x01, 0x02, 0x81, 0x02, 0x01, 0x02, 0x01, 0x05, 0x01, 0x01, 0x0A,
+  0x02, 0x00, 0x04, 0x04, 0x03, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x0A, 0x02, 0x81, 0x02, 0x00,
+  0x02, 0x08, 0x02, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x0A,
+  0x01, 0x03, 0x06,
+  // 0x36 '6'
+  0x01, 0x04, 0x05, 0x01, 0x02, 0x09, 0x02, 0x01, 0x03, 0x05, 0x02, 0x02, 0x01, 0x02, 0x07, 0x02,
+  0x80, 0x01, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x05, 0x01, 0x00, 0x0B, 0x02, 0x00, 0x04, 0x04,
+  0x03, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x81, 0x02, 0x01, 0x02, 0x06,
+  0x03, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x09, 0x01, 0x03, 0x06,
+  // 0x37 '7'
+  0x01, 0x00, 0x0C, 0x80, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x02,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x80, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02,
+  0x81, 0x01, 0x03, 0x02, 0x81,
+  // 0x38 '8'
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x08, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x81, 0x02, 0x02, 0x02, 0x04, 0x02, 0x01, 0x03, 0x06, 0x01, 0x02, 0x08, 0x02, 0x01, 0x03, 0x04,
+  0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x82, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x0A, 0x01,
+  0x03, 0x06,
+  // 0x39 '9'
+  0x01, 0x03, 0x06, 0x01, 0x01, 0x09, 0x02, 0x01, 0x03, 0x04, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02,
+  0x02, 0x00, 0x02, 0x08, 0x02, 0x81, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x01, 0x03, 0x04, 0x04,
+  0x01, 0x01, 0x0B, 0x02, 0x03, 0x05, 0x02, 0x02, 0x01, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02,
+  0x80, 0x02, 0x01, 0x02, 0x05, 0x03, 0x01, 0x01, 0x09, 0x01, 0x02, 0x07,
+  // 0x3A ':'
+  0x01, 0x00, 0x03, 0x81, 0x00, 0x85, 0x01, 0x00, 0x03, 0x81,
+  // 0x3B ';'
+  0x01, 0x00, 0x03, 0x81, 0x00, 0x85, 0x01, 0x00, 0x03, 0x81, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x02,
+  // 0x3C '<'
+  0x01, 0x09, 0x03, 0x01, 0x07, 0x03, 0x01, 0x04, 0x04, 0x01, 0x02, 0x03, 0x01, 0x00, 0x02, 0x01,
+  0x02, 0x03, 0x01, 0x05, 0x03, 0x01, 0x07, 0x03, 0x01, 0x09, 0x03,
+  // 0x3D '='
+  0x01, 0x00, 0x07, 0x80, 0x00, 0x80, 0x01, 0x00, 0x07, 0x80,
+  // 0x3E '>'
+  0x01, 0x00, 0x03, 0x01, 0x02, 0x03, 0x01, 0x04, 0x04, 0x01, 0x07, 0x03, 0x01, 0x0A, 0x02, 0x01,
+  0x07, 0x03, 0x01, 0x04, 0x04, 0x01, 0x02, 0x03, 0x01, 0x00, 0x03,
+  // 0x3F '?'
+  0x01, 0x03, 0x06, 0x01, 0x01, 0x09, 0x02, 0x01, 0x03, 0x04, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02,
+  0x02, 0x00, 0x02, 0x07, 0x02, 0x80, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x80, 0x00, 0x80, 0x01, 0x04, 0x03, 0x81,
+  // 0x40 '@'
+  0x01, 0x08, 0x09, 0x02, 0x06, 0x03, 0x07, 0x03, 0x02, 0x04, 0x03, 0x0B, 0x02, 0x02, 0x03, 0x02,
+  0x0E, 0x02, 0x02, 0x02, 0x02, 0x10, 0x02, 0x04, 0x02, 0x01, 0x07, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x04, 0x01, 0x02, 0x05, 0x02, 0x03, 0x04, 0x04, 0x02, 0x04, 0x01, 0x02, 0x04, 0x02, 0x05, 0x02,
+  0x05, 0x02, 0x04, 0x00, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x04, 0x00, 0x02, 0x04, 0x02,
+  0x06, 0x02, 0x05, 0x02, 0x80, 0x04, 0x00, 0x02, 0x04, 0x02, 0x05, 0x02, 0x05, 0x02, 0x80, 0x04,
+  0x00, 0x02, 0x04, 0x02, 0x05, 0x02, 0x04, 0x02, 0x04, 0x01, 0x02, 0x04, 0x02, 0x03, 0x03, 0x03,
+  0x02, 0x03, 0x01, 0x02, 0x05, 0x04, 0x02, 0x05, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04,
+  0x02, 0x0C, 0x02, 0x02, 0x05, 0x03, 0x06, 0x04, 0x01, 0x07, 0x08,
+  // 0x41 'A'
+  0x01, 0x06, 0x04, 0x81, 0x02, 0x05, 0x02, 0x02, 0x02, 0x81, 0x02, 0x04, 0x02, 0x04, 0x02, 0x81,
+  0x02, 0x03, 0x02, 0x06, 0x02, 0x80, 0x01, 0x03, 0x0A, 0x01, 0x02, 0x0C, 0x02, 0x02, 0x02, 0x08,
+  0x02, 0x80, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x80, 0x02, 0x00, 0x03, 0x0A, 0x03,
+  // 0x42 'B'
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x0D, 0x02, 0x00, 0x02, 0x08, 0x03, 0x02, 0x00, 0x02, 0x09, 0x02,
+  0x82, 0x02, 0x00, 0x02, 0x08, 0x03, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0D, 0x02, 0x00, 0x02, 0x08,
+  0x03, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x82, 0x02, 0x00, 0x02, 0x08, 0x03, 0x01, 0x00, 0x0D, 0x01,
+  0x00, 0x0B,
+  // 0x43 'C'
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x05, 0x04, 0x02, 0x01, 0x03, 0x09, 0x02,
+  0x02, 0x01, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x03, 0x0B, 0x02, 0x01, 0x00, 0x02, 0x83, 0x02, 0x00,
+  0x02, 0x0C, 0x02, 0x02, 0x00, 0x03, 0x0B, 0x02, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x02, 0x01, 0x03,
+  0x09, 0x02, 0x02, 0x02, 0x04, 0x05, 0x04, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07,
+  // 0x44 'D'
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0C, 0x02, 0x00, 0x02, 0x07, 0x04, 0x02, 0x00, 0x02, 0x09, 0x03,
+  0x02, 0x00, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x0A, 0x03, 0x02, 0x00, 0x02, 0x0B, 0x02, 0x84,
+  0x02, 0x00, 0x02, 0x0A, 0x03, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02,
+  0x00, 0x02, 0x07, 0x04, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0A,
+  // 0x45 'E'
+  0x01, 0x00, 0x0D, 0x80, 0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x02, 0x84,
+  0x01, 0x00, 0x0D, 0x80,
+  // 0x46 'F'
+  0x01, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x0B, 0x80, 0x01, 0x00, 0x02, 0x86,
+  // 0x47 'G'
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x03, 0x06, 0x04, 0x02, 0x01, 0x03, 0x09, 0x02,
+  0x02, 0x01, 0x02, 0x0A, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x80, 0x02, 0x00, 0x02, 0x06,
+  0x08, 0x80, 0x02, 0x00, 0x02, 0x0C, 0x02, 0x80, 0x02, 0x00, 0x03, 0x0B, 0x02, 0x02, 0x01, 0x02,
+  0x0A, 0x03, 0x02, 0x01, 0x03, 0x08, 0x04, 0x02, 0x02, 0x04, 0x05, 0x05, 0x02, 0x03, 0x0A, 0x01,
+  0x02, 0x02, 0x05, 0x06, 0x04, 0x01,
+  // 0x48 'H'
+  0x02, 0x00, 0x02, 0x0A, 0x02, 0x85, 0x01, 0x00, 0x0E, 0x80, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x87,
+  // 0x49 'I'
+  0x01, 0x00, 0x02, 0x90,
+  // 0x4A 'J'
+  0x01, 0x09, 0x02, 0x8A, 0x02, 0x00, 0x02, 0x07, 0x02, 0x81, 0x02, 0x00, 0x03, 0x05, 0x03, 0x01,
+  0x01, 0x09, 0x01, 0x02, 0x07,
+  // 0x4B 'K'
+  0x02, 0x00, 0x02, 0x09, 0x03, 0x02, 0x00, 0x02, 0x08, 0x03, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02,
+  0x00, 0x02, 0x06, 0x03, 0x02, 0x00, 0x02, 0x05, 0x03, 0x02, 0x00, 0x02, 0x04, 0x03, 0x02, 0x00,
+  0x02, 0x03, 0x03, 0x02, 0x00, 0x02, 0x02, 0x03, 0x02, 0x00, 0x02, 0x01, 0x04, 0x01, 0x00, 0x08,
+  0x02, 0x00, 0x04, 0x02, 0x03, 0x02, 0x00, 0x03, 0x04, 0x03, 0x02, 0x00, 0x02, 0x06, 0x02, 0x02,
+  0x00, 0x02, 0x06, 0x03, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02, 0x00, 0x02, 0x08, 0x03, 0x02, 0x00,
+  0x02, 0x09, 0x03, 0x02, 0x00, 0x02, 0x0A, 0x03,
+  // 0x4C 'L'
+  0x01, 0x00, 0x02, 0x8E, 0x01, 0x00, 0x0B, 0x80,
+  // 0x4D 'M'
+  0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x04, 0x09, 0x04, 0x81, 0x04, 0x00, 0x02, 0x01, 0x02,
+  0x07, 0x02, 0x01, 0x02, 0x81, 0x04, 0x00, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02, 0x81, 0x04,
+  0x00, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x81, 0x04, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02,
+  0x04, 0x02, 0x80, 0x03, 0x00, 0x02, 0x04, 0x05, 0x04, 0x02, 0x03, 0x00, 0x02, 0x05, 0x03, 0x05,
+  0x02, 0x80,
+  // 0x4E 'N'
+  0x02, 0x00, 0x03, 0x09, 0x02, 0x80, 0x02, 0x00, 0x04, 0x08, 0x02, 0x02, 0x00, 0x05, 0x07, 0x02,
+  0x03, 0x00, 0x02, 0x01, 0x02, 0x07, 0x02, 0x03, 0x00, 0x02, 0x01, 0x03, 0x06, 0x02, 0x03, 0x00,
+  0x02, 0x02, 0x03, 0x05, 0x02, 0x03, 0x00, 0x02, 0x03, 0x02, 0x05, 0x02, 0x03, 0x00, 0x02, 0x03,
+  0x03, 0x04, 0x02, 0x03, 0x00, 0x02, 0x04, 0x03, 0x03, 0x02, 0x03, 0x00, 0x02, 0x05, 0x02, 0x03,
+  0x02, 0x03, 0x00, 0x02, 0x05, 0x03, 0x02, 0x02, 0x03, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02, 0x03,
+  0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x02, 0x00, 0x02, 0x07, 0x05, 0x02, 0x00, 0x02, 0x08, 0x04,
+  0x02, 0x00, 0x02, 0x09, 0x03, 0x80,
+  // 0x4F 'O'
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x05, 0x04, 0x02, 0x01, 0x03, 0x09, 0x03,
+  0x02, 0x01, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x02, 0x0D, 0x02, 0x84,
+  0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x02, 0x0B, 0x02, 0x02, 0x01, 0x03, 0x09, 0x03, 0x02,
+  0x02, 0x04, 0x05, 0x04, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07,
+  // 0x50 'P'
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x0C, 0x02, 0x00, 0x02, 0x08, 0x03, 0x02, 0x00, 0x02, 0x09, 0x02,
+  0x82, 0x02, 0x00, 0x02, 0x08, 0x03, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x02, 0x86,
+  // 0x51 'Q'
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x05, 0x04, 0x02, 0x01, 0x03, 0x09, 0x03,
+  0x02, 0x01, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x02, 0x0D, 0x02, 0x84,
+  0x03, 0x00, 0x03, 0x07, 0x01, 0x03, 0x03, 0x03, 0x01, 0x02, 0x06, 0x03, 0x02, 0x02, 0x02, 0x01,
+  0x03, 0x06, 0x06, 0x02, 0x02, 0x04, 0x05, 0x04, 0x01, 0x03, 0x0D, 0x02, 0x05, 0x07, 0x02, 0x03,
+  0x01, 0x0F, 0x01,
+  // 0x52 'R'
+  0x01, 0x00, 0x0C, 0x01, 0x00, 0x0D, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02, 0x00, 0x02, 0x0A, 0x02,
+  0x82, 0x02, 0x00, 0x02, 0x09, 0x02, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0C, 0x02, 0x00, 0x02, 0x08,
+  0x03, 0x02, 0x00, 0x02, 0x09, 0x02, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02, 0x00, 0x02, 0x0A, 0x02,
+  0x83,
+  // 0x53 'S'
+  0x01, 0x04, 0x06, 0x01, 0x02, 0x0A, 0x02, 0x01, 0x03, 0x06, 0x03, 0x02, 0x01, 0x02, 0x08, 0x02,
+  0x80, 0x02, 0x01, 0x02, 0x08, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x05, 0x01, 0x03, 0x07, 0x01,
+  0x06, 0x06, 0x01, 0x09, 0x04, 0x01, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x09, 0x02, 0x02, 0x01, 0x02,
+  0x09, 0x02, 0x80, 0x02, 0x01, 0x04, 0x06, 0x03, 0x01, 0x02, 0x0B, 0x01, 0x04, 0x07,
+  // 0x54 'T'
+  0x01, 0x00, 0x0E, 0x80, 0x01, 0x06, 0x02, 0x8E,
+  // 0x55 'U'
+  0x02, 0x00, 0x02, 0x0A, 0x02, 0x8C, 0x02, 0x00, 0x03, 0x08, 0x03, 0x02, 0x01, 0x03, 0x06, 0x03,
+  0x01, 0x02, 0x0A, 0x01, 0x03, 0x08,
+  // 0x56 'V'
+  0x02, 0x00, 0x03, 0x09, 0x03, 0x02, 0x01, 0x02, 0x09, 0x02, 0x81, 0x02, 0x02, 0x02, 0x07, 0x02,
+  0x81, 0x02, 0x03, 0x02, 0x05, 0x02, 0x81, 0x02, 0x04, 0x02, 0x03, 0x02, 0x81, 0x02, 0x05, 0x02,
+  0x01, 0x02, 0x80, 0x01, 0x05, 0x05, 0x01, 0x06, 0x03, 0x80,
+  // 0x57 'W'
+  0x03, 0x00, 0x03, 0x07, 0x03, 0x07, 0x03, 0x03, 0x01, 0x02, 0x07, 0x03, 0x07, 0x02, 0x80, 0x04,
+  0x01, 0x03, 0x05, 0x02, 0x01, 0x02, 0x05, 0x03, 0x04, 0x02, 0x02, 0x05, 0x02, 0x01, 0x02, 0x05,
+  0x02, 0x81, 0x04, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x03, 0x02,
+  0x03, 0x02, 0x03, 0x02, 0x81, 0x04, 0x03, 0x03, 0x01, 0x02, 0x05, 0x02, 0x01, 0x03, 0x04, 0x04,
+  0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x81, 0x02, 0x04, 0x04, 0x07, 0x04, 0x02, 0x05, 0x03,
+  0x07, 0x03, 0x80,
+  // 0x58 'X'
+  0x02, 0x01, 0x02, 0x09, 0x02, 0x02, 0x01, 0x03, 0x07, 0x03, 0x02, 0x02, 0x02, 0x07, 0x02, 0x02,
+  0x03, 0x02, 0x05, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02, 0x02, 0x05,
+  0x02, 0x01, 0x02, 0x01, 0x05, 0x05, 0x01, 0x06, 0x03, 0x80, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02,
+  0x04, 0x03, 0x01, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x05, 0x02, 0x02, 0x02,
+  0x03, 0x05, 0x03, 0x02, 0x02, 0x02, 0x07, 0x02, 0x02, 0x01, 0x03, 0x07, 0x03, 0x02, 0x00, 0x03,
+  0x09, 0x03,
+  // 0x59 'Y'
+  0x02, 0x00, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02,
+  0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x02, 0x06, 0x02, 0x02, 0x04, 0x02, 0x04, 0x02, 0x02, 0x04,
+  0x03, 0x02, 0x03, 0x02, 0x05, 0x02, 0x02, 0x02, 0x01, 0x06, 0x04, 0x80, 0x01, 0x07, 0x02, 0x86,
+  // 0x5A 'Z'
+  0x01, 0x01, 0x0D, 0x80, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02,
+  0x01, 0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x0E, 0x80,
+  // 0x5B '['
+  0x01, 0x00, 0x05, 0x80, 0x01, 0x00, 0x02, 0x91, 0x01, 0x00, 0x05, 0x80,
+  // 0x5C
+  0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x80, 0x01, 0x01, 0x02, 0x01, 0x02,
+  0x01, 0x80, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x80, 0x01, 0x03, 0x02, 0x01, 0x04, 0x01, 0x80,
+  0x01, 0x04, 0x02, 0x01, 0x05, 0x01, 0x80, 0x01, 0x05, 0x02, 0x01, 0x06, 0x01, 0x80, 0x01, 0x06,
+  0x02, 0x01, 0x07, 0x01, 0x80, 0x01, 0x07, 0x02, 0x01, 0x08, 0x01,
+  // 0x5D ']'
+  0x01, 0x00, 0x05, 0x80, 0x01, 0x03, 0x02, 0x91, 0x01, 0x00, 0x05, 0x80,
+  // 0x5E '^'
+  0x01, 0x04, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02,
+  // 0x5F '_'
+  0x01, 0x00, 0x0D,
+  // 0x60 '`'
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x06, 0x02, 0x00, 0x03, 0x02, 0x03, 0x02, 0x00, 0x02, 0x04, 0x02,
+  0x80, 0x02, 0x00, 0x03, 0x02, 0x03, 0x01, 0x01, 0x06, 0x01, 0x02, 0x04,
+  // 0x61 'a'
+  0x01, 0x03, 0x06, 0x01, 0x01, 0x09, 0x02, 0x01, 0x02, 0x05, 0x03, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x01, 0x09, 0x02, 0x01, 0x03, 0x08, 0x01, 0x01, 0x0A, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00,
+  0x02, 0x07, 0x02, 0x80, 0x02, 0x00, 0x03, 0x04, 0x04, 0x02, 0x01, 0x07, 0x01, 0x04, 0x02, 0x02,
+  0x05, 0x03, 0x03,
+  // 0x62 'b'
+  0x01, 0x00, 0x02, 0x83, 0x02, 0x00, 0x02, 0x02, 0x04, 0x02, 0x00, 0x02, 0x01, 0x07, 0x02, 0x00,
+  0x05, 0x02, 0x04, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02, 0x00, 0x02,
+  0x08, 0x02, 0x81, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x05,
+  0x02, 0x04, 0x02, 0x00, 0x02, 0x01, 0x07, 0x02, 0x00, 0x02, 0x02, 0x04,
+  // 0x63 'c'
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x08, 0x02, 0x01, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x81, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x01, 0x02, 0x06,
+  0x02, 0x02, 0x01, 0x04, 0x02, 0x03, 0x01, 0x02, 0x08, 0x01, 0x04, 0x04,
+  // 0x64 'd'
+  0x01, 0x0A, 0x02, 0x83, 0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x01,
+  0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x06, 0x03, 0x02, 0x00, 0x03, 0x07, 0x02, 0x02, 0x00, 0x02,
+  0x08, 0x02, 0x81, 0x02, 0x00, 0x03, 0x07, 0x02, 0x02, 0x01, 0x02, 0x06, 0x03, 0x02, 0x01, 0x04,
+  0x02, 0x05, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02,
+  // 0x65 'e'
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x08, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x02,
+  0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+  0x01, 0x02, 0x06, 0x03, 0x02, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02, 0x08, 0x01, 0x04, 0x04,
+  // 0x66 'f'
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x02, 0x81, 0x01, 0x00, 0x07, 0x80, 0x01, 0x02,
+  0x02, 0x89,
+  // 0x67 'g'
+  0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x01, 0x04, 0x02, 0x05, 0x02,
+  0x01, 0x02, 0x06, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x82, 0x02, 0x00, 0x03, 0x07, 0x02, 0x02,
+  0x01, 0x02, 0x06, 0x03, 0x02, 0x01, 0x04, 0x02, 0x05, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x04,
+  0x04, 0x02, 0x02, 0x01, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x00, 0x02, 0x07, 0x03,
+  0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x0A, 0x01, 0x03, 0x06,
+  // 0x68 'h'
+  0x01, 0x00, 0x02, 0x83, 0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x01, 0x07, 0x02, 0x00,
+  0x04, 0x04, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02, 0x87,
+  // 0x69 'i'
+  0x01, 0x00, 0x02, 0x81, 0x00, 0x80, 0x01, 0x00, 0x02, 0x8B,
+  // 0x6A 'j'
+  0x01, 0x02, 0x02, 0x81, 0x00, 0x80, 0x01, 0x02, 0x02, 0x8F, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03,
+  // 0x6B 'k'
+  0x01, 0x00, 0x02, 0x82, 0x02, 0x00, 0x02, 0x05, 0x03, 0x02, 0x00, 0x02, 0x04, 0x03, 0x02, 0x00,
+  0x02, 0x03, 0x03, 0x02, 0x00, 0x02, 0x02, 0x03, 0x02, 0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x07, 0x02, 0x00, 0x03, 0x02, 0x02, 0x02, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 0x02,
+  0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x03, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05,
+  0x03,
+  // 0x6C 'l'
+  0x01, 0x00, 0x02, 0x90,
+  // 0x6D 'm'
+  0x03, 0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x03, 0x00, 0x02, 0x01, 0x06, 0x01, 0x07, 0x03, 0x00,
+  0x04, 0x03, 0x05, 0x03, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x05, 0x02, 0x03, 0x00, 0x02, 0x06,
+  0x02, 0x06, 0x02, 0x87,
+  // 0x6E 'n'
+  0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x01, 0x07, 0x02, 0x00, 0x04, 0x04, 0x03, 0x02,
+  0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02, 0x87,
+  // 0x6F 'o'
+  0x01, 0x04, 0x05, 0x01, 0x02, 0x09, 0x02, 0x01, 0x04, 0x03, 0x04, 0x02, 0x01, 0x02, 0x07, 0x02,
+  0x02, 0x00, 0x03, 0x07, 0x03, 0x02, 0x00, 0x02, 0x09, 0x02, 0x81, 0x02, 0x00, 0x03, 0x07, 0x03,
+  0x02, 0x01, 0x02, 0x07, 0x02, 0x02, 0x01, 0x04, 0x03, 0x04, 0x01, 0x02, 0x09, 0x01, 0x04, 0x05,
+  // 0x70 'p'
+  0x02, 0x00, 0x02, 0x02, 0x04, 0x02, 0x00, 0x02, 0x01, 0x07, 0x02, 0x00, 0x05, 0x02, 0x04, 0x02,
+  0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x81, 0x02,
+  0x00, 0x02, 0x07, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x05, 0x02, 0x04, 0x02, 0x00,
+  0x02, 0x01, 0x07, 0x02, 0x00, 0x02, 0x02, 0x04, 0x01, 0x00, 0x02, 0x83,
+  // 0x71 'q'
+  0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x01, 0x04, 0x02, 0x05, 0x02,
+  0x01, 0x02, 0x06, 0x03, 0x02, 0x00, 0x03, 0x07, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x81, 0x02,
+  0x00, 0x03, 0x07, 0x02, 0x02, 0x01, 0x02, 0x06, 0x03, 0x02, 0x01, 0x04, 0x02, 0x05, 0x02, 0x02,
+  0x07, 0x01, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x01, 0x0A, 0x02, 0x83,
+  // 0x72 'r'
+  0x02, 0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x88,
+  // 0x73 's'
+  0x01, 0x02, 0x05, 0x01, 0x01, 0x08, 0x02, 0x00, 0x03, 0x04, 0x02, 0x02, 0x00, 0x02, 0x06, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x07, 0x01, 0x05, 0x05, 0x01, 0x08, 0x02, 0x02,
+  0x00, 0x02, 0x06, 0x02, 0x02, 0x00, 0x03, 0x04, 0x03, 0x01, 0x01, 0x08, 0x01, 0x02, 0x06,
+  // 0x74 't'
+  0x01, 0x02, 0x02, 0x82, 0x01, 0x00, 0x06, 0x80, 0x01, 0x02, 0x02, 0x87, 0x01, 0x02, 0x04, 0x01,
+  0x03, 0x03,
+  // 0x75 'u'
+  0x02, 0x00, 0x02, 0x07, 0x02, 0x87, 0x02, 0x00, 0x02, 0x06, 0x03, 0x02, 0x00, 0x03, 0x04, 0x04,
+  0x02, 0x01, 0x07, 0x01, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02,
+  // 0x76 'v'
+  0x02, 0x00, 0x02, 0x07, 0x02, 0x80, 0x02, 0x01, 0x02, 0x05, 0x02, 0x81, 0x02, 0x02, 0x02, 0x03,
+  0x02, 0x81, 0x02, 0x03, 0x02, 0x01, 0x02, 0x80, 0x01, 0x03, 0x05, 0x01, 0x04, 0x03, 0x80,
+  // 0x77 'w'
+  0x03, 0x00, 0x02, 0x05, 0x03, 0x05, 0x02, 0x80, 0x04, 0x00, 0x02, 0x05, 0x01, 0x01, 0x01, 0x05,
+  0x02, 0x04, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x81, 0x04, 0x01, 0x02, 0x03, 0x01,
+  0x03, 0x01, 0x03, 0x02, 0x04, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x81, 0x02, 0x03,
+  0x03, 0x05, 0x03, 0x81,
+  // 0x78 'x'
+  0x02, 0x00, 0x02, 0x07, 0x02, 0x02, 0x00, 0x03, 0x05, 0x03, 0x02, 0x01, 0x02, 0x05, 0x02, 0x02,
+  0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x03, 0x01, 0x03, 0x05, 0x01, 0x04, 0x03, 0x01,
+  0x03, 0x05, 0x02, 0x02, 0x03, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x03, 0x05, 0x03, 0x02, 0x00, 0x02, 0x07, 0x02,
+  // 0x79 'y'
+  0x02, 0x00, 0x03, 0x07, 0x03, 0x02, 0x01, 0x02, 0x07, 0x02, 0x80, 0x02, 0x02, 0x02, 0x05, 0x02,
+  0x81, 0x02, 0x03, 0x02, 0x03, 0x02, 0x81, 0x02, 0x04, 0x02, 0x01, 0x02, 0x81, 0x01, 0x05, 0x03,
+  0x81, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04,
+  // 0x7A 'z'
+  0x01, 0x00, 0x0A, 0x80, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x0A, 0x80,
+  // 0x7B '{'
+  0x01, 0x04, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x87, 0x01, 0x02, 0x02, 0x01, 0x00, 0x03,
+  0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x87, 0x01, 0x03, 0x03, 0x01, 0x04, 0x04,
+  // 0x7C '|'
+  0x01, 0x00, 0x02, 0x97,
+  // 0x7D '}'
+  0x01, 0x00, 0x04, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x87, 0x01, 0x04, 0x02, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x87, 0x01, 0x02, 0x03, 0x01, 0x00, 0x04,
+  // 0x7E '~'
+  0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x02, 0x04, 0x03, 0x04, 0x01, 0x03,
+  0x00, 0x01, 0x07, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x08, 0x04,
+};
+
+const tftSpanGlyph Font4spansGlyphs[] PROGMEM = {
+  {     0,   5,   0,   0,    0,    0 }, // 0x20 ' '
+  {     0,   8,   2,  18,    3,    1 }, // 0x21 '!'
+  {    10,   8,   4,   7,    2,    1 }, // 0x22 '"'
+  {    16,  19,  15,  17,    2,    2 }, // 0x23 '#'
+  {    72,  14,  12,  17,    1,    2 }, // 0x24 '$'
+  {   121,  21,  20,  18,    1,    2 }, // 0x25 '%'
+  {   231,  17,  16,  18,    1,    1 }, // 0x26 '&'
+  {   313,   6,   3,   6,    1,    1 }, // 0x27 '''
+  {   326,   8,   5,  24,    3,    1 }, // 0x28 '('
+  {   362,   8,   5,  24,    0,    1 }, // 0x29 ')'
+  {   398,  12,  10,  10,    1,    1 }, // 0x2A '*'
+  {   433,  10,   8,   8,    1,    8 }, // 0x2B '+'
+  {   445,   7,   3,   7,    2,   16 }, // 0x2C ','
+  {   461,   8,   6,   2,    1,   11 }, // 0x2D '-'
+  {   465,   7,   3,   3,    2,   16 }, // 0x2E '.'
+  {   469,   8,   8,  20,    0,    1 }, // 0x2F '/'
+  {   515,  14,  12,  17,    1,    2 }, // 0x30 '0'
+  {   563,  14,   6,  17,    3,    2 }, // 0x31 '1'
+  {   578,  14,  12,  17,    1,    2 }, // 0x32 '2'
+  {   631,  14,  12,  17,    1,    2 }, // 0x33 '3'
+  {   692,  14,  12,  17,    1,    2 }, // 0x34 '4'
+  {   741,  14,  12,  17,    1,    2 }, // 0x35 '5'
+  {   792,  14,  12,  17,    1,    2 }, // 0x36 '6'
+  {   852,  14,  12,  17,    1,    2 }, // 0x37 '7'
+  {   889,  14,  12,  17,    1,    2 }, // 0x38 '8'
+  {   939,  14,  12,  17,    1,    2 }, // 0x39 '9'
+  {   999,   7,   3,  13,    2,    6 }, // 0x3A ':'
+  {  1009,   7,   3,  17,    2,    6 }, // 0x3B ';'
+  {  1031,  14,  12,   9,    1,    7 }, // 0x3C '<'
+  {  1058,   9,   7,   6,    1,    9 }, // 0x3D '='
+  {  1068,  14,  12,   9,    1,    7 }, // 0x3E '>'
+  {  1095,  13,  11,  18,    1,    1 }, // 0x3F '?'
+  {  1142,  25,  23,  21,    1,    1 }, // 0x40 '@'
+  {  1265,  16,  16,  18,    0,    1 }, // 0x41 'A'
+  {  1310,  17,  14,  18,    2,    1 }, // 0x42 'B'
+  {  1360,  18,  16,  18,    1,    1 }, // 0x43 'C'
+  {  1421,  18,  15,  18,    2,    1 }, // 0x44 'D'
+  {  1479,  16,  13,  18,    2,    1 }, // 0x45 'E'
+  {  1499,  15,  12,  18,    2,    1 }, // 0x46 'F'
+  {  1515,  19,  16,  18,    1,    1 }, // 0x47 'G'
+  {  1585,  18,  14,  18,    2,    1 }, // 0x48 'H'
+  {  1601,   6,   2,  18,    2,    1 }, // 0x49 'I'
+  {  1605,  13,  11,  18,    0,    1 }, // 0x4A 'J'
+  {  1626,  17,  15,  18,    2,    1 }, // 0x4B 'K'
+  {  1714,  13,  11,  18,    2,    1 }, // 0x4C 'L'
+  {  1722,  21,  17,  18,    2,    1 }, // 0x4D 'M'
+  {  1788,  18,  14,  18,    2,    1 }, // 0x4E 'N'
+  {  1890,  19,  17,  18,    1,    1 }, // 0x4F 'O'
+  {  1948,  16,  13,  18,    2,    1 }, // 0x50 'P'
+  {  1980,  19,  17,  19,    1,    1 }, // 0x51 'Q'
+  {  2047,  17,  14,  18,    2,    1 }, // 0x52 'R'
+  {  2096,  16,  14,  18,    1,    1 }, // 0x53 'S'
+  {  2158,  14,  14,  18,    0,    1 }, // 0x54 'T'
+  {  2166,  18,  14,  18,    2,    1 }, // 0x55 'U'
+  {  2188,  15,  15,  18,    0,    1 }, // 0x56 'V'
+  {  2230,  23,  23,  18,    0,    1 }, // 0x57 'W'
+  {  2313,  15,  15,  18,    0,    1 }, // 0x58 'X'
+  {  2395,  16,  16,  18,    0,    1 }, // 0x59 'Y'
+  {  2443,  16,  14,  18,    1,    1 }, // 0x5A 'Z'
+  {  2493,   9,   5,  23,    3,    1 }, // 0x5B '['
+  {  2505,  13,   9,  25,    2,    0 }, // 0x5C
+  {  2564,   9,   5,  23,    1,    1 }, // 0x5D ']'
+  {  2576,  12,  11,   5,    1,    1 }, // 0x5E '^'
+  {  2599,  13,  13,   1,    0,   22 }, // 0x5F '_'
+  {  2602,   9,   8,   8,    1,    1 }, // 0x60 '`'
+  {  2630,  14,  13,  13,    1,    6 }, // 0x61 'a'
+  {  2681,  15,  12,  18,    2,    1 }, // 0x62 'b'
+  {  2741,  13,  11,  13,    1,    6 }, // 0x63 'c'
+  {  2785,  15,  12,  18,    1,    1 }, // 0x64 'd'
+  {  2845,  14,  12,  13,    1,    6 }, // 0x65 'e'
+  {  2892,   8,   7,  18,    0,    1 }, // 0x66 'f'
+  {  2910,  15,  12,  19,    1,    6 }, // 0x67 'g'
+  {  2985,  15,  11,  18,    2,    1 }, // 0x68 'h'
+  {  3015,   6,   2,  18,    2,    1 }, // 0x69 'i'
+  {  3025,   6,   4,  24,    0,    1 }, // 0x6A 'j'
+  {  3041,  12,  10,  17,    2,    2 }, // 0x6B 'k'
+  {  3106,   6,   2,  18,    2,    1 }, // 0x6C 'l'
+  {  3110,  22,  18,  13,    2,    6 }, // 0x6D 'm'
+  {  3146,  15,  11,  13,    2,    6 }, // 0x6E 'n'
+  {  3172,  15,  13,  13,    1,    6 }, // 0x6F 'o'
+  {  3220,  15,  12,  18,    2,    6 }, // 0x70 'p'
+  {  3280,  15,  12,  18,    1,    6 }, // 0x71 'q'
+  {  3340,   8,   6,  13,    2,    6 }, // 0x72 'r'
+  {  3355,  12,  10,  13,    1,    6 }, // 0x73 's'
+  {  3402,   7,   6,  17,    0,    2 }, // 0x74 't'
+  {  3420,  14,  11,  13,    2,    6 }, // 0x75 'u'
+  {  3446,  12,  11,  13,    0,    6 }, // 0x76 'v'
+  {  3477,  18,  17,  13,    0,    6 }, // 0x77 'w'
+  {  3529,  13,  11,  13,    1,    6 }, // 0x78 'x'
+  {  3588,  13,  13,  19,    0,    6 }, // 0x79 'y'
+  {  3633,  12,  10,  13,    1,    6 }, // 0x7A 'z'
+  {  3668,  13,   8,  25,    3,    0 }, // 0x7B '{'
+  {  3697,  13,   2,  25,    5,    0 }, // 0x7C '|'
+  {  3701,  13,   8,  25,    2,    0 }, // 0x7D '}'
+  {  3730,  15,  14,   5,    1,    1 }, // 0x7E '~'
+  {  3757,   1,   0,   0,    0,    0 }, // 0x7F
+};
+
+const tftSpanFont Font4spans PROGMEM = {
+  Font4spansRows, Font4spansGlyphs, 0x20, 0x7F, 26, 19
+};
@@ -0,0 +1,245 @@
+// Font 8 as span encoded glyphs, generated by tools/font_compiler:
+//   ./font_compiler --out ../../lib/TFT_eSPI/Fonts/Spans/Font8spans.h 8
+// Register it with tft.setSpanFont(font, &Font8spans)
+
+const uint8_t Font8spansRows[] PROGMEM = {
+  // 0x2D '-'
+  0x01, 0x00, 0x12, 0x85,
+  // 0x2E '.'
+  0x01, 0x00, 0x09, 0x87,
+  // 0x30 '0'
+  0x01, 0x11, 0x0B, 0x01, 0x0E, 0x11, 0x01, 0x0C, 0x15, 0x01, 0x0A, 0x19, 0x01, 0x09, 0x1B, 0x01,
+  0x08, 0x1D, 0x01, 0x07, 0x1F, 0x01, 0x06, 0x21, 0x02, 0x06, 0x0D, 0x07, 0x0D, 0x02, 0x05, 0x0C,
+  0x0B, 0x0C, 0x02, 0x04, 0x0B, 0x0F, 0x0A, 0x02, 0x04, 0x0A, 0x11, 0x0A, 0x02, 0x04, 0x09, 0x13,
+  0x09, 0x02, 0x03, 0x0A, 0x13, 0x0A, 0x02, 0x03, 0x09, 0x15, 0x09, 0x02, 0x02, 0x0A, 0x15, 0x09,
+  0x02, 0x02, 0x09, 0x17, 0x09, 0x81, 0x02, 0x01, 0x09, 0x19, 0x09, 0x84, 0x02, 0x00, 0x09, 0x1B,
+  0x09, 0x92, 0x02, 0x01, 0x09, 0x19, 0x09, 0x84, 0x02, 0x02, 0x09, 0x17, 0x09, 0x81, 0x02, 0x02,
+  0x0A, 0x15, 0x0A, 0x02, 0x03, 0x09, 0x15, 0x09, 0x02, 0x03, 0x0A, 0x13, 0x0A, 0x02, 0x04, 0x09,
+  0x13, 0x09, 0x02, 0x04, 0x0A, 0x11, 0x0A, 0x02, 0x04, 0x0B, 0x0F, 0x0B, 0x02, 0x05, 0x0C, 0x0B,
+  0x0C, 0x02, 0x06, 0x0D, 0x07, 0x0D, 0x01, 0x06, 0x21, 0x01, 0x07, 0x1F, 0x01, 0x08, 0x1D, 0x01,
+  0x09, 0x1B, 0x01, 0x0A, 0x19, 0x01, 0x0C, 0x15, 0x01, 0x0E, 0x11, 0x01, 0x11, 0x0B,
+  // 0x31 '1'
+  0x01, 0x13, 0x06, 0x01, 0x12, 0x07, 0x80, 0x01, 0x11, 0x08, 0x01, 0x10, 0x09, 0x80, 0x01, 0x0F,
+  0x0A, 0x01, 0x0E, 0x0B, 0x01, 0x0D, 0x0C, 0x01, 0x0C, 0x0D, 0x01, 0x0A, 0x0F, 0x01, 0x09, 0x10,
+  0x01, 0x08, 0x11, 0x01, 0x07, 0x12, 0x01, 0x05, 0x14, 0x01, 0x03, 0x16, 0x02, 0x01, 0x0E, 0x01,
+  0x09, 0x02, 0x00, 0x0D, 0x03, 0x09, 0x02, 0x00, 0x0C, 0x04, 0x09, 0x02, 0x00, 0x0B, 0x05, 0x09,
+  0x02, 0x00, 0x09, 0x07, 0x09, 0x02, 0x00, 0x08, 0x08, 0x09, 0x02, 0x00, 0x06, 0x0A, 0x09, 0x02,
+  0x00, 0x04, 0x0C, 0x09, 0x02, 0x00, 0x02, 0x0E, 0x09, 0x01, 0x10, 0x09, 0xAA,
+  // 0x32 '2'
+  0x01, 0x11, 0x0B, 0x01, 0x0D, 0x13, 0x01, 0x0B, 0x17, 0x01, 0x09, 0x1B, 0x01, 0x08, 0x1D, 0x01,
+  0x07, 0x1F, 0x01, 0x06, 0x21, 0x01, 0x05, 0x23, 0x02, 0x04, 0x0F, 0x08, 0x0E, 0x02, 0x04, 0x0C,
+  0x0D, 0x0D, 0x02, 0x03, 0x0B, 0x11, 0x0B, 0x02, 0x03, 0x0A, 0x13, 0x0B, 0x02, 0x02, 0x0A, 0x15,
+  0x0A, 0x80, 0x02, 0x02, 0x09, 0x17, 0x0A, 0x80, 0x02, 0x01, 0x09, 0x19, 0x09, 0x81, 0x02, 0x05,
+  0x05, 0x19, 0x09, 0x01, 0x23, 0x09, 0x81, 0x01, 0x22, 0x0A, 0x01, 0x22, 0x09, 0x01, 0x21, 0x0A,
+  0x80, 0x01, 0x20, 0x0A, 0x80, 0x01, 0x1F, 0x0A, 0x01, 0x1E, 0x0B, 0x01, 0x1D, 0x0B, 0x01, 0x1C,
+  0x0C, 0x01, 0x1B, 0x0C, 0x01, 0x1A, 0x0C, 0x01, 0x19, 0x0C, 0x01, 0x18, 0x0C, 0x01, 0x17, 0x0D,
+  0x01, 0x16, 0x0D, 0x01, 0x15, 0x0D, 0x01, 0x14, 0x0D, 0x01, 0x13, 0x0D, 0x01, 0x11, 0x0D, 0x01,
+  0x10, 0x0D, 0x01, 0x0F, 0x0D, 0x01, 0x0E, 0x0D, 0x01, 0x0D, 0x0D, 0x01, 0x0B, 0x0E, 0x01, 0x0A,
+  0x0E, 0x01, 0x09, 0x0D, 0x01, 0x08, 0x0D, 0x01, 0x07, 0x0D, 0x01, 0x07, 0x0C, 0x01, 0x06, 0x0C,
+  0x01, 0x05, 0x0B, 0x01, 0x04, 0x0B, 0x01, 0x04, 0x0A, 0x01, 0x03, 0x0B, 0x01, 0x03, 0x0A, 0x01,
+  0x02, 0x0A, 0x01, 0x02, 0x2B, 0x01, 0x01, 0x2C, 0x81, 0x01, 0x00, 0x2D, 0x83,
+  // 0x33 '3'
+  0x01, 0x10, 0x0A, 0x01, 0x0D, 0x11, 0x01, 0x0B, 0x15, 0x01, 0x09, 0x18, 0x01, 0x08, 0x1B, 0x01,
+  0x07, 0x1D, 0x01, 0x06, 0x1F, 0x01, 0x05, 0x21, 0x02, 0x05, 0x0D, 0x07, 0x0D, 0x02, 0x04, 0x0C,
+  0x0B, 0x0C, 0x02, 0x03, 0x0B, 0x0F, 0x0A, 0x02, 0x03, 0x0A, 0x11, 0x0A, 0x02, 0x03, 0x09, 0x13,
+  0x09, 0x02, 0x02, 0x0A, 0x13, 0x0A, 0x02, 0x02, 0x09, 0x15, 0x09, 0x80, 0x02, 0x01, 0x0A, 0x15,
+  0x09, 0x02, 0x01, 0x09, 0x16, 0x09, 0x02, 0x05, 0x05, 0x16, 0x09, 0x01, 0x20, 0x09, 0x80, 0x01,
+  0x1F, 0x09, 0x80, 0x01, 0x1E, 0x0A, 0x01, 0x1D, 0x0A, 0x01, 0x1C, 0x0A, 0x01, 0x1A, 0x0C, 0x01,
+  0x18, 0x0D, 0x01, 0x12, 0x12, 0x01, 0x12, 0x10, 0x01, 0x12, 0x0E, 0x01, 0x12, 0x10, 0x01, 0x11,
+  0x13, 0x01, 0x11, 0x15, 0x01, 0x11, 0x16, 0x02, 0x11, 0x02, 0x08, 0x0D, 0x01, 0x1D, 0x0C, 0x01,
+  0x1F, 0x0B, 0x01, 0x20, 0x0A, 0x01, 0x21, 0x0A, 0x01, 0x22, 0x0A, 0x80, 0x01, 0x23, 0x09, 0x01,
+  0x23, 0x0A, 0x01, 0x24, 0x09, 0x84, 0x02, 0x04, 0x05, 0x1B, 0x09, 0x02, 0x00, 0x09, 0x1B, 0x09,
+  0x02, 0x00, 0x0A, 0x19, 0x0A, 0x02, 0x00, 0x0A, 0x19, 0x09, 0x02, 0x01, 0x09, 0x19, 0x09, 0x02,
+  0x01, 0x0A, 0x17, 0x0A, 0x02, 0x01, 0x0A, 0x16, 0x0A, 0x02, 0x02, 0x0A, 0x15, 0x0A, 0x02, 0x02,
+  0x0B, 0x13, 0x0A, 0x02, 0x03, 0x0B, 0x11, 0x0B, 0x02, 0x03, 0x0C, 0x0E, 0x0C, 0x02, 0x04, 0x0E,
+  0x08, 0x0E, 0x01, 0x05, 0x23, 0x01, 0x06, 0x21, 0x01, 0x07, 0x1E, 0x01, 0x08, 0x1C, 0x01, 0x09,
+  0x1A, 0x01, 0x0B, 0x16, 0x01, 0x0D, 0x12, 0x01, 0x11, 0x0A,
+  // 0x34 '4'
+  0x01, 0x21, 0x07, 0x01, 0x20, 0x08, 0x01, 0x1F, 0x09, 0x01, 0x1E, 0x0A, 0x80, 0x01, 0x1D, 0x0B,
+  0x01, 0x1C, 0x0C, 0x01, 0x1B, 0x0D, 0x01, 0x1A, 0x0E, 0x80, 0x01, 0x19, 0x0F, 0x01, 0x18, 0x10,
+  0x01, 0x17, 0x11, 0x80, 0x01, 0x16, 0x12, 0x01, 0x15, 0x13, 0x01, 0x14, 0x14, 0x80, 0x02, 0x13,
+  0x0B, 0x01, 0x09, 0x02, 0x12, 0x0B, 0x02, 0x09, 0x02, 0x11, 0x0B, 0x03, 0x09, 0x02, 0x10, 0x0C,
+  0x03, 0x09, 0x02, 0x10, 0x0B, 0x04, 0x09, 0x02, 0x0F, 0x0B, 0x05, 0x09, 0x02, 0x0E, 0x0B, 0x06,
+  0x09, 0x02, 0x0D, 0x0B, 0x07, 0x09, 0x80, 0x02, 0x0C, 0x0B, 0x08, 0x09, 0x02, 0x0B, 0x0B, 0x09,
+  0x09, 0x02, 0x0A, 0x0B, 0x0A, 0x09, 0x80, 0x02, 0x09, 0x0B, 0x0B, 0x09, 0x02, 0x08, 0x0B, 0x0C,
+  0x09, 0x02, 0x07, 0x0B, 0x0D, 0x09, 0x80, 0x02, 0x06, 0x0B, 0x0E, 0x09, 0x02, 0x05, 0x0B, 0x0F,
+  0x09, 0x02, 0x04, 0x0B, 0x10, 0x09, 0x02, 0x03, 0x0C, 0x10, 0x09, 0x02, 0x03, 0x0B, 0x11, 0x09,
+  0x02, 0x02, 0x0B, 0x12, 0x09, 0x02, 0x01, 0x0B, 0x13, 0x09, 0x02, 0x00, 0x0B, 0x14, 0x09, 0x01,
+  0x00, 0x30, 0x87, 0x01, 0x1F, 0x09, 0x8E,
+  // 0x35 '5'
+  0x01, 0x08, 0x21, 0x80, 0x01, 0x07, 0x22, 0x83, 0x01, 0x06, 0x23, 0x80, 0x01, 0x06, 0x09, 0x81,
+  0x01, 0x05, 0x0A, 0x01, 0x05, 0x09, 0x82, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x09, 0x82, 0x02, 0x03,
+  0x0A, 0x07, 0x09, 0x02, 0x03, 0x0A, 0x04, 0x0F, 0x02, 0x03, 0x09, 0x03, 0x13, 0x02, 0x03, 0x09,
+  0x01, 0x17, 0x01, 0x03, 0x22, 0x01, 0x02, 0x24, 0x01, 0x02, 0x25, 0x01, 0x02, 0x26, 0x02, 0x02,
+  0x10, 0x08, 0x0F, 0x02, 0x02, 0x0D, 0x0E, 0x0D, 0x02, 0x01, 0x0C, 0x12, 0x0B, 0x02, 0x01, 0x0B,
+  0x14, 0x0B, 0x02, 0x01, 0x0A, 0x16, 0x0A, 0x02, 0x05, 0x05, 0x18, 0x0A, 0x01, 0x22, 0x0A, 0x01,
+  0x23, 0x09, 0x80, 0x01, 0x23, 0x0A, 0x01, 0x24, 0x09, 0x87, 0x02, 0x04, 0x05, 0x1B, 0x09, 0x02,
+  0x00, 0x09, 0x1A, 0x09, 0x02, 0x00, 0x0A, 0x19, 0x09, 0x80, 0x02, 0x01, 0x09, 0x18, 0x0A, 0x02,
+  0x01, 0x0A, 0x17, 0x09, 0x02, 0x01, 0x0A, 0x16, 0x0A, 0x02, 0x02, 0x0A, 0x14, 0x0A, 0x02, 0x02,
+  0x0B, 0x12, 0x0B, 0x02, 0x02, 0x0C, 0x10, 0x0B, 0x02, 0x03, 0x0C, 0x0E, 0x0B, 0x02, 0x04, 0x0E,
+  0x08, 0x0E, 0x01, 0x04, 0x23, 0x01, 0x05, 0x21, 0x01, 0x06, 0x1F, 0x01, 0x08, 0x1C, 0x01, 0x09,
+  0x19, 0x01, 0x0B, 0x16, 0x01, 0x0D, 0x11, 0x01, 0x10, 0x0B,
+  // 0x36 '6'
+  0x01, 0x14, 0x0A, 0x01, 0x10, 0x11, 0x01, 0x0E, 0x16, 0x01, 0x0C, 0x19, 0x01, 0x0B, 0x1B, 0x01,
+  0x0A, 0x1D, 0x01, 0x09, 0x1F, 0x01, 0x08, 0x21, 0x02, 0x07, 0x0E, 0x07, 0x0E, 0x02, 0x06, 0x0C,
+  0x0C, 0x0C, 0x02, 0x06, 0x0B, 0x0F, 0x0B, 0x02, 0x05, 0x0A, 0x12, 0x0A, 0x02, 0x04, 0x0B, 0x13,
+  0x0A, 0x02, 0x04, 0x0A, 0x14, 0x0A, 0x02, 0x04, 0x09, 0x16, 0x09, 0x02, 0x03, 0x0A, 0x16, 0x0A,
+  0x02, 0x03, 0x09, 0x17, 0x0A, 0x02, 0x02, 0x0A, 0x18, 0x09, 0x02, 0x02, 0x09, 0x19, 0x05, 0x01,
+  0x02, 0x09, 0x01, 0x02, 0x08, 0x01, 0x01, 0x09, 0x81, 0x02, 0x01, 0x09, 0x0B, 0x09, 0x02, 0x01,
+  0x08, 0x09, 0x0F, 0x02, 0x01, 0x08, 0x07, 0x13, 0x02, 0x00, 0x09, 0x05, 0x17, 0x02, 0x00, 0x09,
+  0x04, 0x19, 0x02, 0x00, 0x09, 0x03, 0x1B, 0x02, 0x00, 0x09, 0x02, 0x1D, 0x02, 0x00, 0x09, 0x01,
+  0x1F, 0x02, 0x00, 0x13, 0x08, 0x0F, 0x02, 0x00, 0x11, 0x0D, 0x0D, 0x02, 0x00, 0x0F, 0x11, 0x0B,
+  0x02, 0x00, 0x0E, 0x13, 0x0B, 0x02, 0x00, 0x0D, 0x15, 0x0A, 0x02, 0x00, 0x0C, 0x17, 0x0A, 0x02,
+  0x00, 0x0B, 0x18, 0x0A, 0x02, 0x00, 0x0A, 0x1A, 0x09, 0x80, 0x02, 0x00, 0x0A, 0x1A, 0x0A, 0x02,
+  0x00, 0x09, 0x1C, 0x09, 0x82, 0x02, 0x01, 0x08, 0x1C, 0x09, 0x82, 0x02, 0x01, 0x09, 0x1B, 0x09,
+  0x02, 0x02, 0x08, 0x1A, 0x0A, 0x02, 0x02, 0x08, 0x1A, 0x09, 0x02, 0x02, 0x09, 0x19, 0x09, 0x02,
+  0x02, 0x09, 0x18, 0x0A, 0x02, 0x03, 0x09, 0x17, 0x09, 0x02, 0x03, 0x09, 0x16, 0x0A, 0x02, 0x04,
+  0x09, 0x15, 0x0A, 0x02, 0x04, 0x0A, 0x13, 0x0A, 0x02, 0x05, 0x0A, 0x11, 0x0B, 0x02, 0x05, 0x0C,
+  0x0D, 0x0C, 0x02, 0x06, 0x0D, 0x08, 0x0E, 0x01, 0x07, 0x22, 0x01, 0x08, 0x20, 0x01, 0x09, 0x1E,
+  0x01, 0x0A, 0x1C, 0x01, 0x0C, 0x18, 0x01, 0x0D, 0x16, 0x01, 0x10, 0x10, 0x01, 0x13, 0x0A,
+  // 0x37 '7'
+  0x01, 0x00, 0x2C, 0x86, 0x01, 0x00, 0x2B, 0x01, 0x23, 0x07, 0x01, 0x22, 0x07, 0x01, 0x21, 0x08,
+  0x01, 0x20, 0x08, 0x01, 0x1F, 0x08, 0x01, 0x1E, 0x08, 0x80, 0x01, 0x1D, 0x08, 0x01, 0x1C, 0x08,
+  0x80, 0x01, 0x1B, 0x08, 0x01, 0x1A, 0x09, 0x01, 0x1A, 0x08, 0x01, 0x19, 0x08, 0x01, 0x18, 0x09,
+  0x01, 0x18, 0x08, 0x01, 0x17, 0x09, 0x01, 0x17, 0x08, 0x01, 0x16, 0x09, 0x01, 0x15, 0x09, 0x80,
+  0x01, 0x14, 0x09, 0x80, 0x01, 0x13, 0x09, 0x80, 0x01, 0x12, 0x09, 0x81, 0x01, 0x11, 0x09, 0x80,
+  0x01, 0x10, 0x09, 0x81, 0x01, 0x0F, 0x09, 0x81, 0x01, 0x0E, 0x09, 0x81, 0x01, 0x0D, 0x09, 0x82,
+  0x01, 0x0C, 0x09, 0x82, 0x01, 0x0B, 0x09, 0x84, 0x01, 0x0A, 0x0A, 0x01, 0x0A, 0x09, 0x83,
+  // 0x38 '8'
+  0x01, 0x11, 0x0A, 0x01, 0x0D, 0x12, 0x01, 0x0B, 0x16, 0x01, 0x09, 0x1A, 0x01, 0x08, 0x1C, 0x01,
+  0x07, 0x1E, 0x01, 0x06, 0x20, 0x01, 0x05, 0x22, 0x02, 0x04, 0x0E, 0x08, 0x0D, 0x02, 0x04, 0x0C,
+  0x0C, 0x0C, 0x02, 0x03, 0x0B, 0x10, 0x0B, 0x02, 0x03, 0x0A, 0x12, 0x0A, 0x02, 0x03, 0x09, 0x14,
+  0x09, 0x02, 0x02, 0x0A, 0x14, 0x0A, 0x02, 0x02, 0x09, 0x16, 0x09, 0x85, 0x02, 0x03, 0x09, 0x14,
+  0x09, 0x80, 0x02, 0x03, 0x0A, 0x12, 0x0A, 0x02, 0x04, 0x0A, 0x10, 0x0A, 0x02, 0x05, 0x0A, 0x0E,
+  0x0A, 0x02, 0x06, 0x0C, 0x08, 0x0D, 0x01, 0x07, 0x1E, 0x01, 0x08, 0x1C, 0x01, 0x0A, 0x18, 0x01,
+  0x0C, 0x14, 0x01, 0x0A, 0x17, 0x01, 0x08, 0x1B, 0x01, 0x07, 0x1E, 0x01, 0x06, 0x20, 0x02, 0x05,
+  0x0D, 0x08, 0x0D, 0x02, 0x04, 0x0B, 0x0D, 0x0C, 0x02, 0x03, 0x0B, 0x10, 0x0B, 0x02, 0x02, 0x0B,
+  0x12, 0x0A, 0x02, 0x02, 0x0A, 0x14, 0x0A, 0x02, 0x01, 0x0A, 0x16, 0x09, 0x02, 0x01, 0x0A, 0x16,
+  0x0A, 0x02, 0x01, 0x09, 0x18, 0x09, 0x80, 0x02, 0x00, 0x09, 0x1A, 0x09, 0x87, 0x02, 0x00, 0x0A,
+  0x18, 0x0A, 0x02, 0x01, 0x09, 0x18, 0x09, 0x02, 0x01, 0x0A, 0x16, 0x0A, 0x80, 0x02, 0x02, 0x0A,
+  0x14, 0x0A, 0x02, 0x02, 0x0B, 0x12, 0x0B, 0x02, 0x03, 0x0B, 0x10, 0x0B, 0x02, 0x03, 0x0D, 0x0D,
+  0x0C, 0x02, 0x04, 0x0E, 0x08, 0x0E, 0x01, 0x05, 0x22, 0x01, 0x06, 0x20, 0x01, 0x07, 0x1E, 0x01,
+  0x08, 0x1C, 0x01, 0x09, 0x1A, 0x01, 0x0B, 0x16, 0x01, 0x0D, 0x12, 0x01, 0x11, 0x0A,
+  // 0x39 '9'
+  0x01, 0x11, 0x09, 0x01, 0x0D, 0x11, 0x01, 0x0B, 0x15, 0x01, 0x0A, 0x18, 0x01, 0x08, 0x1B, 0x01,
+  0x07, 0x1D, 0x01, 0x06, 0x1F, 0x01, 0x05, 0x21, 0x02, 0x04, 0x0F, 0x08, 0x0C, 0x02, 0x04, 0x0D,
+  0x0C, 0x0B, 0x02, 0x03, 0x0C, 0x10, 0x09, 0x02, 0x03, 0x0B, 0x12, 0x09, 0x02, 0x02, 0x0B, 0x14,
+  0x09, 0x02, 0x02, 0x0A, 0x15, 0x09, 0x02, 0x01, 0x0A, 0x17, 0x08, 0x02, 0x01, 0x0A, 0x18, 0x08,
+  0x02, 0x01, 0x09, 0x19, 0x08, 0x80, 0x02, 0x00, 0x0A, 0x1A, 0x08, 0x02, 0x00, 0x09, 0x1B, 0x08,
+  0x83, 0x02, 0x00, 0x09, 0x1B, 0x09, 0x82, 0x02, 0x00, 0x0A, 0x19, 0x0A, 0x02, 0x01, 0x09, 0x19,
+  0x0A, 0x80, 0x02, 0x01, 0x0A, 0x17, 0x0B, 0x80, 0x02, 0x02, 0x0A, 0x15, 0x0C, 0x02, 0x02, 0x0B,
+  0x13, 0x0D, 0x02, 0x03, 0x0B, 0x11, 0x0E, 0x02, 0x03, 0x0D, 0x0D, 0x10, 0x02, 0x04, 0x0F, 0x08,
+  0x12, 0x02, 0x05, 0x1E, 0x01, 0x09, 0x02, 0x06, 0x1C, 0x02, 0x09, 0x02, 0x07, 0x1A, 0x03, 0x09,
+  0x02, 0x08, 0x18, 0x04, 0x09, 0x02, 0x09, 0x16, 0x05, 0x09, 0x02, 0x0A, 0x13, 0x07, 0x08, 0x02,
+  0x0C, 0x0F, 0x09, 0x08, 0x02, 0x0F, 0x09, 0x0B, 0x09, 0x01, 0x23, 0x09, 0x81, 0x01, 0x23, 0x08,
+  0x01, 0x22, 0x09, 0x02, 0x05, 0x05, 0x18, 0x09, 0x02, 0x01, 0x09, 0x18, 0x09, 0x02, 0x01, 0x0A,
+  0x16, 0x09, 0x80, 0x02, 0x02, 0x09, 0x15, 0x0A, 0x02, 0x02, 0x0A, 0x14, 0x09, 0x02, 0x02, 0x0A,
+  0x13, 0x0A, 0x02, 0x03, 0x0A, 0x11, 0x0A, 0x02, 0x03, 0x0B, 0x0F, 0x0B, 0x02, 0x03, 0x0C, 0x0C,
+  0x0C, 0x02, 0x04, 0x0D, 0x08, 0x0D, 0x01, 0x05, 0x20, 0x01, 0x05, 0x1F, 0x01, 0x06, 0x1D, 0x01,
+  0x07, 0x1B, 0x01, 0x09, 0x18, 0x01, 0x0A, 0x15, 0x01, 0x0C, 0x11, 0x01, 0x0F, 0x0A,
+  // 0x3A ':'
+  0x01, 0x00, 0x09, 0x87, 0x00, 0x9E, 0x01, 0x00, 0x09, 0x87,
+};
+
+const tftSpanGlyph Font8spansGlyphs[] PROGMEM = {
+  {     0,  29,   0,   0,    0,    0 }, // 0x20 ' '
+  {     0,  29,   0,   0,    0,    0 }, // 0x21 '!'
+  {     0,  29,   0,   0,    0,    0 }, // 0x22 '"'
+  {     0,  29,   0,   0,    0,    0 }, // 0x23 '#'
+  {     0,  29,   0,   0,    0,    0 }, // 0x24 '$'
+  {     0,  29,   0,   0,    0,    0 }, // 0x25 '%'
+  {     0,  29,   0,   0,    0,    0 }, // 0x26 '&'
+  {     0,  29,   0,   0,    0,    0 }, // 0x27 '''
+  {     0,  29,   0,   0,    0,    0 }, // 0x28 '('
+  {     0,  29,   0,   0,    0,    0 }, // 0x29 ')'
+  {     0,  29,   0,   0,    0,    0 }, // 0x2A '*'
+  {     0,  29,   0,   0,    0,    0 }, // 0x2B '+'
+  {     0,  29,   0,   0,    0,    0 }, // 0x2C ','
+  {     0,  29,  18,   7,    6,   37 }, // 0x2D '-'
+  {     4,  29,   9,   9,    9,   64 }, // 0x2E '.'
+  {     8,  29,   0,   0,    0,    0 }, // 0x2F '/'
+  {     8,  55,  45,  70,    4,    4 }, // 0x30 '0'
+  {   166,  55,  25,  69,   10,    4 }, // 0x31 '1'
+  {   259,  55,  45,  69,    3,    4 }, // 0x32 '2'
+  {   448,  55,  45,  70,    4,    4 }, // 0x33 '3'
+  {   682,  55,  48,  68,    1,    5 }, // 0x34 '4'
+  {   849,  55,  45,  69,    4,    5 }, // 0x35 '5'
+  {  1035,  55,  46,  70,    3,    4 }, // 0x36 '6'
+  {  1306,  55,  44,  68,    5,    5 }, // 0x37 '7'
+  {  1417,  55,  44,  70,    4,    4 }, // 0x38 '8'
+  {  1639,  55,  45,  70,    4,    4 }, // 0x39 '9'
+  {  1893,  29,   9,  50,    9,   23 }, // 0x3A ':'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x3B ';'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x3C '<'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x3D '='
+  {  1903,  29,   0,   0,    0,    0 }, // 0x3E '>'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x3F '?'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x40 '@'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x41 'A'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x42 'B'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x43 'C'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x44 'D'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x45 'E'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x46 'F'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x47 'G'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x48 'H'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x49 'I'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x4A 'J'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x4B 'K'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x4C 'L'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x4D 'M'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x4E 'N'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x4F 'O'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x50 'P'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x51 'Q'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x52 'R'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x53 'S'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x54 'T'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x55 'U'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x56 'V'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x57 'W'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x58 'X'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x59 'Y'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x5A 'Z'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x5B '['
+  {  1903,  29,   0,   0,    0,    0 }, // 0x5C
+  {  1903,  29,   0,   0,    0,    0 }, // 0x5D ']'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x5E '^'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x5F '_'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x60 '`'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x61 'a'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x62 'b'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x63 'c'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x64 'd'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x65 'e'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x66 'f'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x67 'g'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x68 'h'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x69 'i'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x6A 'j'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x6B 'k'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x6C 'l'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x6D 'm'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x6E 'n'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x6F 'o'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x70 'p'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x71 'q'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x72 'r'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x73 's'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x74 't'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x75 'u'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x76 'v'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x77 'w'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x78 'x'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x79 'y'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x7A 'z'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x7B '{'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x7C '|'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x7D '}'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x7E '~'
+  {  1903,  29,   0,   0,    0,    0 }, // 0x7F
+};
+
+const tftSpanFont Font8spans PROGMEM = {
+  Font8spansRows, Font8spansGlyphs, 0x20, 0x7F, 75, 73
+};
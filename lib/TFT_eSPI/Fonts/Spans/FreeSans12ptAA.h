@@ -0,0 +1,768 @@
+// FreeSans24pt7b at 1/2 size as 4 bit alpha glyphs, generated by tools/font_compiler:
+//   ./font_compiler --aa 2 --name FreeSans12ptAA --out ../../lib/TFT_eSPI/Fonts/Spans/FreeSans12ptAA.h FreeSans24pt7b
+// Register it with tft.setSpanFont(font, &FreeSans12ptAA)
+
+const uint8_t FreeSans12ptAARows[] PROGMEM = {
+  // 0x21 '!'
+  0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x88, 0x88, 0x44, 0x00, 0xFF,
+  0xFF, 0x88,
+  // 0x22 '"'
+  0xFF, 0x08, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x08, 0xF8, 0xBB, 0x04, 0xF4, 0x88,
+  0x00, 0xF0,
+  // 0x23 '#'
+  0x00, 0x00, 0x08, 0x40, 0x04, 0x84, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x08, 0xF4, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x0F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x08, 0x8B, 0xFB, 0x88, 0xBF, 0x88,
+  0x40, 0x00, 0x08, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x0B, 0xF0, 0x00, 0xFB, 0x00, 0x00, 0x48, 0x8F, 0xF8, 0x88, 0xFB, 0x88, 0x00, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0x80, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x8F, 0x80, 0x00, 0x00,
+  // 0x24 '$'
+  0x00, 0x00, 0x4B, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0x04, 0xFF, 0xBB, 0xF8,
+  0xFF, 0x40, 0x0B, 0xFB, 0x08, 0xF0, 0x4F, 0xB0, 0x0F, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x0F, 0xF0,
+  0x08, 0xF0, 0x04, 0x80, 0x0F, 0xF4, 0x08, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0x88, 0xF0, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xF8,
+  0xBF, 0xF4, 0x00, 0x00, 0x08, 0xF0, 0x0B, 0xFB, 0x48, 0x00, 0x08, 0xF0, 0x00, 0xFF, 0x8F, 0x40,
+  0x08, 0xF0, 0x00, 0xFF, 0x4F, 0xB0, 0x08, 0xF0, 0x04, 0xFB, 0x0F, 0xF8, 0x08, 0xF0, 0x0B, 0xF8,
+  0x04, 0xFF, 0xBB, 0xF8, 0xFF, 0xB0, 0x00, 0x48, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00,
+  // 0x25 '%'
+  0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF4, 0x00, 0x00,
+  0x0B, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x8B, 0xFF, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x8F, 0x40,
+  0x00, 0x4F, 0x80, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x80, 0x08, 0xF4, 0x00,
+  0x00, 0x00, 0x8F, 0x40, 0x00, 0x4F, 0x80, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x8B, 0xFF,
+  0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x88, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0xBF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x04, 0xF8, 0x00, 0xBF, 0x80, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xF8, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0xBB,
+  0x00, 0x00, 0xBF, 0x80, 0x08, 0xFB, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x40,
+  // 0x26 '&'
+  0x00, 0x04, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF,
+  0xB0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B,
+  0xFB, 0x04, 0xFB, 0x00, 0x8F, 0x80, 0x8F, 0xB0, 0x00, 0xBF, 0xB0, 0xFF, 0x40, 0xFF, 0x00, 0x00,
+  0x0B, 0xFF, 0xFB, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF,
+  0xFB, 0x00, 0x8F, 0xF8, 0x00, 0x4B, 0xFB, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xF4,
+  0x00, 0x8F, 0xFF, 0xB4, 0x00, 0x08, 0x84,
+  // 0x27 '''
+  0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x88,
+  // 0x28 '('
+  0x00, 0x00, 0x84, 0x00, 0x04, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x8F, 0x40, 0x00, 0xFB, 0x00, 0x04,
+  0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xB0, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80,
+  0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x0F, 0xF0, 0x00,
+  0x0B, 0xF0, 0x00, 0x08, 0xF8, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x04, 0xF0, 0x00, 0x00, 0x84,
+  // 0x29 ')'
+  0x84, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x04, 0xF8, 0x00, 0x00,
+  0xFB, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x4F, 0xB0, 0x00, 0x8F, 0x80,
+  0x00, 0x8F, 0x40, 0x00, 0xFF, 0x00, 0x04, 0xF8, 0x00, 0x08, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x8B,
+  0x00, 0x00, 0x84, 0x00, 0x00,
+  // 0x2A '*'
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x44, 0x0F, 0x04, 0x40, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0xBF, 0xB0, 0x00, 0x04, 0xF8, 0xF4, 0x00, 0x0B, 0xB0, 0xBF, 0x00, 0x00, 0x40, 0x40, 0x00,
+  // 0x2B '+'
+  0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00,
+  // 0x2C ','
+  0xFF, 0xFF, 0x8F, 0x0F, 0x4B, 0xF4,
+  // 0x2D '-'
+  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8,
+  // 0x2E '.'
+  0xFF, 0xFF, 0x88,
+  // 0x2F '/'
+  0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0xB8, 0x00,
+  0x00, 0x00, 0xF4, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
+  0x08, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00,
+  0x8B, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+  // 0x30 '0'
+  0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFB, 0x40, 0x4B,
+  0xFB, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0xBF, 0x40,
+  0x00, 0x00, 0x4F, 0xB0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x00, 0x4F, 0xB0, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x4F, 0xF0,
+  0x00, 0x00, 0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x4B, 0xFB, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+  // 0x31 '1'
+  0x00, 0x00, 0x4F, 0x00, 0x00, 0xBF, 0x00, 0x8B, 0xFF, 0x8F, 0xFF, 0xFF, 0x48, 0x88, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x88,
+  // 0x32 '2'
+  0x00, 0x4B, 0xFF, 0xFB, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x4F, 0xF8, 0x00, 0x08,
+  0xFF, 0x80, 0xBF, 0x80, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x88, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40,
+  0x00, 0x00, 0x04, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0x80,
+  0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x80,
+  // 0x33 '3'
+  0x00, 0x08, 0xBF, 0xFF, 0x84, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x00,
+  0xBF, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0x40,
+  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0,
+  0x00, 0x00, 0x08, 0xFB, 0x0B, 0xFB, 0x40, 0x00, 0x8F, 0xF4, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+  0x00, 0x08, 0xFF, 0xFF, 0x84, 0x00,
+  // 0x34 '4'
+  0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xB8, 0xF8, 0x00, 0x00, 0x00,
+  0xFF, 0x08, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x08, 0xF8, 0x00, 0x00, 0x8F, 0x80, 0x08, 0xF8, 0x00,
+  0x04, 0xFB, 0x00, 0x08, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x08, 0xF8, 0x00, 0x8F, 0xB8, 0x88, 0x8B,
+  0xFB, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x88, 0x88, 0x8B, 0xFB, 0x88, 0x00, 0x00,
+  0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x84, 0x00,
+  // 0x35 '5'
+  0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0,
+  0x88, 0x84, 0x00, 0x00, 0x8F, 0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x8F, 0xFB, 0x88, 0x8F, 0xFB, 0x00,
+  0x48, 0x40, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x88, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x80,
+  0x00, 0x00, 0x8F, 0x80, 0x8F, 0xF8, 0x00, 0x08, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0x8B, 0xFF, 0xF8, 0x40, 0x00,
+  // 0x36 '6'
+  0x00, 0x08, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFB, 0x40, 0x0B,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x48, 0x40, 0xBF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x08, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0xBF, 0xFF, 0xFF, 0xFB, 0x00,
+  0xFF, 0xF8, 0x00, 0x08, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0xB0,
+  0x00, 0x00, 0xBF, 0x80, 0x0F, 0xFB, 0x00, 0x08, 0xFF, 0x40, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0x4B, 0xFF, 0xFB, 0x40, 0x00,
+  // 0x37 '7'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+  // 0x38 '8'
+  0x00, 0x4B, 0xFF, 0xFB, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x4F, 0xF8, 0x00, 0x08,
+  0xFF, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0xBF, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x4F, 0xB0,
+  0x00, 0x00, 0xFF, 0x40, 0x0B, 0xFF, 0x88, 0x8F, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xB0, 0x00,
+  0x0B, 0xFF, 0x88, 0x8F, 0xFB, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x00, 0x00,
+  0x4F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x80,
+  0x00, 0x00, 0x8F, 0xB0, 0x4F, 0xF8, 0x00, 0x08, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+  0x00, 0x4B, 0xFF, 0xFB, 0x40, 0x00,
+  // 0x39 '9'
+  0x00, 0x4B, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x4F, 0xF8, 0x00, 0x4B,
+  0xF8, 0x00, 0x8F, 0x80, 0x00, 0x04, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x80,
+  0x4F, 0xF8, 0x00, 0x4B, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x8B, 0xFF, 0xB4,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x8F, 0x80,
+  0x00, 0x04, 0xFB, 0x00, 0x4F, 0xF4, 0x00, 0x4F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0x8F, 0xFF, 0xB4, 0x00, 0x00,
+  // 0x3A ':'
+  0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x88,
+  // 0x3B ';'
+  0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8F, 0x0F, 0x4B, 0xF4,
+  // 0x3C '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x04, 0xBF,
+  0xFB, 0x80, 0x00, 0x08, 0xFF, 0xFB, 0x40, 0x00, 0x48, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xB4,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  // 0x3D '='
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8,
+  // 0x3E '>'
+  0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x40,
+  0x00, 0x00, 0x00, 0x08, 0xBF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+  0x00, 0x4B, 0xFF, 0xB8, 0x00, 0x00, 0x8F, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 0x3F '?'
+  0x00, 0x8F, 0xFF, 0xB8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x8F, 0xB4, 0x00, 0x8F, 0xF8, 0xBF,
+  0x40, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00,
+  0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xBF,
+  0xB0, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+  0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00,
+  // 0x40 '@'
+  0x00, 0x00, 0x00, 0x08, 0x8F, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x80, 0x00, 0x08, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x0B, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x04, 0xFB, 0x00, 0x00, 0x4B, 0xFF, 0xB0, 0x48, 0x40,
+  0xBF, 0xB0, 0x0F, 0xF4, 0x00, 0x0B, 0xFF, 0x88, 0xFB, 0xBF, 0x80, 0x0F, 0xF4, 0x8F, 0xB0, 0x00,
+  0xBF, 0xB0, 0x00, 0x4F, 0xFF, 0x00, 0x0B, 0xF8, 0x8F, 0x80, 0x04, 0xFB, 0x00, 0x00, 0x0F, 0xFB,
+  0x00, 0x08, 0xF8, 0xFF, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x08, 0xF8, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x8F,
+  0xB0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0xBF,
+  0x80, 0x0B, 0xFB, 0x00, 0x0B, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x8F, 0xB0, 0x04, 0xFF, 0xB8, 0xBF,
+  0xBF, 0xB8, 0xBF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x4B, 0xFF, 0x80, 0x4B, 0xFF, 0xF8, 0x00, 0x00,
+  0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB8, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x00,
+  // 0x41 'A'
+  0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF4, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x4F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x08, 0xFB, 0x00, 0x00,
+  0x00, 0x08, 0xFB, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x0F, 0xF8, 0x88, 0x88, 0xBF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0xFF, 0xB8, 0x88, 0x88, 0x8F, 0xF8, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00,
+  0x08, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+  0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80,
+  // 0x42 'B'
+  0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF, 0x88,
+  0x88, 0x88, 0xFF, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x08, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0xFF,
+  0x88, 0x88, 0x88, 0x8F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0xFF, 0x88, 0x88, 0x88, 0x8F, 0xFB, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x88, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00,
+  // 0x43 'C'
+  0x00, 0x00, 0x8B, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0xFF, 0xB4, 0x00, 0x04, 0xBF, 0xB0, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+  0x4F, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x0B, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0xFF, 0xB8, 0x00, 0x04, 0xBF, 0xF4, 0x00,
+  0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFB, 0x80, 0x00, 0x00,
+  // 0x44 'D'
+  0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x88,
+  0x88, 0x88, 0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xB0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xB0, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0xF4, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00,
+  // 0x45 'E'
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x88, 0x88, 0x88,
+  0x88, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  // 0x46 'F'
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x88, 0x88, 0x88,
+  0x88, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 0x47 'G'
+  0x00, 0x00, 0x48, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0xBF, 0xF8, 0x40, 0x00, 0x4B, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF0,
+  0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8,
+  0xFF, 0x00, 0x00, 0x00, 0x48, 0x88, 0x8B, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8,
+  0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8,
+  0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xF8, 0x40, 0x00, 0x8F, 0xFB, 0xF8,
+  0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0xF8, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0x80, 0x00, 0x84,
+  // 0x48 'H'
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80,
+  // 0x49 'I'
+  0x48, 0x40, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80,
+  0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80,
+  0x8F, 0x80, 0x48, 0x40,
+  // 0x4A 'J'
+  0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
+  0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+  0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+  0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x08,
+  0xF8, 0xFF, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x8F, 0xB4, 0x00, 0xBF, 0xF0,
+  0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x8F, 0xFF, 0xB4, 0x00,
+  // 0x4B 'K'
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0xFF, 0x00,
+  0x00, 0x00, 0x4F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x4F,
+  0xF4, 0x00, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x4F, 0xF4, 0x00, 0x00,
+  0x00, 0xFF, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x4B, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x4F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xB0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84,
+  // 0x4C 'L'
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x40,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40,
+  // 0x4D 'M'
+  0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0x8F, 0x40, 0x00, 0x00, 0x04, 0xF8, 0xFF, 0xFF, 0x4F, 0xB0, 0x00, 0x00, 0x08, 0xF4, 0xFF,
+  0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0x08, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0xFF,
+  0xFF, 0x04, 0xFB, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+  0xFF, 0x00, 0x8F, 0x80, 0x08, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x4F, 0xB0, 0x0B, 0xF4, 0x00, 0xFF,
+  0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0xFB, 0xBF, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x88,
+  // 0x4E 'N'
+  0x88, 0x40, 0x00, 0x00, 0x00, 0x08, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x8F, 0xB0, 0x00,
+  0x00, 0x0F, 0xF0, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x04, 0xFF, 0x00, 0x00, 0x0F,
+  0xF0, 0xFF, 0x00, 0xBF, 0xB0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x04, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0xFF, 0x00, 0x00,
+  0x4F, 0xF4, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x08, 0xFB, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xBF,
+  0x8F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80,
+  // 0x4F 'O'
+  0x00, 0x00, 0x48, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0xBF, 0xF8, 0x40, 0x00, 0x8B, 0xFF, 0x40, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x8F, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x8F, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x08, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x40, 0x00, 0x8B, 0xFF, 0x40, 0x00,
+  0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xB8, 0x00,
+  0x00, 0x00,
+  // 0x50 'P'
+  0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0x88, 0x88, 0x88,
+  0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB,
+  0xFF, 0x88, 0x88, 0x88, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0x88, 0x88, 0x88,
+  0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 0x51 'Q'
+  0x00, 0x00, 0x48, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4,
+  0x00, 0x00, 0x00, 0xBF, 0xF8, 0x40, 0x00, 0x8B, 0xFF, 0x40, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x8F, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x8F, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x04, 0xFB, 0x0B, 0xF8, 0x00, 0x08, 0xFF,
+  0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x40, 0x00, 0x8F, 0xFF, 0x80, 0x00,
+  0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xB8, 0x04,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00,
+  // 0x52 'R'
+  0x88, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0x88,
+  0x88, 0x88, 0x8F, 0xFB, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x80, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0xFF, 0x88, 0x88, 0x88, 0x8F, 0xF4, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xFF, 0x88, 0x88, 0x88, 0x8F, 0xFB, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80,
+  // 0x53 'S'
+  0x00, 0x08, 0xBF, 0xFF, 0xF8, 0x40, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFB,
+  0x40, 0x00, 0x48, 0xFF, 0x40, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x8F, 0x80, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0x00,
+  0x00, 0x48, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xF4, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xF8, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x4F, 0xFB, 0x80, 0x00, 0x08, 0xBF, 0xB0,
+  0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0xF8, 0x40, 0x00,
+  // 0x54 'T'
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x88, 0x88,
+  0x8B, 0xFB, 0x88, 0x88, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00,
+  // 0x55 'U'
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xF0, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x4F, 0xFB, 0x40, 0x00, 0x4B, 0xFF, 0x40,
+  0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB8, 0x00, 0x00,
+  // 0x56 'V'
+  0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+  0x0F, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x00,
+  0x04, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x4F, 0xF0, 0x00,
+  0x00, 0x8F, 0xB0, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x08, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xF0, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00,
+  // 0x57 'W'
+  0x48, 0x80, 0x00, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00, 0x08, 0x84, 0x8F, 0xF0, 0x00, 0x00, 0x08,
+  0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x4F,
+  0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x8F, 0xF0, 0x08, 0xFB, 0x00, 0x00,
+  0x4F, 0xBB, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x08, 0xFF, 0x00, 0x00, 0x8F, 0x88, 0xF8, 0x00, 0x00,
+  0xFF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x80,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x8F, 0xB0, 0x08, 0xFB, 0x00, 0x8F, 0x80,
+  0x08, 0xF8, 0x00, 0x00, 0x4F, 0xF0, 0x08, 0xF8, 0x00, 0x8F, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x4F, 0xF0, 0x00, 0x0B,
+  0xF4, 0x4F, 0xF0, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00,
+  0x04, 0xFF, 0xBF, 0x80, 0x00, 0x04, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x84, 0x00, 0x00,
+  // 0x58 'X'
+  0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40,
+  0x00, 0xBF, 0xB0, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xB0, 0x00,
+  0x00, 0x08, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x4F, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x8F, 0xB0, 0x00, 0x00,
+  0x00, 0x04, 0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x04, 0xFF, 0x40, 0x00,
+  0x00, 0x8F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFB, 0x00,
+  0x0F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80,
+  // 0x59 'Y'
+  0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0,
+  0x04, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0xBF, 0xB0, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x4F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFB, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
+  // 0x5A 'Z'
+  0x04, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x04, 0x88,
+  0x88, 0x88, 0x88, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  // 0x5B '['
+  0x48, 0x88, 0x40, 0x8F, 0xFF, 0x80, 0x8F, 0xB8, 0x40, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F,
+  0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80,
+  0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00,
+  0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0xB8, 0x40, 0x8F,
+  0xFF, 0x80, 0x48, 0x88, 0x40,
+  // 0x5C
+  0x84, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
+  0x0B, 0x80, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00,
+  0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x8B, 0x00,
+  0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x80,
+  // 0x5D ']'
+  0x48, 0x88, 0x40, 0x8F, 0xFF, 0x80, 0x48, 0xBF, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00,
+  0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F,
+  0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80,
+  0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x8F, 0x80, 0x48, 0xBF, 0x80, 0x8F,
+  0xFF, 0x80, 0x48, 0x88, 0x40,
+  // 0x5E '^'
+  0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x80, 0x00, 0x00,
+  0xBF, 0x0B, 0xB0, 0x00, 0x04, 0xF8, 0x08, 0xF4, 0x00, 0x08, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x80,
+  0x00, 0x8F, 0x00, 0x8F, 0x40, 0x00, 0x4F, 0x80, 0xBB, 0x00, 0x00, 0x0B, 0xB0,
+  // 0x5F '_'
+  0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40,
+  // 0x60 '`'
+  0x4B, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x84,
+  // 0x61 'a'
+  0x00, 0x00, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF,
+  0x88, 0x8B, 0xFF, 0xB0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x48, 0x8B, 0xFF, 0xF0,
+  0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x8F, 0xF0, 0x00, 0x4F, 0xFB, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x8F,
+  0xB0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xF8, 0x00,
+  0x4B, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0x84, 0x04,
+  0xFF, 0x80,
+  // 0x62 'b'
+  0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x08, 0x88, 0x00, 0x00, 0x8F, 0x88,
+  0xFF, 0xFF, 0xF4, 0x00, 0x8F, 0xBF, 0xB8, 0x8F, 0xFF, 0x40, 0x8F, 0xFB, 0x00, 0x00, 0xBF, 0xB0,
+  0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0xB0, 0x00, 0x00, 0x0B, 0xF8, 0x8F, 0x80, 0x00, 0x00,
+  0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0xB0,
+  0x00, 0x00, 0x0F, 0xF4, 0x8F, 0xF4, 0x00, 0x00, 0x4F, 0xF0, 0x8F, 0xFF, 0x40, 0x08, 0xFF, 0x80,
+  0x8F, 0x4F, 0xFF, 0xFF, 0xFB, 0x00, 0x48, 0x04, 0xBF, 0xFF, 0x80, 0x00,
+  // 0x63 'c'
+  0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0x04, 0xFF, 0xB8, 0x8B,
+  0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x8F, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x08, 0x80, 0x0F, 0xF4, 0x00, 0x00,
+  0x4F, 0xF0, 0x08, 0xFF, 0x40, 0x04, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08,
+  0xFF, 0xFB, 0x80, 0x00,
+  // 0x64 'd'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x88, 0x84, 0x00, 0xFF, 0x00, 0x4F,
+  0xFF, 0xFF, 0xB4, 0xFF, 0x04, 0xFF, 0xF8, 0x8B, 0xFF, 0xFF, 0x0B, 0xFB, 0x00, 0x00, 0x4F, 0xFF,
+  0x0F, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0x8F, 0xB0, 0x00, 0x00, 0x04, 0xFF, 0x8F, 0x80, 0x00, 0x00,
+  0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0,
+  0x00, 0x00, 0x08, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x08, 0xFF, 0x80, 0x04, 0xBF, 0xFF,
+  0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x8F, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x48,
+  // 0x65 'e'
+  0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xF8, 0x8B,
+  0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x00, 0xBF, 0xB0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0x80,
+  0x00, 0x00, 0x08, 0xF8, 0x8F, 0xB8, 0x88, 0x88, 0x8B, 0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
+  0x0F, 0xF0, 0x08, 0xFF, 0x40, 0x04, 0xBF, 0xB0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x08,
+  0xBF, 0xFF, 0x80, 0x00,
+  // 0x66 'f'
+  0x00, 0x04, 0x84, 0x00, 0x8F, 0xF8, 0x00, 0xFF, 0xB4, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x8F,
+  0xFF, 0xF8, 0x48, 0xFF, 0x84, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x88, 0x00,
+  // 0x67 'g'
+  0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x88, 0xF8, 0x04, 0xFF, 0xF8, 0x8B,
+  0xFF, 0xF8, 0x0B, 0xFB, 0x00, 0x00, 0xBF, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x8F, 0xB0,
+  0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8,
+  0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x4F, 0xB0, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0x00,
+  0x4F, 0xF8, 0x08, 0xFF, 0x80, 0x04, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xB8, 0xF8, 0x00, 0x08,
+  0xFF, 0xF8, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x4F, 0xF0,
+  0x08, 0xFF, 0x88, 0x8B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x88, 0x88,
+  0x00, 0x00,
+  // 0x68 'h'
+  0x48, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F,
+  0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x48, 0x88, 0x00, 0x8F, 0x84, 0xFF, 0xFF, 0xB4, 0x8F, 0xBF,
+  0xB8, 0xBF, 0xFB, 0x8F, 0xF8, 0x00, 0x04, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00,
+  0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00,
+  0xFF, 0x8F, 0x80, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xFF,
+  0x8F, 0x80, 0x00, 0x00, 0xFF, 0x48, 0x40, 0x00, 0x00, 0x88,
+  // 0x69 'i'
+  0x48, 0x40, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80,
+  0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80,
+  0x8F, 0x80, 0x48, 0x40,
+  // 0x6A 'j'
+  0x00, 0x88, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xF8, 0x88, 0x40,
+  // 0x6B 'k'
+  0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80,
+  0x00, 0x0B, 0xFB, 0x00, 0x8F, 0x80, 0x00, 0xBF, 0xB0, 0x00, 0x8F, 0x80, 0x0B, 0xFB, 0x00, 0x00,
+  0x8F, 0x80, 0xBF, 0xB0, 0x00, 0x00, 0x8F, 0x8B, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB0,
+  0x00, 0x00, 0x8F, 0xFB, 0x4F, 0xF4, 0x00, 0x00, 0x8F, 0xB0, 0x08, 0xFF, 0x00, 0x00, 0x8F, 0x80,
+  0x00, 0xBF, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x4F, 0xF4, 0x00, 0x8F, 0x80, 0x00, 0x0B, 0xFB, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x48, 0x40, 0x00, 0x00, 0x48, 0x80,
+  // 0x6C 'l'
+  0x48, 0x40, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80,
+  0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80,
+  0x8F, 0x80, 0x48, 0x40,
+  // 0x6D 'm'
+  0x00, 0x00, 0x48, 0x84, 0x00, 0x04, 0x88, 0x40, 0x00, 0x8F, 0x0B, 0xFF, 0xFF, 0x40, 0xBF, 0xFF,
+  0xFB, 0x00, 0x8F, 0xBF, 0x88, 0xBF, 0xFB, 0xF8, 0x8B, 0xFF, 0x40, 0x8F, 0xF4, 0x00, 0x0B, 0xFF,
+  0x40, 0x00, 0xBF, 0x80, 0x8F, 0xB0, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00,
+  0x08, 0xF8, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x8F, 0x80, 0x8F,
+  0x80, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x8F,
+  0x80, 0x8F, 0x80, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x08, 0xF8, 0x00,
+  0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x08,
+  0xF8, 0x00, 0x00, 0x8F, 0x80, 0x48, 0x40, 0x00, 0x04, 0x84, 0x00, 0x00, 0x48, 0x40,
+  // 0x6E 'n'
+  0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x8F, 0x08, 0xFF, 0xFF, 0xF4, 0x00, 0x8F, 0x8F, 0xB8, 0x8F,
+  0xFF, 0x40, 0x8F, 0xFB, 0x00, 0x00, 0xFF, 0x80, 0x8F, 0xF0, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80,
+  0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80,
+  0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00,
+  0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x48, 0x40,
+  0x00, 0x00, 0x48, 0x40,
+  // 0x6F 'o'
+  0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xF8, 0x00, 0x04, 0xFF, 0xF8, 0x8B,
+  0xFF, 0xB0, 0x0B, 0xFB, 0x00, 0x00, 0x4F, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0xB0,
+  0x00, 0x00, 0x04, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x08, 0xFB, 0x0F, 0xF4, 0x00, 0x00,
+  0x0B, 0xF8, 0x08, 0xFF, 0x80, 0x04, 0xBF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x08,
+  0xBF, 0xFF, 0x84, 0x00,
+  // 0x70 'p'
+  0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x8F, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x8F, 0xBF, 0xF8, 0x8F,
+  0xFF, 0x40, 0x8F, 0xFB, 0x00, 0x00, 0xBF, 0xB0, 0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0xB0,
+  0x00, 0x00, 0x0B, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8,
+  0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x8F, 0xB0, 0x00, 0x00, 0x0F, 0xF4, 0x8F, 0xF4, 0x00, 0x00,
+  0x4F, 0xF0, 0x8F, 0xFF, 0x40, 0x08, 0xFF, 0x80, 0x8F, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x8F, 0x80,
+  0x8F, 0xFF, 0x80, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  // 0x71 'q'
+  0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xF4, 0x8F, 0x04, 0xFF, 0xF8, 0x8B,
+  0xFF, 0xBF, 0x0B, 0xFB, 0x00, 0x00, 0x4F, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0x8F, 0xB0,
+  0x00, 0x00, 0x04, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0x0F, 0xF4, 0x00, 0x00,
+  0x0B, 0xFF, 0x08, 0xFF, 0x80, 0x04, 0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x08,
+  0xFF, 0xFB, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  // 0x72 'r'
+  0x00, 0x00, 0x48, 0x40, 0x8F, 0x08, 0xFF, 0x80, 0x8F, 0xBF, 0xF8, 0x40, 0x8F, 0xF4, 0x00, 0x00,
+  0x8F, 0xF0, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x48, 0x40, 0x00, 0x00,
+  // 0x73 's'
+  0x00, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x08, 0xFF, 0x88, 0x8F,
+  0xFB, 0x00, 0x0F, 0xF4, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0x00, 0x04, 0x8B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x8F, 0x80, 0x00, 0x00,
+  0x8F, 0x80, 0x4F, 0xF8, 0x00, 0x08, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x8B,
+  0xFF, 0xFB, 0x40, 0x00,
+  // 0x74 't'
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x8F, 0xFF, 0xF8, 0x48, 0xFF, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x4F, 0xF8,
+  // 0x75 'u'
+  0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00,
+  0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80,
+  0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80,
+  0x8F, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x8F, 0x80, 0x00, 0x04, 0xFF, 0x80, 0x8F, 0xF8, 0x00, 0x4F,
+  0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x4F, 0x80, 0x00, 0x8F, 0xFF, 0x84, 0x08, 0x40,
+  // 0x76 'v'
+  0x8F, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x4F, 0xF0, 0x00, 0x00, 0x4F, 0xF0, 0x0F, 0xF4, 0x00, 0x00,
+  0x8F, 0x80, 0x08, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x08, 0xFB, 0x00, 0x00, 0xFF,
+  0x40, 0x0B, 0xF8, 0x00, 0x00, 0x8F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xF0, 0x8F, 0x80, 0x00,
+  0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x00, 0x08, 0xF8, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00,
+  // 0x77 'w'
+  0xBF, 0x80, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0xB0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+  0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x8F, 0xBF,
+  0x80, 0x04, 0xFB, 0x00, 0x08, 0xF8, 0x00, 0xFF, 0x0F, 0xB0, 0x08, 0xF8, 0x00, 0x04, 0xFB, 0x00,
+  0xFB, 0x0F, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x08, 0xF8, 0x08, 0xF4, 0x0F, 0xF0, 0x00, 0x00,
+  0x8F, 0x48, 0xF4, 0x08, 0xF8, 0x4F, 0x80, 0x00, 0x00, 0x8F, 0x8F, 0xF0, 0x00, 0xFB, 0x8F, 0x80,
+  0x00, 0x00, 0x0F, 0xBF, 0xB0, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x8F,
+  0xFB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x88, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00,
+  // 0x78 'x'
+  0x4F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x08, 0xFB, 0x00, 0x04, 0xFB, 0x00, 0x00, 0xBF, 0x40, 0x0F,
+  0xF4, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x08, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x4F, 0xF0, 0x00, 0x04, 0xFB, 0x00, 0x0B,
+  0xFB, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x48, 0x40, 0x00, 0x00, 0x48, 0x80,
+  // 0x79 'y'
+  0x8F, 0x80, 0x00, 0x00, 0x4F, 0xF0, 0x4F, 0xB0, 0x00, 0x00, 0x8F, 0x80, 0x0F, 0xF0, 0x00, 0x00,
+  0xFF, 0x00, 0x08, 0xF8, 0x00, 0x04, 0xFB, 0x00, 0x04, 0xFB, 0x00, 0x08, 0xF8, 0x00, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x8F, 0x80, 0x8F, 0xB0, 0x00, 0x00, 0x4F, 0xB0, 0xBF, 0x40, 0x00,
+  0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x08, 0x8F, 0xF4, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00,
+  // 0x7A 'z'
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x88, 0x88,
+  0x88, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x48, 0x88, 0x88, 0x88, 0x88, 0x40,
+  // 0x7B '{'
+  0x00, 0x04, 0x84, 0x00, 0x8F, 0xF8, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x8F, 0xB0,
+  0x00, 0xFF, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x04, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFB, 0x00, 0x00,
+  0x8F, 0xF8, 0x00, 0x04, 0x84,
+  // 0x7C '|'
+  0x84, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x84,
+  // 0x7D '}'
+  0x88, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x04, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x4F,
+  0xB4, 0x00, 0x08, 0xF8, 0x00, 0x4F, 0xB4, 0x00, 0xBB, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0xFF,
+  0xF0, 0x00, 0x88, 0x00, 0x00,
+  // 0x7E '~'
+  0x08, 0x84, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x88, 0xF4, 0x04, 0xFF, 0x88, 0xF4, 0x80,
+  0x00, 0x08, 0xFF, 0xB0,
+};
+
+const tftSpanGlyph FreeSans12ptAAGlyphs[] PROGMEM = {
+  {     0,   6,   0,   0,    0,    0 }, // 0x20 ' '
+  {     0,   8,   2,  18,    3,    0 }, // 0x21 '!'
+  {    18,   8,   6,   6,    1,    1 }, // 0x22 '"'
+  {    36,  13,  13,  17,    0,    1 }, // 0x23 '#'
+  {   155,  13,  12,  21,    0,    0 }, // 0x24 '$'
+  {   281,  21,  20,  17,    0,    1 }, // 0x25 '%'
+  {   451,  16,  14,  17,    1,    1 }, // 0x26 '&'
+  {   570,   5,   2,   6,    1,    1 }, // 0x27 '''
+  {   576,   8,   6,  23,    1,    0 }, // 0x28 '('
+  {   645,   8,   5,  23,    1,    0 }, // 0x29 ')'
+  {   714,   9,   7,   8,    1,    0 }, // 0x2A '*'
+  {   746,  14,  12,  12,    1,    6 }, // 0x2B '+'
+  {   818,   7,   2,   6,    2,   15 }, // 0x2C ','
+  {   824,   8,   6,   2,    1,   10 }, // 0x2D '-'
+  {   830,   6,   2,   3,    2,   15 }, // 0x2E '.'
+  {   833,   7,   7,  18,    0,    0 }, // 0x2F '/'
+  {   905,  13,  11,  17,    1,    1 }, // 0x30 '0'
+  {  1007,  13,   6,  17,    2,    1 }, // 0x31 '1'
+  {  1058,  13,  11,  17,    1,    1 }, // 0x32 '2'
+  {  1160,  13,  12,  17,    0,    1 }, // 0x33 '3'
+  {  1262,  13,  12,  17,    0,    1 }, // 0x34 '4'
+  {  1364,  13,  11,  17,    1,    1 }, // 0x35 '5'
+  {  1466,  13,  11,  17,    1,    1 }, // 0x36 '6'
+  {  1568,  13,  11,  17,    1,    1 }, // 0x37 '7'
+  {  1670,  13,  11,  17,    1,    1 }, // 0x38 '8'
+  {  1772,  13,  11,  17,    1,    1 }, // 0x39 '9'
+  {  1874,   6,   2,  13,    2,    5 }, // 0x3A ':'
+  {  1887,   6,   2,  16,    2,    5 }, // 0x3B ';'
+  {  1903,  14,  12,  12,    1,    6 }, // 0x3C '<'
+  {  1975,  14,  12,   6,    1,    9 }, // 0x3D '='
+  {  2011,  14,  12,  12,    1,    6 }, // 0x3E '>'
+  {  2083,  13,  10,  18,    2,    0 }, // 0x3F '?'
+  {  2173,  24,  22,  21,    1,    0 }, // 0x40 '@'
+  {  2404,  16,  15,  18,    0,    0 }, // 0x41 'A'
+  {  2548,  16,  13,  18,    2,    0 }, // 0x42 'B'
+  {  2674,  17,  15,  18,    1,    0 }, // 0x43 'C'
+  {  2818,  17,  14,  18,    2,    0 }, // 0x44 'D'
+  {  2944,  15,  12,  18,    2,    0 }, // 0x45 'E'
+  {  3052,  14,  11,  18,    2,    0 }, // 0x46 'F'
+  {  3160,  18,  16,  18,    1,    0 }, // 0x47 'G'
+  {  3304,  17,  13,  18,    2,    0 }, // 0x48 'H'
+  {  3430,   7,   3,  18,    2,    0 }, // 0x49 'I'
+  {  3466,  13,  10,  18,    1,    0 }, // 0x4A 'J'
+  {  3556,  16,  14,  18,    2,    0 }, // 0x4B 'K'
+  {  3682,  13,  11,  18,    2,    0 }, // 0x4C 'L'
+  {  3790,  20,  16,  18,    2,    0 }, // 0x4D 'M'
+  {  3934,  17,  13,  18,    2,    0 }, // 0x4E 'N'
+  {  4060,  19,  17,  18,    1,    0 }, // 0x4F 'O'
+  {  4222,  16,  12,  18,    2,    0 }, // 0x50 'P'
+  {  4330,  19,  17,  19,    1,    0 }, // 0x51 'Q'
+  {  4501,  17,  13,  18,    2,    0 }, // 0x52 'R'
+  {  4627,  16,  14,  18,    1,    0 }, // 0x53 'S'
+  {  4753,  15,  13,  18,    1,    0 }, // 0x54 'T'
+  {  4879,  17,  13,  18,    2,    0 }, // 0x55 'U'
+  {  5005,  15,  15,  18,    0,    0 }, // 0x56 'V'
+  {  5149,  22,  22,  18,    0,    0 }, // 0x57 'W'
+  {  5347,  16,  15,  18,    0,    0 }, // 0x58 'X'
+  {  5491,  16,  16,  18,    0,    0 }, // 0x59 'Y'
+  {  5635,  15,  14,  18,    0,    0 }, // 0x5A 'Z'
+  {  5761,   7,   5,  23,    1,    0 }, // 0x5B '['
+  {  5830,   7,   7,  18,    0,    0 }, // 0x5C
+  {  5902,   7,   5,  23,    0,    0 }, // 0x5D ']'
+  {  5971,  11,   9,   9,    1,    1 }, // 0x5E '^'
+  {  6016,  13,  15,   2,   -1,   20 }, // 0x5F '_'
+  {  6032,   6,   6,   4,    0,    0 }, // 0x60 '`'
+  {  6044,  13,  13,  14,    0,    4 }, // 0x61 'a'
+  {  6142,  13,  12,  18,    1,    0 }, // 0x62 'b'
+  {  6250,  12,  11,  14,    0,    4 }, // 0x63 'c'
+  {  6334,  13,  12,  18,    0,    0 }, // 0x64 'd'
+  {  6442,  13,  12,  14,    0,    4 }, // 0x65 'e'
+  {  6526,   7,   6,  18,    0,    0 }, // 0x66 'f'
+  {  6580,  13,  12,  19,    0,    4 }, // 0x67 'g'
+  {  6694,  13,  10,  18,    1,    0 }, // 0x68 'h'
+  {  6784,   5,   3,  18,    1,    0 }, // 0x69 'i'
+  {  6820,   6,   4,  23,    0,    0 }, // 0x6A 'j'
+  {  6866,  12,  11,  18,    1,    0 }, // 0x6B 'k'
+  {  6974,   5,   3,  18,    1,    0 }, // 0x6C 'l'
+  {  7010,  19,  17,  14,    1,    4 }, // 0x6D 'm'
+  {  7136,  13,  11,  14,    1,    4 }, // 0x6E 'n'
+  {  7220,  13,  12,  14,    0,    4 }, // 0x6F 'o'
+  {  7304,  13,  12,  18,    1,    4 }, // 0x70 'p'
+  {  7412,  13,  12,  18,    0,    4 }, // 0x71 'q'
+  {  7520,   8,   7,  14,    1,    4 }, // 0x72 'r'
+  {  7576,  12,  11,  14,    0,    4 }, // 0x73 's'
+  {  7660,   7,   6,  16,    0,    2 }, // 0x74 't'
+  {  7708,  13,  11,  13,    1,    5 }, // 0x75 'u'
+  {  7786,  12,  12,  13,    0,    5 }, // 0x76 'v'
+  {  7864,  17,  17,  13,    0,    5 }, // 0x77 'w'
+  {  7981,  11,  11,  13,    0,    5 }, // 0x78 'x'
+  {  8059,  11,  11,  18,    0,    5 }, // 0x79 'y'
+  {  8167,  12,  11,  13,    0,    5 }, // 0x7A 'z'
+  {  8245,   8,   6,  23,    1,    0 }, // 0x7B '{'
+  {  8314,   6,   2,  23,    2,    0 }, // 0x7C '|'
+  {  8337,   8,   6,  23,    1,    0 }, // 0x7D '}'
+  {  8406,  12,  10,   4,    1,    7 }, // 0x7E '~'
+};
+
+const tftSpanFont FreeSans12ptAA PROGMEM = {
+  FreeSans12ptAARows, FreeSans12ptAAGlyphs, 0x20, 0x7E, 28, 17, 4
+};
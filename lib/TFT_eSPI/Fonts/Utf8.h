@@ -0,0 +1,56 @@
+// UTF-8 line buffer decoding for the text functions. Strings are looked at once, four
+// bytes at a time, for the first byte that needs decoding, and the characters before it
+// are the bytes themselves. Nearly all text is ASCII, so most strings are never decoded.
+// Host code can include this on its own, tools/text_bench times it on dashboard strings
+
+#ifndef _TFT_UTF8_H_
+#define _TFT_UTF8_H_
+
+#include <stdint.h>
+#include <string.h>
+
+// Bytes of buf before the first that is 0 or has the top bit set, len if there is none.
+// Once buf is word aligned four bytes are tested in one go, the 0x01 borrow finds a 0
+// byte in a word that has no top bits set
+inline size_t tftAsciiLength(const uint8_t *buf, size_t len)
+{
+  size_t i = 0;
+  while (i < len && ((uintptr_t)(buf + i) & 3)) {
+    if (buf[i] == 0 || (buf[i] & 0x80)) return i;
+    i++;
+  }
+
+  while (i + 4 <= len) {
+    uint32_t w;
+    memcpy(&w, buf + i, 4); // Aligned, one load
+    if ((w | (w - 0x01010101)) & 0x80808080) break;
+    i += 4;
+  }
+
+  while (i < len && buf[i] && !(buf[i] & 0x80)) i++;
+  return i;
+}
+
+// Character at buf[*index], index is moved past it. 21 bit code points and invalid bytes
+// fall back to extended ASCII, the byte itself
+inline uint16_t tftDecodeUTF8(const uint8_t *buf, uint16_t *index, uint16_t remaining)
+{
+  uint16_t c = buf[(*index)++];
+
+  // 7 bit Unicode
+  if ((c & 0x80) == 0x00) return c;
+
+  // 11 bit Unicode
+  if (((c & 0xE0) == 0xC0) && (remaining > 1))
+    return ((c & 0x1F)<<6) | (buf[(*index)++]&0x3F);
+
+  // 16 bit Unicode
+  if (((c & 0xF0) == 0xE0) && (remaining > 2)) {
+    c = ((c & 0x0F)<<12) | ((buf[(*index)++]&0x3F)<<6);
+    return  c | ((buf[(*index)++]&0x3F));
+  }
+
+  return c; // fall-back to extended ASCII
+}
+
+#endif
@@ -24,6 +24,27 @@
   DMA_HandleTypeDef dmaHal;
 #endif
 
+#ifdef STM32_DMA_QUEUE
+  // Commands sent by DMA one after the other, the end interrupt starts the next
+  typedef struct {
+    int16_t  x0, y0, x1, y1;     // TFT window, x0 < 0 to carry on in the window already set
+    const uint8_t* data;         // Image in TFT byte order, nullptr for a solid fill
+    uint32_t len;                // Pixels
+    uint16_t color;              // Solid fill colour
+  } dmaCommand;
+
+  dmaCommand        dmaQueue[DMA_QUEUE_SIZE];
+  volatile uint8_t  dmaQueueIn   = 0;     // Next free entry, moved on by the caller
+  volatile uint8_t  dmaQueueOut  = 0;     // Entry being sent, moved on by the interrupt
+  volatile bool     dmaQueueBusy = false; // Set while the DMA owns the SPI bus
+  volatile uint32_t dmaQueueDone = 0;     // Commands sent, for fences
+  uint32_t          dmaQueueAdded = 0;    // Commands queued, for fences
+  const uint8_t*    dmaSrc;               // Where the next part of the command starts
+  uint32_t          dmaLeft;              // Rest of the command, pixels for fills or image bytes
+  uint16_t          dmaFillColor;         // DMA source word of a fill, read for every pixel
+  uint32_t          dmaChannelCCR;        // Channel setup of initDMA(), restored when idle
+#endif
+
   // Buffer for SPI transmit byte padding and byte order manipulation
   uint8_t   spiBuffer[8];
 
@@ -431,6 +452,9 @@ void TFT_eSPI::pushPixels(const void* data_in, uint32_t len)
 bool TFT_eSPI::dmaBusy(void)
 {
   //return (dmaHal.State == HAL_DMA_STATE_BUSY);  // Do not use, SPI may still be busy
+#ifdef STM32_DMA_QUEUE
+  if (dmaQueueBusy) return true;
+#endif
   return (spiHal.State == HAL_SPI_STATE_BUSY_TX); // Check if SPI Tx is busy
 }
 
@@ -442,7 +466,7 @@ bool TFT_eSPI::dmaBusy(void)
 void TFT_eSPI::dmaWait(void)
 {
   //return (dmaHal.State == HAL_DMA_STATE_BUSY);  // Do not use, SPI may still be busy
-  while (spiHal.State == HAL_SPI_STATE_BUSY_TX); // Check if SPI Tx is busy
+  while (dmaBusy());
 }
 
 
@@ -456,7 +480,7 @@ void TFT_eSPI::pushPixelsDMA(uint16_t* image, uint32_t len)
   if (len == 0) return;
 
   // Wait for any current DMA transaction to end
-  while (spiHal.State == HAL_SPI_STATE_BUSY_TX); // Check if SPI Tx is busy
+  while (dmaBusy());
 
   if(_swapBytes) {
     for (uint32_t i = 0; i < len; i++) (image[i] = image[i] << 8 | image[i] >> 8);
@@ -535,6 +559,360 @@ void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t
   HAL_SPI_Transmit_DMA(&spiHal, (uint8_t*)buffer, len << 1);
 }
 
+#ifdef STM32_DMA_QUEUE
+/***************************************************************************************
+** Function name:           spiIdle, spiSend8, spiFrames16
+** Description:             Direct SPI access for the DMA queue
+***************************************************************************************/
+static inline void spiIdle(void)
+{
+  while (!(spiHal.Instance->SR & SPI_SR_TXE));
+  while (spiHal.Instance->SR & SPI_SR_BSY);
+}
+
+static inline void spiSend8(uint8_t b)
+{
+  while (!(spiHal.Instance->SR & SPI_SR_TXE));
+  spiHal.Instance->DR = b;
+}
+
+// The frame size can only be changed with the SPI idle
+static void spiFrames16(bool on)
+{
+  if (((spiHal.Instance->CR1 & SPI_CR1_DFF) != 0) == on) return;
+  spiHal.Instance->CR1 &= ~SPI_CR1_SPE;
+  if (on) spiHal.Instance->CR1 |=  SPI_CR1_DFF;
+  else    spiHal.Instance->CR1 &= ~SPI_CR1_DFF;
+  spiHal.Instance->CR1 |=  SPI_CR1_SPE;
+}
+
+/***************************************************************************************
+** Function name:           dmaNextPart
+** Description:             Start the next part of the command being sent
+***************************************************************************************/
+// The DMA count register is 16 bits, so a command is sent in parts of up to 65535 items
+static void dmaNextPart(void)
+{
+  uint32_t len = dmaLeft;
+  if (len > 0xFFFF) len = 0xFFFF;
+  dmaLeft -= len;
+
+  dmaHal.Instance->CCR &= ~DMA_CCR_EN;
+  dmaHal.Instance->CMAR  = (uint32_t)dmaSrc;
+  dmaHal.Instance->CNDTR = len;
+  dmaHal.Instance->CCR |= DMA_CCR_EN;
+
+  if (dmaHal.Instance->CCR & DMA_CCR_MINC) dmaSrc += len; // Fills keep reading the colour
+}
+
+/***************************************************************************************
+** Function name:           dmaQueueStart
+** Description:             Send the next queued command, or release the bus if none
+***************************************************************************************/
+// Called with dmaQueueBusy set: by dmaQueueAdd() for the first command, then by the end
+// interrupt. A solid fill switches the SPI to 16 bit frames and reads the same colour
+// word for every pixel with the memory increment off
+static void dmaQueueStart(void)
+{
+  spiIdle(); // The last pixel must be out before DC or the frame size change
+
+  if (dmaQueueOut == dmaQueueIn) {
+    dmaHal.Instance->CCR = dmaChannelCCR;
+    spiHal.Instance->CR2 &= ~SPI_CR2_TXDMAEN;
+    spiFrames16(false);
+    __HAL_SPI_CLEAR_OVRFLAG(&spiHal); // Nothing was read while sending
+    dmaQueueBusy = false;
+    return;
+  }
+
+  const dmaCommand* c = &dmaQueue[dmaQueueOut];
+  uint32_t ccr = (dmaChannelCCR & ~(DMA_CCR_MINC | DMA_CCR_PSIZE | DMA_CCR_MSIZE)) | DMA_CCR_TCIE;
+
+  dmaHal.Instance->CCR = ccr;
+
+  if (c->x0 >= 0) {
+    spiFrames16(false);
+    DC_C; spiSend8(TFT_CASET); spiIdle();
+    DC_D; spiSend8(c->x0 >> 8); spiSend8(c->x0); spiSend8(c->x1 >> 8); spiSend8(c->x1); spiIdle();
+    DC_C; spiSend8(TFT_PASET); spiIdle();
+    DC_D; spiSend8(c->y0 >> 8); spiSend8(c->y0); spiSend8(c->y1 >> 8); spiSend8(c->y1); spiIdle();
+    DC_C; spiSend8(TFT_RAMWR); spiIdle();
+    DC_D;
+  }
+
+  if (c->data) {
+    spiFrames16(false);
+    ccr |= DMA_CCR_MINC;
+    dmaSrc  = c->data;
+    dmaLeft = c->len << 1;
+  }
+  else {
+    spiFrames16(true);
+    ccr |= DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0;
+    dmaFillColor = c->color;
+    dmaSrc  = (const uint8_t*)&dmaFillColor;
+    dmaLeft = c->len;
+  }
+
+  dmaHal.Instance->CCR  = ccr;
+  dmaHal.Instance->CPAR = (uint32_t)&spiHal.Instance->DR;
+  spiHal.Instance->CR2 |= SPI_CR2_TXDMAEN;
+
+  dmaNextPart();
+}
+
+/***************************************************************************************
+** Function name:           dmaQueueAdd
+** Description:             Queue a command, start it if the DMA is idle
+***************************************************************************************/
+// Only waits if the queue is full. The chip select must already be low
+static void dmaQueueAdd(const dmaCommand* c)
+{
+  uint8_t next = (dmaQueueIn + 1) % DMA_QUEUE_SIZE;
+  while (next == dmaQueueOut); // Full, wait for the interrupt to take one
+
+  // The channel is shared with pushImageDMA(), which uses the HAL
+  if (!dmaQueueBusy) while (spiHal.State == HAL_SPI_STATE_BUSY_TX);
+
+  dmaQueue[dmaQueueIn] = *c;
+  dmaQueueAdded++;
+
+  __disable_irq();
+  bool start = !dmaQueueBusy;
+  dmaQueueBusy = true;
+  dmaQueueIn = next;
+  __enable_irq();
+
+  if (start) {
+    dmaChannelCCR = dmaHal.Instance->CCR & ~(DMA_CCR_EN | DMA_CCR_TCIE | DMA_CCR_HTIE | DMA_CCR_TEIE);
+    dmaQueueStart();
+  }
+}
+
+/***************************************************************************************
+** Function name:           dmaQueueIRQ
+** Description:             DMA end interrupt for queued commands
+***************************************************************************************/
+static void dmaQueueIRQ(void)
+{
+  __HAL_DMA_CLEAR_FLAG(&dmaHal, __HAL_DMA_GET_GI_FLAG_INDEX(&dmaHal));
+
+  if (dmaLeft) { dmaNextPart(); return; }
+
+  dmaQueueOut = (dmaQueueOut + 1) % DMA_QUEUE_SIZE;
+  dmaQueueDone++;
+  dmaQueueStart();
+}
+
+/***************************************************************************************
+** Function name:           queueFill
+** Description:             Queue a filled rectangle, returns before it is drawn
+***************************************************************************************/
+void TFT_eSPI::queueFill(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color)
+{
+  if (!DMA_Enabled) { fillRect(x, y, w, h, color); return; }
+
+  if (_vpOoB) return;
+
+  x+= _xDatum;
+  y+= _yDatum;
+
+  if ((x >= _vpW) || (y >= _vpH)) return;
+
+  if (x < _vpX) { w += x - _vpX; x = _vpX; }
+  if (y < _vpY) { h += y - _vpY; y = _vpY; }
+
+  if ((x + w) > _vpW) w = _vpW - x;
+  if ((y + h) > _vpH) h = _vpH - y;
+
+  if ((w < 1) || (h < 1)) return;
+
+  #ifdef CGRAM_OFFSET
+    x+=colstart;
+    y+=rowstart;
+  #endif
+
+  dmaCommand c = { (int16_t)x, (int16_t)y, (int16_t)(x + w - 1), (int16_t)(y + h - 1), nullptr, (uint32_t)(w * h), color };
+
+  resetWindowCache(); // The interrupt moves the window
+  dmaQueueAdd(&c);
+}
+
+/***************************************************************************************
+** Function name:           queueImage
+** Description:             Queue an image, returns before it is drawn
+***************************************************************************************/
+// The pixels are sent as they are in RAM, in TFT byte order like a 16 bit Sprite, and
+// must not change until fencePassed() is true for a fence taken after this call
+void TFT_eSPI::queueImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data)
+{
+  if (_vpOoB) return;
+
+  x+= _xDatum;
+  y+= _yDatum;
+
+  if ((x >= _vpW) || (y >= _vpH)) return;
+
+  int32_t dx = 0;
+  int32_t dy = 0;
+  int32_t dw = w;
+  int32_t dh = h;
+
+  if (x < _vpX) { dx = _vpX - x; dw -= dx; x = _vpX; }
+  if (y < _vpY) { dy = _vpY - y; dh -= dy; y = _vpY; }
+
+  if ((x + dw) > _vpW ) dw = _vpW - x;
+  if ((y + dh) > _vpH ) dh = _vpH - y;
+
+  if (dw < 1 || dh < 1) return;
+
+  data += dx + dy * w;
+
+  if (!DMA_Enabled) {
+    begin_tft_write();
+    inTransaction = true;
+
+    bool swap = _swapBytes; _swapBytes = false;
+    for (int32_t row = 0; row < dh; row++) {
+      setWindow(x, y + row, x + dw - 1, y + row);
+      pushPixels(data + row * w, dw);
+    }
+    _swapBytes = swap;
+
+    inTransaction = lockTransaction;
+    end_tft_write();
+    return;
+  }
+
+  #ifdef CGRAM_OFFSET
+    x+=colstart;
+    y+=rowstart;
+  #endif
+
+  resetWindowCache(); // The interrupt moves the window
+
+  // A clipped image is not contiguous in RAM, then each row is a command
+  int32_t rows = (dw == w) ? dh : 1;
+  for (int32_t row = 0; row < dh; row += rows) {
+    dmaCommand c = { (int16_t)x, (int16_t)(y + row), (int16_t)(x + dw - 1), (int16_t)(y + row + rows - 1),
+                     (const uint8_t*)(data + row * w), (uint32_t)(dw * rows), 0 };
+    dmaQueueAdd(&c);
+  }
+}
+
+/***************************************************************************************
+** Function name:           queueFence, fencePassed, fenceWait
+** Description:             Track when queued commands have been sent
+***************************************************************************************/
+// A fence marks everything queued so far
+uint32_t TFT_eSPI::queueFence(void)
+{
+  return dmaQueueAdded;
+}
+
+bool TFT_eSPI::fencePassed(uint32_t fence)
+{
+  return (int32_t)(dmaQueueDone - fence) >= 0;
+}
+
+void TFT_eSPI::fenceWait(uint32_t fence)
+{
+  while (!fencePassed(fence));
+}
+#endif
+
+/***************************************************************************************
+** Function name:           pushBands
+** Description:             Render and push an area in bands from two toggle buffers
+***************************************************************************************/
+// While DMA sends one buffer the callback renders the next band into the other. With the
+// DMA queue each band is a queued command: the end interrupt starts the next band as soon
+// as the last one is out and the CPU only waits, on a fence, for the buffer it is about to
+// render into. Otherwise a buffer is free again once pushPixelsDMA() has waited for its
+// transfer to start the next one.
+void TFT_eSPI::pushBands(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t lines,
+                         uint16_t* buf0, uint16_t* buf1, renderBandCallback render)
+{
+  if ((w < 1) || (h < 1) || (lines == 0) || (buf0 == nullptr)) return;
+
+  x+= _xDatum;
+  y+= _yDatum;
+
+  // Bands are whole rows of the area so there is nothing to clip
+  if ((x < _vpX) || (y < _vpY) || (x + w > _vpW) || (y + h > _vpH)) return;
+
+  if (lines > h) lines = h;
+  if (w * lines > 0x7FFF) lines = 0x7FFF / w; // DMA count is 16 bits of bytes
+  if (lines == 0) return;
+
+  uint16_t* buf[2] = { buf0, buf1 ? buf1 : buf0 };
+  uint8_t   b = 0;
+
+  begin_tft_write();
+
+#ifdef STM32_DMA_QUEUE
+  if (DMA_Enabled) {
+    #ifdef CGRAM_OFFSET
+      x+=colstart;
+      y+=rowstart;
+    #endif
+
+    // Commands sent when each buffer was last queued, one buffer has one fence
+    uint32_t fence[2] = { dmaQueueAdded, dmaQueueAdded };
+    uint8_t  f = (buf[0] == buf[1]) ? 0 : 1;
+
+    resetWindowCache(); // The interrupt moves the window
+
+    for (int32_t row = 0; row < h; row += lines) {
+      int32_t n = h - row;
+      if (n > lines) n = lines;
+
+      fenceWait(fence[b & f]);
+
+      render(buf[b], row, n);
+
+      if (_swapBytes) {
+        for (int32_t i = 0; i < w * n; i++) buf[b][i] = buf[b][i] << 8 | buf[b][i] >> 8;
+      }
+
+      // The first band sets the window, the rest carry on in it
+      dmaCommand c = { (int16_t)(row ? -1 : x), (int16_t)y, (int16_t)(x + w - 1), (int16_t)(y + h - 1),
+                       (const uint8_t*)buf[b], (uint32_t)(w * n), 0 };
+      dmaQueueAdd(&c);
+      fence[b & f] = dmaQueueAdded;
+
+      b ^= 1;
+    }
+
+    fenceWait(dmaQueueAdded); // The buffers are the caller's again
+
+    end_tft_write();
+    return;
+  }
+#endif
+
+  setWindow(x, y, x + w - 1, y + h - 1);
+
+  for (int32_t row = 0; row < h; row += lines) {
+    int32_t n = h - row;
+    if (n > lines) n = lines;
+
+    // With one buffer the last band must be sent before it is overwritten
+    if (buf[0] == buf[1] && DMA_Enabled) dmaWait();
+
+    render(buf[b], row, n);
+
+    if (DMA_Enabled) pushPixelsDMA(buf[b], w * n);
+    else pushPixels(buf[b], w * n);
+
+    b ^= 1;
+  }
+
+  if (DMA_Enabled) dmaWait();
+
+  end_tft_write();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////
 // Processor specific DMA initialisation
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -611,6 +989,9 @@ bool TFT_eSPI::initDMA(bool ctrl_cs)
     void DMA1_Channel5_IRQHandler(void)
   #endif
   {
+  #ifdef STM32_DMA_QUEUE
+    if (dmaQueueBusy) { dmaQueueIRQ(); return; }
+  #endif
     // Call the default end of buffer handler
     HAL_DMA_IRQHandler(&dmaHal);
   }
@@ -182,6 +182,15 @@
       #define INIT_TFT_DATA_BUS spiHal.Instance = SPI2; \
                                 dmaHal.Instance = DMA1_Channel5
     #endif
+    #if !defined (SPI_18BIT_DRIVER) && !defined (ILI9225_DRIVER) && !defined (SSD1351_DRIVER)
+      // DMA command queue for fills and images, see queueFill(). After initDMA() fillRect()
+      // also queues blocks of DMA_FILL_MIN pixels or more
+      #define STM32_DMA_QUEUE
+      #define DMA_FILL_MIN 128
+      #ifndef DMA_QUEUE_SIZE
+        #define DMA_QUEUE_SIZE 8
+      #endif
+    #endif
   #else
     // For STM32 processor with no implemented DMA support (yet)
     #if (TFT_SPI_PORT == 1)
@@ -200,6 +209,11 @@
   #define DMA_BUSY_CHECK
 #endif
 
+#ifdef STM32_DMA_QUEUE
+  // Wait for the DMA queue to empty before the TFT is written to or deselected
+  #define DMA_QUEUE_CHECK while(dmaQueueBusy)
+#endif
+
 // If smooth fonts are enabled the filing system may need to be loaded
 #ifdef SMOOTH_FONT
   // Call up the filing system for the anti-aliased fonts                                    <<<==== TODO
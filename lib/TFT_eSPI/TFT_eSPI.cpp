@@ -32,6 +32,18 @@
   #define SPI_BUSY_CHECK
 #endif
 
+#ifndef DMA_QUEUE_CHECK
+  #define DMA_QUEUE_CHECK
+#endif
+
+// Drivers that take a plain CASET/PASET/RAMWR window on a bus with one display, where
+// setWindow() can skip the address ranges the TFT already holds
+#if !defined (ILI9225_DRIVER) && !defined (SSD1351_DRIVER) && !defined (GC9A01_DRIVER) && \
+    !defined (MULTI_TFT_SUPPORT) && !(defined (ARDUINO_ARCH_RP2040) && !defined (TFT_PARALLEL_8BIT)) && \
+    !defined (TFT_NO_WINDOW_CACHE)
+  #define TFT_WINDOW_CACHE
+#endif
+
 // Clipping macro for pushImage
 #define PI_CLIP                                        \
   if (_vpOoB) return;                                  \
@@ -58,6 +70,7 @@
 ** Description:             Start SPI transaction for writes and select TFT
 ***************************************************************************************/
 inline void TFT_eSPI::begin_tft_write(void){
+  DMA_QUEUE_CHECK; // Queued commands or a fill started by the last function may still be sending
 #if defined (SPI_HAS_TRANSACTION) && defined (SUPPORT_TRANSACTIONS) && !defined(TFT_PARALLEL_8_BIT)
   if (locked) {
     locked = false; // Flag to show SPI access now unlocked
@@ -81,14 +94,16 @@ inline void TFT_eSPI::end_tft_write(void){
   if(!inTransaction) {      // Flag to stop ending tranaction during multiple graphics calls
     if (!locked) {          // Locked when beginTransaction has been called
       locked = true;        // Flag to show SPI access now locked
+      DMA_QUEUE_CHECK;
       SPI_BUSY_CHECK;       // Check send complete and clean out unused rx data
       CS_H;
+      win_row = -1;         // RAM write is not continued across transactions
       spi.endTransaction(); //  RP2040 SDK -> 0.7us delay
     }
     SET_BUS_READ_MODE;      // In case SPI has been configured for tx only
   }
 #else
-  if(!inTransaction) {SPI_BUSY_CHECK; CS_H; SET_BUS_READ_MODE;}
+  if(!inTransaction) {DMA_QUEUE_CHECK; SPI_BUSY_CHECK; CS_H; SET_BUS_READ_MODE; win_row = -1;}
 #endif
 }
 
@@ -112,6 +127,7 @@ inline void TFT_eSPI::begin_tft_read(void){
    CS_L;
 #endif
   SET_BUS_READ_MODE;
+  win_row = -1; // Read commands end any RAM write
 }
 
 /***************************************************************************************
@@ -432,6 +448,8 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
   textcolor   = bitmap_fg = 0xFFFF; // White
   textbgcolor = bitmap_bg = 0x0000; // Black
   padX = 0;             // No padding
+  textBox.x = textBox.y = textBox.w = textBox.h = 0;
+  aaLutValid = false;
   isDigits   = false;   // No bounding box adjustment
   textwrapX  = true;    // Wrap text at end of line when using print stream
   textwrapY  = false;   // Wrap text at bottom of screen when using print stream
@@ -458,8 +476,7 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
 #endif
   _psram_enable = false;
 
-  addr_row = 0xFFFF;  // drawPixel command length optimiser
-  addr_col = 0xFFFF;  // drawPixel command length optimiser
+  resetWindowCache(); // setWindow and drawPixel command length optimiser
 
   _xPivot = 0;
   _yPivot = 0;
@@ -754,8 +771,7 @@ void TFT_eSPI::setRotation(uint8_t m)
 
   end_tft_write();
 
-  addr_row = 0xFFFF;
-  addr_col = 0xFFFF;
+  resetWindowCache();
 
   // Reset the viewport to the whole screen
   resetViewport();
@@ -824,6 +840,8 @@ void TFT_eSPI::writecommand(uint8_t c)
 
   end_tft_write();
 
+  // Any command ends a RAM write and may move the address window
+  resetWindowCache();
 }
 
 
@@ -1955,6 +1973,209 @@ void  TFT_eSPI::readRectRGB(int32_t x0, int32_t y0, int32_t w, int32_t h, uint8_
 }
 
 
+/***************************************************************************************
+** Function name:           drawPixels
+** Description:             draw many pixels of one colour as row spans
+***************************************************************************************/
+// Sort key for points and spans: row, then column, offset so negative coordinates order correctly
+static inline uint32_t rowKey(int16_t x, int16_t y)
+{
+  return ((uint32_t)(uint16_t)(y + 0x8000) << 16) | (uint16_t)(x + 0x8000);
+}
+
+// Shell sort by rowKey(), needs no extra RAM and is close to linear for the nearly
+// ordered arrays the outline primitives produce
+template <typename T> static void sortByRow(T *a, uint32_t n)
+{
+  uint32_t gap = 1;
+  while (gap < n / 3) gap = 3 * gap + 1;
+
+  for (; gap > 0; gap /= 3) {
+    for (uint32_t i = gap; i < n; i++) {
+      T t = a[i];
+      uint32_t key = rowKey(t.x, t.y);
+      uint32_t j = i;
+      while (j >= gap && rowKey(a[j - gap].x, a[j - gap].y) > key) {
+        a[j] = a[j - gap];
+        j -= gap;
+      }
+      a[j] = t;
+    }
+  }
+}
+
+void TFT_eSPI::drawPixels(tftPoint *points, uint32_t count, uint32_t color)
+{
+  if (_vpOoB || !count) return;
+
+  sortByRow(points, count);
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  tftSpan  batch[TFT_SPAN_BATCH];
+  uint32_t n = 0;
+
+  // Runs of neighbouring pixels on a row become one span, duplicates are dropped
+  int32_t x = points[0].x, y = points[0].y, xe = x + 1;
+  for (uint32_t i = 1; i < count; i++) {
+    if (points[i].y == y && points[i].x <= xe) {
+      if (points[i].x == xe) xe++;
+      continue;
+    }
+    addSpan(batch, n, x, y, xe - x, color);
+    x = points[i].x; y = points[i].y; xe = x + 1;
+  }
+  addSpan(batch, n, x, y, xe - x, color);
+  drawSpanList(batch, n, color);
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+
+/***************************************************************************************
+** Function name:           drawSpans
+** Description:             draw many horizontal spans of one colour
+***************************************************************************************/
+void TFT_eSPI::drawSpans(tftSpan *spans, uint32_t count, uint32_t color)
+{
+  if (_vpOoB || !count) return;
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  // drawSpanList() merges and marks spans in the array it is given, so the caller's spans
+  // are only sorted here and drawn from copies. Sorted first, spans that merge or stack
+  // are mostly neighbours and still meet in the same batch
+  sortByRow(spans, count);
+
+  tftSpan batch[TFT_SPAN_BATCH];
+  while (count) {
+    uint32_t n = count < TFT_SPAN_BATCH ? count : TFT_SPAN_BATCH;
+    memcpy(batch, spans, n * sizeof(tftSpan));
+    drawSpanList(batch, n, color);
+    spans += n;
+    count -= n;
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+
+/***************************************************************************************
+** Function name:           fillRectOutside
+** Description:             fill the part of a rectangle outside another
+***************************************************************************************/
+// The rows of area above and below keep are filled across, the rows beside keep to its
+// left and right, so no pixel of keep is written
+void TFT_eSPI::fillRectOutside(const tftRect *area, const tftRect *keep, uint32_t color)
+{
+  if (area->w < 1 || area->h < 1) return;
+
+  int32_t x0 = area->x, y0 = area->y, x1 = x0 + area->w, y1 = y0 + area->h;
+
+  // The part of keep inside area
+  int32_t kx0 = keep->x, ky0 = keep->y, kx1 = kx0 + keep->w, ky1 = ky0 + keep->h;
+  if (kx0 < x0) kx0 = x0;
+  if (ky0 < y0) ky0 = y0;
+  if (kx1 > x1) kx1 = x1;
+  if (ky1 > y1) ky1 = y1;
+
+  if (kx0 >= kx1 || ky0 >= ky1) {
+    fillRect(x0, y0, x1 - x0, y1 - y0, color);
+    return;
+  }
+
+  // Held as in write(), the fills give the transaction back when they finish
+  bool sketchLock = lockTransaction;
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  lockTransaction = true;
+  inTransaction = true;
+
+  if (ky0 > y0) fillRect(x0, y0, x1 - x0, ky0 - y0, color);     // Above
+  if (kx0 > x0) fillRect(x0, ky0, kx0 - x0, ky1 - ky0, color);  // Left
+  if (x1 > kx1) fillRect(kx1, ky0, x1 - kx1, ky1 - ky0, color); // Right
+  if (y1 > ky1) fillRect(x0, ky1, x1 - x0, y1 - ky1, color);    // Below
+
+  lockTransaction = sketchLock;
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+
+/***************************************************************************************
+** Function name:           drawSpanList
+** Description:             sort, merge and draw spans within the caller's transaction
+***************************************************************************************/
+void TFT_eSPI::drawSpanList(tftSpan *spans, uint32_t count, uint32_t color)
+{
+  sortByRow(spans, count);
+
+  // Merge spans that touch or overlap in place, m spans are left
+  uint32_t m = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    tftSpan *s = spans + i;
+    if (s->w < 1) continue;
+    tftSpan *t = spans + m - 1;
+    if (m && s->y == t->y && s->x <= t->x + t->w) {
+      if (s->x + s->w > t->x + t->w) t->w = s->x + s->w - t->x;
+      continue;
+    }
+    spans[m++] = *s;
+  }
+
+  // Each span is followed by one just like it on the next row where there is one, such
+  // as the two sides of a glyph stroke, so setRowWindow() carries on the RAM write
+  for (uint32_t i = 0; i < m; i++) {
+    if (spans[i].w < 1) continue;
+    uint32_t c = i;
+    while (true) {
+      drawFastHLine(spans[c].x, spans[c].y, spans[c].w, color);
+      uint32_t j = c + 1;
+      while (j < m && spans[j].y == spans[c].y) j++;
+      while (j < m && spans[j].y == spans[c].y + 1 && (spans[j].x != spans[c].x || spans[j].w != spans[c].w)) j++;
+      if (j == m || spans[j].y != spans[c].y + 1) break;
+      spans[c].w = 0;
+      c = j;
+    }
+    spans[c].w = 0;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           addSpan
+** Description:             add a span to a batch, drawing the batch when full
+***************************************************************************************/
+void TFT_eSPI::addSpan(tftSpan *batch, uint32_t &count, int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  // Clip to the viewport here so the coordinates always fit the int16_t fields
+  int32_t xs = x + _xDatum;
+  int32_t ys = y + _yDatum;
+
+  if ((ys < _vpY) || (ys >= _vpH) || (xs >= _vpW)) return;
+
+  if (xs < _vpX) { w += xs - _vpX; xs = _vpX; }
+
+  if ((xs + w) > _vpW) w = _vpW - xs;
+
+  if (w < 1) return;
+
+  if (count == TFT_SPAN_BATCH) {
+    drawSpanList(batch, count, color);
+    count = 0;
+  }
+
+  batch[count].x = xs - _xDatum;
+  batch[count].y = ys - _yDatum;
+  batch[count].w = w;
+  count++;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawCircle
 ** Description:             Draw a circle outline
@@ -2167,13 +2388,15 @@ void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corne
 
 
 /***************************************************************************************
-** Function name:           drawEllipse
-** Description:             Draw a ellipse outline
+** Function name:           drawEllipseSpans
+** Description:             draw an ellipse outline as spans
 ***************************************************************************************/
-void TFT_eSPI::drawEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint16_t color)
+// The midpoint algorithm drawEllipse() has always used, with its pixels collected as
+// spans: along the flat top and bottom each row's run of pixels is one span per quadrant,
+// along the steep sides each row gets a one pixel span. Pixels the algorithm sets twice
+// on the axes are merged when they land in the same batch.
+void TFT_eSPI::drawEllipseSpans(int32_t x0, int32_t y0, int32_t rx, int32_t ry, uint32_t color)
 {
-  if (rx<2) return;
-  if (ry<2) return;
   int32_t x, y;
   int32_t rx2 = rx * rx;
   int32_t ry2 = ry * ry;
@@ -2181,38 +2404,64 @@ void TFT_eSPI::drawEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint1
   int32_t fy2 = 4 * ry2;
   int32_t s;
 
-  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
-  inTransaction = true;
+  tftSpan  batch[TFT_SPAN_BATCH];
+  uint32_t n = 0;
 
+  int32_t xs = 0; // First x of the run on row y
   for (x = 0, y = ry, s = 2*ry2+rx2*(1-2*ry); ry2*x <= rx2*y; x++) {
-    // These are ordered to minimise coordinate changes in x or y
-    // drawPixel can then send fewer bounding box commands
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + x, y0 - y, color);
     if (s >= 0) {
+      // Pixel x is the last on row y
+      addSpan(batch, n, x0 + xs, y0 + y, x - xs + 1, color);
+      addSpan(batch, n, x0 - x,  y0 + y, x - xs + 1, color);
+      addSpan(batch, n, x0 - x,  y0 - y, x - xs + 1, color);
+      addSpan(batch, n, x0 + xs, y0 - y, x - xs + 1, color);
+      xs = x + 1;
       s += fx2 * (1 - y);
       y--;
     }
     s += ry2 * ((4 * x) + 6);
   }
+  if (xs < x) {
+    addSpan(batch, n, x0 + xs,    y0 + y, x - xs, color);
+    addSpan(batch, n, x0 - x + 1, y0 + y, x - xs, color);
+    addSpan(batch, n, x0 - x + 1, y0 - y, x - xs, color);
+    addSpan(batch, n, x0 + xs,    y0 - y, x - xs, color);
+  }
 
-  for (x = rx, y = 0, s = 2*rx2+ry2*(1-2*rx); rx2*y <= ry2*x; y++) {
-    // These are ordered to minimise coordinate changes in x or y
-    // drawPixel can then send fewer bounding box commands
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + x, y0 - y, color);
-    if (s >= 0)
-    {
-      s += fy2 * (1 - x);
-      x--;
+  // One quadrant at a time, so a batch holds a column of pixels that mostly sit
+  // directly below each other
+  for (int32_t q = 0; q < 4; q++) {
+    int32_t sx = (q == 0 || q == 3) ? 1 : -1;
+    int32_t sy = q < 2 ? 1 : -1;
+    for (x = rx, y = 0, s = 2*rx2+ry2*(1-2*rx); rx2*y <= ry2*x; y++) {
+      addSpan(batch, n, x0 + sx * x, y0 + sy * y, 1, color);
+      if (s >= 0)
+      {
+        s += fy2 * (1 - x);
+        x--;
+      }
+      s += rx2 * ((4 * y) + 6);
     }
-    s += rx2 * ((4 * y) + 6);
   }
 
+  drawSpanList(batch, n, color);
+}
+
+
+/***************************************************************************************
+** Function name:           drawEllipse
+** Description:             Draw a ellipse outline
+***************************************************************************************/
+void TFT_eSPI::drawEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint16_t color)
+{
+  if (rx<2) return;
+  if (ry<2) return;
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  drawEllipseSpans(x0, y0, rx, ry, color);
+
   inTransaction = lockTransaction;
   end_tft_write();              // Does nothing if Sprite class uses this function
 }
@@ -2443,21 +2692,118 @@ void TFT_eSPI::fillTriangle ( int32_t x0, int32_t y0, int32_t x1, int32_t y1, in
 
 
 /***************************************************************************************
-** Function name:           drawBitmap
-** Description:             Draw an image stored in an array on the TFT
+** Function name:           fillPolygon
+** Description:             Draw a filled polygon with a scanline edge table
 ***************************************************************************************/
-void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+// Pixels are filled when their centre is inside the polygon (even-odd rule), so polygons
+// that share an edge neither overlap nor leave a gap. Each edge steps its x at the pixel
+// centre rows as an integer and a remainder, so no rounding error builds up along it
+static inline int32_t floorDiv(int32_t n, int32_t d) { return n >= 0 ? n / d : -((d - 1 - n) / d); }
+
+// First pixel whose centre is at or right of where the edge from p0 down to p1 crosses
+// the centre of row y, the same column the edge table steps to
+static int32_t polyCross(const tftPoint *p0, const tftPoint *p1, int32_t y)
+{
+  int64_t n = (int64_t)(p1->x - p0->x) * (2 * (y - p0->y) + 1);
+  int64_t d = 2 * (p1->y - p0->y);
+  int64_t q = n >= 0 ? n / d : -((d - 1 - n) / d);
+  return p0->x + (int32_t)q + (2 * (n - q * d) > d);
+}
+
+void TFT_eSPI::fillPolygon(const tftPoint *points, uint16_t count, uint32_t color)
 {
+  if (_vpOoB || count < 3) return;
+
+  // x + r / den is where the edge crosses the centre of the current row
+  struct { int32_t x, r, xstep, rstep, den; int16_t ytop, ybot; } edge[TFT_POLY_EDGES];
+  uint8_t  active[TFT_POLY_EDGES];
+  int16_t  cross[TFT_POLY_EDGES];
+  uint32_t edges = 0;
+  int32_t  ymin = INT16_MAX, ymax = INT16_MIN;
+
+  // Edge table sorted by top row, horizontal edges never cross a pixel centre row
+  for (uint32_t i = 0; i < count; i++) {
+    const tftPoint *p0 = points + i;
+    const tftPoint *p1 = points + (i + 1 < count ? i + 1 : 0);
+    if (p0->y == p1->y) continue;
+    if (p0->y > p1->y) swap_coord(p0, p1);
+    if (edges == TFT_POLY_EDGES) { // More edges than the table holds
+      fillPolygonRows(points, count, color);
+      return;
+    }
+
+    uint32_t j = edges++;
+    while (j > 0 && edge[j - 1].ytop > p0->y) { edge[j] = edge[j - 1]; j--; }
+
+    int32_t dx  = p1->x - p0->x;
+    int32_t den = 2 * (p1->y - p0->y);
+    int32_t q   = floorDiv(dx, den);      // Half a row down to the first centre
+    edge[j].x     = p0->x + q;
+    edge[j].r     = dx - q * den;
+    edge[j].xstep = q = floorDiv(2 * dx, den);
+    edge[j].rstep = 2 * dx - q * den;
+    edge[j].den   = den;
+    edge[j].ytop  = p0->y;
+    edge[j].ybot  = p1->y;
+    if (p0->y < ymin) ymin = p0->y;
+    if (p1->y > ymax) ymax = p1->y;
+  }
+
+  // Only rows inside the viewport are stepped
+  int32_t y  = ymin > _vpY - _yDatum ? ymin : _vpY - _yDatum;
+  int32_t ye = ymax < _vpH - _yDatum ? ymax : _vpH - _yDatum;
+  if (y >= ye) return;
+
   //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
   inTransaction = true;
 
-  int32_t i, j, byteWidth = (w + 7) / 8;
-
-  for (j = 0; j < h; j++) {
-    for (i = 0; i < w; i++ ) {
-      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-        drawPixel(x + i, y + j, color);
+  uint32_t next = 0, nActive = 0;
+
+  for (; y < ye; y++) {
+    // Drop edges that ended above this row and add the ones that start on it, edges that
+    // started above the viewport are moved down to it first
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < nActive; i++) if (edge[active[i]].ybot > y) active[n++] = active[i];
+    nActive = n;
+    while (next < edges && edge[next].ytop <= y) {
+      if (edge[next].ybot > y) {
+        int32_t rows = y - edge[next].ytop;
+        int64_t r = edge[next].r + (int64_t)rows * edge[next].rstep;
+        edge[next].x += rows * edge[next].xstep + (int32_t)(r / edge[next].den);
+        edge[next].r  = (int32_t)(r % edge[next].den);
+        active[nActive++] = next;
       }
+      next++;
+    }
+
+    // First pixel whose centre is at or right of each crossing, kept sorted by insertion
+    // as the order hardly changes from one row to the next. Pairs of crossings enclose
+    // the inside
+    for (uint32_t i = 0; i < nActive; i++) {
+      int32_t c = edge[active[i]].x + (2 * edge[active[i]].r > edge[active[i]].den);
+      uint32_t j = i;
+      while (j > 0 && cross[j - 1] > c) { cross[j] = cross[j - 1]; j--; }
+      cross[j] = c;
+    }
+
+    // Spans that touch are merged, so a concave row is drawn as few lines as possible
+    int32_t xs = 0, xe = 0;
+    bool open = false;
+    for (uint32_t i = 0; i + 1 < nActive; i += 2) {
+      int32_t l = cross[i], r = cross[i + 1];
+      if (l >= r) continue;
+      if (open && l <= xe) { xe = r; continue; }
+      if (open) drawFastHLine(xs, y, xe - xs, color);
+      xs = l; xe = r;
+      open = true;
+    }
+    if (open) drawFastHLine(xs, y, xe - xs, color);
+
+    for (uint32_t i = 0; i < nActive; i++) {
+      uint8_t a = active[i];
+      edge[a].x += edge[a].xstep;
+      edge[a].r += edge[a].rstep;
+      if (edge[a].r >= edge[a].den) { edge[a].r -= edge[a].den; edge[a].x++; }
     }
   }
 
@@ -2467,21 +2813,53 @@ void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w
 
 
 /***************************************************************************************
-** Function name:           drawBitmap
-** Description:             Draw an image stored in an array on the TFT
+** Function name:           fillPolygonRows
+** Description:             Draw a filled polygon without an edge table
 ***************************************************************************************/
-void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor)
+// For polygons with more edges than TFT_POLY_EDGES. Every row works out the crossings of
+// all edges again and takes them in order, so it is slower but needs no table, and fills
+// the same pixels as fillPolygon()
+void TFT_eSPI::fillPolygonRows(const tftPoint *points, uint16_t count, uint32_t color)
 {
+  int32_t ymin = INT16_MAX, ymax = INT16_MIN;
+  for (uint32_t i = 0; i < count; i++) {
+    if (points[i].y < ymin) ymin = points[i].y;
+    if (points[i].y > ymax) ymax = points[i].y;
+  }
+
+  int32_t y  = ymin > _vpY - _yDatum ? ymin : _vpY - _yDatum;
+  int32_t ye = ymax < _vpH - _yDatum ? ymax : _vpH - _yDatum;
+  if (y >= ye) return;
+
   //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
   inTransaction = true;
 
-  int32_t i, j, byteWidth = (w + 7) / 8;
-
-  for (j = 0; j < h; j++) {
-    for (i = 0; i < w; i++ ) {
-      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7)))
-           drawPixel(x + i, y + j, fgcolor);
-      else drawPixel(x + i, y + j, bgcolor);
+  for (; y < ye; y++) {
+    // Each step finds the next crossing column right of the last and how many edges cross
+    // there. An odd number toggles inside, an even number leaves it, so spans that touch
+    // are merged as in fillPolygon()
+    int32_t last = INT32_MIN, xs = 0;
+    bool inside = false;
+    while (true) {
+      int32_t  c = INT32_MAX;
+      uint32_t m = 0;
+      for (uint32_t i = 0; i < count; i++) {
+        const tftPoint *p0 = points + i;
+        const tftPoint *p1 = points + (i + 1 < count ? i + 1 : 0);
+        if (p0->y > p1->y) swap_coord(p0, p1);
+        if (p0->y > y || p1->y <= y) continue;
+        int32_t x = polyCross(p0, p1, y);
+        if (x <= last) continue;
+        if (x < c) { c = x; m = 1; }
+        else if (x == c) m++;
+      }
+      if (!m) break;
+      if (m & 1) {
+        if (inside) drawFastHLine(xs, y, c - xs, color);
+        else xs = c;
+        inside = !inside;
+      }
+      last = c;
     }
   }
 
@@ -2489,47 +2867,110 @@ void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w
   end_tft_write();              // Does nothing if Sprite class uses this function
 }
 
+
 /***************************************************************************************
-** Function name:           drawXBitmap
-** Description:             Draw an image stored in an XBM array onto the TFT
+** Function name:           blendPixel
+** Description:             Draw a pixel of color with coverage alpha over bg
 ***************************************************************************************/
-void TFT_eSPI::drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+// bg == 0x00FFFFFF blends with the pixel already there, a Sprite reads its own buffer
+void TFT_eSPI::blendPixel(int32_t x, int32_t y, uint8_t alpha, uint32_t color, uint32_t bg)
 {
-  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
-  inTransaction = true;
+  if (alpha == 0) return;
+  if (alpha < 255) {
+    if (bg == 0x00FFFFFF) bg = readPixel(x, y);
+    color = alphaBlend(alpha, color, bg);
+  }
+  drawPixel(x, y, color);
+}
+
+
+// sin() of 0 to 90 degrees x 16384
+static const int16_t sinTable[91] PROGMEM = {
+      0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+   2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+   5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+   8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384
+};
+
+// sin() and cos() of whole degrees x 16384
+static int32_t sinDeg(int32_t deg)
+{
+  deg %= 360;
+  if (deg < 0) deg += 360;
+  if (deg <= 90)  return  (int16_t)pgm_read_word(sinTable + deg);
+  if (deg <= 180) return  (int16_t)pgm_read_word(sinTable + 180 - deg);
+  if (deg <= 270) return -(int16_t)pgm_read_word(sinTable + deg - 180);
+  return -(int16_t)pgm_read_word(sinTable + 360 - deg);
+}
 
-  int32_t i, j, byteWidth = (w + 7) / 8;
+static inline int32_t cosDeg(int32_t deg) { return sinDeg(deg + 90); }
 
-  for (j = 0; j < h; j++) {
-    for (i = 0; i < w; i++ ) {
-      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (1 << (i & 7))) {
-        drawPixel(x + i, y + j, color);
-      }
-    }
+// Integer square root, rounded down
+template <typename T> static T isqrt(T n)
+{
+  T root = 0, bit = (T)1 << (sizeof(T) * 8 - 2);
+  while (bit > n) bit >>= 2;
+  while (bit) {
+    if (n >= root + bit) { n -= root + bit; root = (root >> 1) + bit; }
+    else root >>= 1;
+    bit >>= 2;
   }
+  return root;
+}
 
-  inTransaction = lockTransaction;
-  end_tft_write();              // Does nothing if Sprite class uses this function
+// Integer square root of a sum of squares taken in 64 bits, in 32 bits while it fits
+static inline uint32_t isqrtSum(uint64_t n)
+{
+  return (n >> 32) ? isqrt<uint64_t>(n) : isqrt<uint32_t>(n);
+}
+
+// Pixel coverage 0-256 from a distance in 8.8 fixed point inside (+) or outside (-) an edge
+static inline int32_t coverage(int32_t d)
+{
+  d += 128;
+  return d < 0 ? 0 : d > 256 ? 256 : d;
 }
 
 
 /***************************************************************************************
-** Function name:           drawXBitmap
-** Description:             Draw an XBM image with foreground and background colors
+** Function name:           drawSmoothLine
+** Description:             Draw a one pixel wide anti-aliased line (Xiaolin Wu)
 ***************************************************************************************/
-void TFT_eSPI::drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bgcolor)
+void TFT_eSPI::drawSmoothLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color, uint32_t bg)
 {
+  if (_vpOoB) return;
+
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { swap_coord(x0, y0); swap_coord(x1, y1); }
+  if (x0 > x1) { swap_coord(x0, x1); swap_coord(y0, y1); }
+
+  // Each step along the major axis splits the pixel between the two nearest minor axis
+  // pixels in proportion to the distance of the line from them
+  int32_t dx = x1 - x0;
+  int32_t grad = dx ? ((int64_t)(y1 - y0) * 65536 + dx / 2) / dx : 0;
+  int32_t yf = y0 * 65536;
+
   //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
   inTransaction = true;
 
-  int32_t i, j, byteWidth = (w + 7) / 8;
-
-  for (j = 0; j < h; j++) {
-    for (i = 0; i < w; i++ ) {
-      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (1 << (i & 7)))
-           drawPixel(x + i, y + j,   color);
-      else drawPixel(x + i, y + j, bgcolor);
+  for (int32_t x = x0; x <= x1; x++) {
+    int32_t yi = yf >> 16;
+    uint8_t a  = (yf >> 8) & 0xFF;
+    if (steep) {
+      blendPixel(yi,     x, 255 - a, color, bg);
+      blendPixel(yi + 1, x, a,       color, bg);
     }
+    else {
+      blendPixel(x, yi,     255 - a, color, bg);
+      blendPixel(x, yi + 1, a,       color, bg);
+    }
+    yf += grad;
   }
 
   inTransaction = lockTransaction;
@@ -2538,67 +2979,337 @@ void TFT_eSPI::drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t
 
 
 /***************************************************************************************
-** Function name:           setCursor
-** Description:             Set the text cursor x,y position
+** Function name:           drawWideLine
+** Description:             Draw an anti-aliased line wd pixels wide with round ends
 ***************************************************************************************/
-void TFT_eSPI::setCursor(int16_t x, int16_t y)
+// Narrows xs to xe to the x where lo < c + k * x < hi
+static void narrowRow(int32_t c, int32_t k, int32_t lo, int32_t hi, int32_t &xs, int32_t &xe)
 {
-  cursor_x = x;
-  cursor_y = y;
+  if (k == 0) {
+    if (c <= lo || c >= hi) xe = xs - 1;
+    return;
+  }
+  if (k < 0) { int32_t t = lo; lo = -hi; hi = -t; c = -c; k = -k; }
+  int32_t a = floorDiv(lo - c, k) + 1;
+  int32_t b = -floorDiv(c - hi, k) - 1;
+  if (a > xs) xs = a;
+  if (b < xe) xe = b;
 }
 
-
-/***************************************************************************************
-** Function name:           setCursor
-** Description:             Set the text cursor x,y position and font
-***************************************************************************************/
-void TFT_eSPI::setCursor(int16_t x, int16_t y, uint8_t font)
+void TFT_eSPI::drawWideLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t wd, uint32_t color, uint32_t bg)
 {
-  textfont = font;
-  cursor_x = x;
-  cursor_y = y;
-}
+  if (_vpOoB || wd < 1) return;
 
+  // Unit vector along the line and its length in 16.16, a dot is a line pointing right
+  int32_t dx = x1 - x0, dy = y1 - y0;
+  uint64_t len8 = isqrt<uint64_t>((uint64_t)((int64_t)dx * dx + (int64_t)dy * dy) << 16);
+  int32_t ux = 65536, uy = 0;
+  if (len8) { ux = ((int64_t)dx << 24) / (int64_t)len8; uy = ((int64_t)dy << 24) / (int64_t)len8; }
+  int32_t len = len8 << 8;
 
-/***************************************************************************************
-** Function name:           getCursorX
-** Description:             Get the text cursor x position
-***************************************************************************************/
-int16_t TFT_eSPI::getCursorX(void)
-{
-  return cursor_x;
-}
+  int32_t r8   = wd * 128;             // Half the width, 8.8
+  int32_t edge = (r8 + 128) << 8;      // Pixels are touched up to here from the centre line, 16.16
 
-/***************************************************************************************
-** Function name:           getCursorY
-** Description:             Get the text cursor y position
-***************************************************************************************/
-int16_t TFT_eSPI::getCursorY(void)
-{
-  return cursor_y;
-}
+  int32_t ys = (y0 < y1 ? y0 : y1) - wd / 2 - 1;
+  int32_t ye = (y0 > y1 ? y0 : y1) + wd / 2 + 1;
+  if (ys < _vpY - _yDatum) ys = _vpY - _yDatum;
+  if (ye > _vpH - _yDatum - 1) ye = _vpH - _yDatum - 1;
 
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
 
-/***************************************************************************************
-** Function name:           setTextSize
-** Description:             Set the text size multiplier
-***************************************************************************************/
-void TFT_eSPI::setTextSize(uint8_t s)
-{
-  if (s>7) s = 7; // Limit the maximum size multiplier so byte variables can be used for rendering
-  textsize = (s > 0) ? s : 1; // Don't allow font size 0
+  for (int32_t y = ys; y <= ye; y++) {
+    // Position of pixel x0 + px along and across the line is linear in px, so each row
+    // is cut to the pixels near the line by dividing rather than by testing every pixel
+    int32_t py = y - y0;
+    int32_t xs = _vpX - _xDatum - x0, xe = _vpW - _xDatum - 1 - x0;
+    narrowRow(py * ux, -uy, -edge, edge, xs, xe);
+    narrowRow(py * uy, ux, -edge, len + edge, xs, xe);
+
+    int32_t along = xs * ux + py * uy;
+    int32_t perp  = py * ux - xs * uy;
+    int32_t run = xs;
+    for (int32_t px = xs; px <= xe; px++, along += ux, perp -= uy) {
+      int32_t d;
+      if (along < 0 || along > len) {  // Round end, distance from the end point
+        int32_t a = (along < 0 ? along : along - len) >> 8;
+        int32_t p = perp >> 8;
+        d = isqrtSum((int64_t)a * a + (int64_t)p * p);
+      }
+      else d = abs(perp) >> 8;
+      int32_t alpha = coverage(r8 - d);
+
+      if (alpha == 256) continue;      // Solid pixels are drawn as runs
+      if (px > run) drawFastHLine(x0 + run, y, px - run, color);
+      run = px + 1;
+      blendPixel(x0 + px, y, alpha, color, bg);
+    }
+    if (xe >= run) drawFastHLine(x0 + run, y, xe + 1 - run, color);
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
 }
 
 
 /***************************************************************************************
-** Function name:           setTextColor
-** Description:             Set the font foreground colour (background is transparent)
+** Function name:           drawSmoothArc
+** Description:             Draw an anti-aliased ring section
 ***************************************************************************************/
-void TFT_eSPI::setTextColor(uint16_t c)
+// Widens the box b (x0, y0, x1, y1 from the centre) to the point at angle and radius
+static void arcBox(int32_t angle, int32_t radius, int32_t *b)
 {
-  // For 'transparent' background, we'll set the bg
-  // to the same as fg instead of using a flag
-  textcolor = textbgcolor = c;
+  int32_t px = (radius * sinDeg(angle)) >> 14, py = -(radius * cosDeg(angle)) >> 14;
+  if (px < b[0]) b[0] = px;
+  if (py < b[1]) b[1] = py;
+  if (px > b[2]) b[2] = px;
+  if (py > b[3]) b[3] = py;
+}
+
+void TFT_eSPI::drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, int32_t startAngle, int32_t endAngle, uint32_t color, uint32_t bg, bool smoothEnds)
+{
+  if (_vpOoB || r < 1 || ir >= r) return;
+  if (ir < 0) ir = 0;
+
+  int32_t span = (endAngle - startAngle) % 360;
+  if (span < 0) span += 360;
+  if (span == 0) {
+    if (endAngle == startAngle) return;
+    span = 360;
+  }
+
+  // Signed distance inside the start and end edges is linear in x and y, 2.14 x pixels
+  int32_t ss =  sinDeg(startAngle),        cs = cosDeg(startAngle);
+  int32_t se = -sinDeg(startAngle + span), ce = -cosDeg(startAngle + span);
+
+  // Squared distance limits of the ring, between them pixels are solid
+  int32_t inner = ir ? ir * ir + ir : -1, outer = r * r - r;
+
+  // Only the box around the section is scanned: its corners and the axes it crosses
+  int32_t box[4] = { -r - 1, -r - 1, r + 1, r + 1 };
+  if (span < 360) {
+    box[0] = box[1] = INT32_MAX; box[2] = box[3] = INT32_MIN;
+    arcBox(startAngle, r, box);        arcBox(startAngle, ir, box);
+    arcBox(startAngle + span, r, box); arcBox(startAngle + span, ir, box);
+    for (int32_t a = 0; a < 360; a += 90) {
+      if ((a - startAngle % 360 + 720) % 360 < span) arcBox(a, r, box);
+    }
+    box[0] -= 2; box[1] -= 2; box[2] += 2; box[3] += 2;
+  }
+
+  int32_t ys = y + box[1], ye = y + box[3];
+  if (ys < _vpY - _yDatum) ys = _vpY - _yDatum;
+  if (ye > _vpH - _yDatum - 1) ye = _vpH - _yDatum - 1;
+  int32_t vx0 = _vpX - _xDatum - x, vx1 = _vpW - _xDatum - 1 - x;
+  if (vx0 < box[0]) vx0 = box[0];
+  if (vx1 > box[2]) vx1 = box[2];
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  for (int32_t yp = ys; yp <= ye; yp++) {
+    int32_t py = yp - y;
+    int32_t rr = (r + 1) * (r + 1) - py * py;
+    if (rr < 0) continue;
+    int32_t xo = isqrt<uint32_t>(rr);
+    int32_t hh = (ir - 1) * (ir - 1) - py * py;
+    int32_t xh = (ir > 1 && hh > 0) ? isqrt<uint32_t>(hh) : 0;
+
+    // Left and right of the hole, or the whole row
+    for (int32_t side = 0; side < 2; side++) {
+      int32_t xs = side ? xh : -xo, xe = side ? xo : -xh;
+      if (!xh) { if (side) break; xe = xo; }
+      if (xs < vx0) xs = vx0;
+      if (xe > vx1) xe = vx1;
+
+      int32_t d2 = xs * xs + py * py;
+      int32_t ds = ss * py + cs * xs, de = ce * xs + se * py;
+      int32_t run = xs;
+      for (int32_t px = xs; px <= xe; px++, d2 += 2 * px - 1, ds += cs, de += ce) {
+        int32_t alpha = 256;
+        if (d2 > outer || d2 <= inner) { // Near an edge, distance from the centre in 8.8
+          int32_t d8 = isqrtSum((uint64_t)d2 << 12) << 2;
+          alpha = coverage(r * 256 - d8);
+          if (ir) { int32_t a = coverage(d8 - ir * 256); if (a < alpha) alpha = a; }
+        }
+        if (span < 360) {
+          // Cut ends take the pixels with their centre from the start up to before the end
+          int32_t a = smoothEnds ? coverage(ds >> 6) : (ds >= 0) << 8;
+          int32_t b = smoothEnds ? coverage(de >> 6) : (de > 0) << 8;
+          alpha = alpha * (span <= 180 ? (a < b ? a : b) : (a > b ? a : b)) >> 8;
+        }
+
+        if (alpha == 256) continue;    // Solid pixels are drawn as runs
+        if (px > run) drawFastHLine(x + run, yp, px - run, color);
+        run = px + 1;
+        if (alpha) blendPixel(x + px, yp, alpha > 255 ? 255 : alpha, color, bg);
+      }
+      if (xe >= run) drawFastHLine(x + run, yp, xe + 1 - run, color);
+    }
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+
+/***************************************************************************************
+** Function name:           drawBitmap
+** Description:             Draw an image stored in an array on the TFT
+***************************************************************************************/
+void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+{
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  int32_t i, j, byteWidth = (w + 7) / 8;
+
+  for (j = 0; j < h; j++) {
+    for (i = 0; i < w; i++ ) {
+      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
+        drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+
+/***************************************************************************************
+** Function name:           drawBitmap
+** Description:             Draw an image stored in an array on the TFT
+***************************************************************************************/
+void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor)
+{
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  int32_t i, j, byteWidth = (w + 7) / 8;
+
+  for (j = 0; j < h; j++) {
+    for (i = 0; i < w; i++ ) {
+      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7)))
+           drawPixel(x + i, y + j, fgcolor);
+      else drawPixel(x + i, y + j, bgcolor);
+    }
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+/***************************************************************************************
+** Function name:           drawXBitmap
+** Description:             Draw an image stored in an XBM array onto the TFT
+***************************************************************************************/
+void TFT_eSPI::drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+{
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  int32_t i, j, byteWidth = (w + 7) / 8;
+
+  for (j = 0; j < h; j++) {
+    for (i = 0; i < w; i++ ) {
+      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (1 << (i & 7))) {
+        drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+
+/***************************************************************************************
+** Function name:           drawXBitmap
+** Description:             Draw an XBM image with foreground and background colors
+***************************************************************************************/
+void TFT_eSPI::drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bgcolor)
+{
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  int32_t i, j, byteWidth = (w + 7) / 8;
+
+  for (j = 0; j < h; j++) {
+    for (i = 0; i < w; i++ ) {
+      if (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (1 << (i & 7)))
+           drawPixel(x + i, y + j,   color);
+      else drawPixel(x + i, y + j, bgcolor);
+    }
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+
+/***************************************************************************************
+** Function name:           setCursor
+** Description:             Set the text cursor x,y position
+***************************************************************************************/
+void TFT_eSPI::setCursor(int16_t x, int16_t y)
+{
+  cursor_x = x;
+  cursor_y = y;
+}
+
+
+/***************************************************************************************
+** Function name:           setCursor
+** Description:             Set the text cursor x,y position and font
+***************************************************************************************/
+void TFT_eSPI::setCursor(int16_t x, int16_t y, uint8_t font)
+{
+  textfont = font;
+  cursor_x = x;
+  cursor_y = y;
+}
+
+
+/***************************************************************************************
+** Function name:           getCursorX
+** Description:             Get the text cursor x position
+***************************************************************************************/
+int16_t TFT_eSPI::getCursorX(void)
+{
+  return cursor_x;
+}
+
+/***************************************************************************************
+** Function name:           getCursorY
+** Description:             Get the text cursor y position
+***************************************************************************************/
+int16_t TFT_eSPI::getCursorY(void)
+{
+  return cursor_y;
+}
+
+
+/***************************************************************************************
+** Function name:           setTextSize
+** Description:             Set the text size multiplier
+***************************************************************************************/
+void TFT_eSPI::setTextSize(uint8_t s)
+{
+  if (s>7) s = 7; // Limit the maximum size multiplier so byte variables can be used for rendering
+  textsize = (s > 0) ? s : 1; // Don't allow font size 0
+}
+
+
+/***************************************************************************************
+** Function name:           setTextColor
+** Description:             Set the font foreground colour (background is transparent)
+***************************************************************************************/
+void TFT_eSPI::setTextColor(uint16_t c)
+{
+  // For 'transparent' background, we'll set the bg
+  // to the same as fg instead of using a flag
+  textcolor = textbgcolor = c;
 }
 
 
@@ -2769,8 +3480,11 @@ int16_t TFT_eSPI::textWidth(const char *string, uint8_t font)
 
 #ifdef SMOOTH_FONT
   if(fontLoaded) {
-    while (*string) {
-      uniCode = decodeUTF8(*string++);
+    // Decoded as drawString() does, the characters before ascii are the bytes themselves
+    uint16_t len = strlen(string), n = 0;
+    uint16_t ascii = asciiLength(string, len);
+    while (n < len) {
+      uniCode = (n < ascii) ? (uint8_t)string[n++] : decodeUTF8((uint8_t*)string, &n, len - n);
       if (uniCode) {
         if (uniCode == 0x20) str_width += gFont.spaceWidth;
         else {
@@ -2778,7 +3492,7 @@ int16_t TFT_eSPI::textWidth(const char *string, uint8_t font)
           bool found = getUnicodeIndex(uniCode, &gNum);
           if (found) {
             if(str_width == 0 && gdX[gNum] < 0) str_width -= gdX[gNum];
-            if (*string || isDigits) str_width += gxAdvance[gNum];
+            if (n < len || isDigits) str_width += gxAdvance[gNum];
             else str_width += (gdX[gNum] + gWidth[gNum]);
           }
           else str_width += gFont.spaceWidth + 1;
@@ -2790,9 +3504,30 @@ int16_t TFT_eSPI::textWidth(const char *string, uint8_t font)
   }
 #endif
 
-  if (font>1 && font<9) {
+  const tftSpanFont *sf = spanFont(font);
+
+  // Leading digits are counted, not looked up, numbered fonts have one advance for all ten
+  uint8_t digit = 0;
+  if (sf) digit = spanDigits[font - 2];
+  else if (font > 1 && font < 9 && (fontsloaded & (1 << font))) digit = tftDigitWidth(font);
+  if (digit) {
+    const char *digits = string;
+    while (*string >= '0' && *string <= '9') string++;
+    str_width = (string - digits) * digit;
+  }
+
+  if (sf) {
+    while (*string) {
+      const tftSpanGlyph *g = spanGlyph(sf, (uint8_t)*string++);
+      if (g) str_width += pgm_read_byte(&g->advance);
+    }
+  }
+  else if (font>1 && font<9) {
     char *widthtable = (char *)pgm_read_dword( &(fontdata[font].widthtbl ) ) - 32; //subtract the 32 outside the loop
 
+    // Not compiled in, nothing is drawn
+    if (!(fontsloaded & (1 << font))) string = "";
+
     while (*string) {
       uniCode = *(string++);
       if (uniCode > 31 && uniCode < 128)
@@ -2805,13 +3540,15 @@ int16_t TFT_eSPI::textWidth(const char *string, uint8_t font)
 
 #ifdef LOAD_GFXFF
     if(gfxFont) { // New font
-      while (*string) {
-        uniCode = decodeUTF8(*string++);
+      uint16_t len = strlen(string), n = 0;
+      uint16_t ascii = asciiLength(string, len);
+      while (n < len) {
+        uniCode = (n < ascii) ? (uint8_t)string[n++] : decodeUTF8((uint8_t*)string, &n, len - n);
         if ((uniCode >= pgm_read_word(&gfxFont->first)) && (uniCode <= pgm_read_word(&gfxFont->last ))) {
           uniCode -= pgm_read_word(&gfxFont->first);
           GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[uniCode]);
           // If this is not the  last character or is a digit then use xAdvance
-          if (*string  || isDigits) str_width += pgm_read_byte(&glyph->xAdvance);
+          if (n < len || isDigits) str_width += pgm_read_byte(&glyph->xAdvance);
           // Else use the offset plus width since this can be bigger than xAdvance
           else str_width += ((int8_t)pgm_read_byte(&glyph->xOffset) + pgm_read_byte(&glyph->width));
         }
@@ -2859,6 +3596,7 @@ int16_t TFT_eSPI::fontHeight(int16_t font)
     }
   }
 #endif
+  if (spanFont(font)) return pgm_read_byte( &spanFont(font)->height ) * textsize;
   return pgm_read_byte( &fontdata[font].height ) * textsize;
 }
 
@@ -2920,6 +3658,9 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
     //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
     inTransaction = true;
 
+    tftPoint pts[40]; // Set pixels of a default size glyph, drawn as row spans
+    uint8_t  np = 0;
+
     for (int8_t i = 0; i < 6; i++ ) {
       uint8_t line;
       if (i == 5)
@@ -2929,7 +3670,7 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
 
       if (size == 1 && !fillbg) { // default size
         for (int8_t j = 0; j < 8; j++) {
-          if (line & 0x1) drawPixel(x + i, y + j, color);
+          if (line & 0x1) { pts[np].x = x + i; pts[np].y = y + j; np++; }
           line >>= 1;
         }
       }
@@ -2941,6 +3682,8 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
         }
       }
     }
+    if (np) drawPixels(pts, np, color);
+
     inTransaction = lockTransaction;
     end_tft_write();              // Does nothing if Sprite class uses this function
   }
@@ -2978,6 +3721,8 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
       }
 
       // GFXFF rendering speed up
+      tftSpan  batch[TFT_SPAN_BATCH];
+      uint32_t n = 0;
       uint16_t hpc = 0; // Horizontal foreground pixel count
       for(yy=0; yy<h; yy++) {
         for(xx=0; xx<w; xx++) {
@@ -2988,7 +3733,7 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
           if(bits & bit) hpc++;
           else {
            if (hpc) {
-              if(size == 1) drawFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
+              if(size == 1) addSpan(batch, n, x+xo+xx-hpc, y+yo+yy, hpc, color);
               else fillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
               hpc=0;
             }
@@ -2997,11 +3742,12 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
         }
         // Draw pixels for this line as we are about to increment yy
         if (hpc) {
-          if(size == 1) drawFastHLine(x+xo+xx-hpc, y+yo+yy, hpc, color);
+          if(size == 1) addSpan(batch, n, x+xo+xx-hpc, y+yo+yy, hpc, color);
           else fillRect(x+(xo16+xx-hpc)*size, y+(yo16+yy)*size, size*hpc, size, color);
           hpc=0;
         }
       }
+      drawSpanList(batch, n, color);
 
       inTransaction = lockTransaction;
       end_tft_write();              // Does nothing if Sprite class uses this function
@@ -3017,6 +3763,193 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
 }
 
 
+/***************************************************************************************
+** Function name:           gfxGlyph
+** Description:             Free font glyph of a character, nullptr if not in the font
+***************************************************************************************/
+#ifdef LOAD_GFXFF
+GFXglyph *TFT_eSPI::gfxGlyph(uint16_t c)
+{
+  if (!gfxFont || c < pgm_read_word(&gfxFont->first) || c > pgm_read_word(&gfxFont->last)) return nullptr;
+  return &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c - pgm_read_word(&gfxFont->first)]);
+}
+
+
+/***************************************************************************************
+** Function name:           drawCharCell
+** Description:             Draw an opaque free font text cell through one window
+***************************************************************************************/
+// Columns cl to cr - 1 of the text line with baseline y, c has its origin at x. Glyphs
+// may reach into the next cell so prev and next (0 for none) are drawn where they do,
+// drawStringCells() checks with cellsHoldInk() that no glyph reaches further.
+// Returns false, having drawn nothing, if the cell is not wholly in the viewport or is
+// wider than TFT_CELL_WIDTH
+bool TFT_eSPI::drawCharCell(int32_t x, int32_t y, uint16_t prev, uint16_t c, uint16_t next, int32_t cl, int32_t cr, uint32_t color, uint32_t bg)
+{
+  int32_t w = cr - cl;
+  if (w < 1) return true;
+  if (w > TFT_CELL_WIDTH) return false;
+
+  int32_t h  = (glyph_ab + glyph_bb) * textsize;
+  int32_t xd = cl + _xDatum;
+  int32_t yd = y - glyph_ab * textsize + _yDatum;
+  if (_vpOoB || xd < _vpX || yd < _vpY || xd + w > _vpW || yd + h > _vpH) return false;
+
+  // Glyph origins relative to the cell
+  GFXglyph *glyph[3] = { gfxGlyph(prev), gfxGlyph(c), gfxGlyph(next) };
+  int32_t   gx[3];
+  gx[1] = x - cl;
+  gx[0] = glyph[0] ? gx[1] - pgm_read_byte(&glyph[0]->xAdvance) * textsize : 0;
+  gx[2] = glyph[1] ? gx[1] + pgm_read_byte(&glyph[1]->xAdvance) * textsize : 0;
+  uint8_t *bitmap = (uint8_t *)pgm_read_dword(&gfxFont->bitmap);
+
+  // pushPixels() sends the buffer as it is in RAM unless bytes are swapped
+  uint16_t fg = color, bgc = bg;
+  if (!_swapBytes) { fg = fg >> 8 | fg << 8; bgc = bgc >> 8 | bgc << 8; }
+
+  uint16_t line[TFT_CELL_WIDTH];
+
+  begin_tft_write();
+  setWindow(xd, yd, xd + w - 1, yd + h - 1);
+
+  for (int32_t fy = -glyph_ab; fy < glyph_bb; fy++) {
+    for (int32_t i = 0; i < w; i++) line[i] = bgc;
+
+    for (int32_t g = 0; g < 3; g++) {
+      if (!glyph[g]) continue;
+      uint8_t gw = pgm_read_byte(&glyph[g]->width);
+      int32_t gy = fy - (int8_t)pgm_read_byte(&glyph[g]->yOffset);
+      if (gy < 0 || gy >= pgm_read_byte(&glyph[g]->height)) continue;
+
+      int32_t  px  = gx[g] + (int8_t)pgm_read_byte(&glyph[g]->xOffset) * textsize;
+      if (px >= w || px + gw * textsize <= 0) continue;
+      uint32_t bit = pgm_read_word(&glyph[g]->bitmapOffset) * 8 + gy * gw;
+      for (int32_t i = 0; i < gw; i++, bit++, px += textsize) {
+        if (!(pgm_read_byte(&bitmap[bit >> 3]) & (0x80 >> (bit & 7)))) continue;
+        for (int32_t s = 0; s < textsize; s++) if (px + s >= 0 && px + s < w) line[px + s] = fg;
+      }
+    }
+
+    for (int32_t s = 0; s < textsize; s++) pushPixels(line, w);
+  }
+
+  end_tft_write();
+  return true;
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           cellsHoldInk
+** Description:             Check no glyph reaches past the cells either side of its own
+***************************************************************************************/
+// The cells are laid out as drawStringCells() does, from left to right - 1. Ink outside
+// them, such as a '_' running past the end of the text, would be cut off too
+#ifdef LOAD_GFXFF
+bool TFT_eSPI::cellsHoldInk(const char *string, int32_t poX, int32_t left, int32_t right)
+{
+  uint16_t len = strlen(string), n = 0;
+  uint16_t ascii = asciiLength(string, len);
+
+  int32_t x = poX;                      // Origin of the glyph being checked
+  int32_t prevStart = left;             // Start of the cell before it
+  int32_t inkRight[2] = { left, left }; // Right ink edge of the glyphs two and one before it
+  bool    first = true;
+
+  while (n < len) {
+    uint16_t c = (n < ascii) ? (uint8_t)string[n++] : decodeUTF8((uint8_t*)string, &n, len - n);
+    if (!c) continue;
+
+    GFXglyph *glyph = gfxGlyph(c);
+    int32_t   cs = first ? left : x;    // This cell's start, the end of the one before
+    int32_t   il = cs, ir = left;
+
+    if (glyph && pgm_read_byte(&glyph->width)) {
+      il = x + (int8_t)pgm_read_byte(&glyph->xOffset) * textsize;
+      ir = il + pgm_read_byte(&glyph->width) * textsize;
+    }
+
+    // This glyph may reach into the cell before, the one two back may reach into this one
+    if (il < prevStart || ir > right) return false;
+    if (inkRight[0] > cs) return false;
+
+    prevStart = cs;
+    inkRight[0] = inkRight[1]; inkRight[1] = ir;
+    first = false;
+    if (glyph) x += pgm_read_byte(&glyph->xAdvance) * textsize;
+  }
+
+  return true;
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           drawStringCells
+** Description:             Draw opaque free font text one glyph cell at a time
+***************************************************************************************/
+// Replaces a fill of the text box from left to right - 1 with glyphs drawn over it, so
+// each pixel is written once. Returns the width added up as drawChar() would
+#ifdef LOAD_GFXFF
+int16_t TFT_eSPI::drawStringCells(const char *string, int32_t poX, int32_t poY, int32_t left, int32_t right)
+{
+  uint16_t len = strlen(string), n = 0;
+  uint16_t prev = 0, c = 0, next;
+  int32_t  sumX = 0, cl = left;
+  int32_t  top = poY - glyph_ab * textsize, h = (glyph_ab + glyph_bb) * textsize;
+
+  uint16_t ascii = asciiLength(string, len);
+
+  // A cell only has its own glyph and its neighbours' drawn in it. Ink reaching two cells
+  // away (italic fonts, tight advances) or out of the box needs the box filled and drawn over
+  if (!cellsHoldInk(string, poX, left, right)) {
+    fillRect(left, top, right - left, h, textbgcolor);
+    while (n < len) {
+      c = (n < ascii) ? (uint8_t)string[n++] : decodeUTF8((uint8_t*)string, &n, len - n);
+      GFXglyph *glyph = gfxGlyph(c);
+      if (!glyph) continue;
+      drawChar(poX + sumX, poY, c, textcolor, textbgcolor, textsize);
+      sumX += pgm_read_byte(&glyph->xAdvance) * textsize;
+    }
+    return sumX;
+  }
+
+  while (n < len && !c) c = (n < ascii) ? (uint8_t)string[n++] : decodeUTF8((uint8_t*)string, &n, len - n);
+
+  while (c) {
+    next = 0;
+    while (n < len && !next) next = (n < ascii) ? (uint8_t)string[n++] : decodeUTF8((uint8_t*)string, &n, len - n);
+
+    GFXglyph *glyph = gfxGlyph(c);
+    int32_t x  = poX + sumX;
+    int32_t cr = right;
+    if (glyph) sumX += pgm_read_byte(&glyph->xAdvance) * textsize;
+    if (next) cr = poX + sumX;
+
+    if (!drawCharCell(x, poY, prev, c, next, cl, cr, textcolor, textbgcolor) && cr > cl) {
+      // Clipped or too wide: fill the cell, then draw the glyphs that reach into it
+      fillRect(cl, top, cr - cl, h, textbgcolor);
+      GFXglyph *pg = gfxGlyph(prev), *ng = gfxGlyph(next);
+      if (pg) {
+        int32_t px = x - pgm_read_byte(&pg->xAdvance) * textsize;
+        if (px + ((int8_t)pgm_read_byte(&pg->xOffset) + pgm_read_byte(&pg->width)) * textsize > cl)
+          drawChar(px, poY, prev, textcolor, textbgcolor, textsize);
+      }
+      drawChar(x, poY, c, textcolor, textbgcolor, textsize);
+      if (ng && cr + (int8_t)pgm_read_byte(&ng->xOffset) * textsize < cr)
+        drawChar(cr, poY, next, textcolor, textbgcolor, textsize);
+    }
+
+    cl = cr;
+    prev = c;
+    c = next;
+  }
+
+  return sumX;
+}
+#endif
+
+
 /***************************************************************************************
 ** Function name:           setAddrWindow
 ** Description:             define an area to receive a stream of pixels
@@ -3040,10 +3973,11 @@ void TFT_eSPI::setAddrWindow(int32_t x0, int32_t y0, int32_t w, int32_t h)
 void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 {
   //begin_tft_write(); // Must be called before setWindow
-  addr_row = 0xFFFF;
-  addr_col = 0xFFFF;
+  DMA_QUEUE_CHECK;
+  win_row  = -1;
 
 #if defined (ILI9225_DRIVER)
+  resetWindowCache(); // The whole window is sent, drawPixel() must set its own again
   if (rotation & 0x01) { swap_coord(x0, y0); swap_coord(x1, y1); }
   SPI_BUSY_CHECK;
   DC_C; tft_Write_8(TFT_CASET1);
@@ -3065,6 +3999,7 @@ void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
   DC_C; tft_Write_8(TFT_RAMWR);
   DC_D;
 #elif defined (SSD1351_DRIVER)
+  resetWindowCache(); // The whole window is sent, drawPixel() must set its own again
   if (rotation & 1) {
     swap_coord(x0, y0);
     swap_coord(x1, y1);
@@ -3127,10 +4062,25 @@ void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 
   #else
     SPI_BUSY_CHECK;
+    #if defined (TFT_WINDOW_CACHE)
+    // The TFT keeps the window between calls, only send the ranges that changed
+    if (x0 != win_xs || x1 != win_xe) {
+      DC_C; tft_Write_8(TFT_CASET);
+      DC_D; tft_Write_32C(x0, x1);
+      win_xs = x0; win_xe = x1;
+    }
+    if (y0 != win_ys || y1 != win_ye) {
+      DC_C; tft_Write_8(TFT_PASET);
+      DC_D; tft_Write_32C(y0, y1);
+      win_ys = y0; win_ye = y1;
+    }
+    #else
     DC_C; tft_Write_8(TFT_CASET);
     DC_D; tft_Write_32C(x0, x1);
     DC_C; tft_Write_8(TFT_PASET);
     DC_D; tft_Write_32C(y0, y1);
+    resetWindowCache(); // drawPixel() must not rely on its last coordinates
+    #endif
     DC_C; tft_Write_8(TFT_RAMWR);
     DC_D;
   #endif // RP2040 SPI
@@ -3139,6 +4089,32 @@ void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 }
 
 
+/***************************************************************************************
+** Function name:           setRowWindow
+** Description:             define a one row window, continuing the last one if adjacent
+***************************************************************************************/
+// Chip select stays low, call begin_tft_write first. Exactly xe - xs + 1 pixels must be
+// pushed before the next graphics call
+void TFT_eSPI::setRowWindow(int32_t xs, int32_t y, int32_t xe)
+{
+#if defined (TFT_WINDOW_CACHE) && !defined (SSD1963_DRIVER) // SSD1963 swaps x and y in setWindow
+  // The last run left the RAM pointer at the start of this one
+  if (y == win_row && xs == win_row_xs && xe == win_row_xe) {
+    win_row++;
+    return;
+  }
+
+  // Open the window to the bottom of the screen so the next row can carry on
+  setWindow(xs, y, xe, _height - 1);
+  win_row = y + 1;
+  win_row_xs = xs;
+  win_row_xe = xe;
+#else
+  setWindow(xs, y, xe, y);
+#endif
+}
+
+
 /***************************************************************************************
 ** Function name:           readAddrWindow
 ** Description:             define an area to read a stream of pixels
@@ -3150,8 +4126,7 @@ void TFT_eSPI::readAddrWindow(int32_t xs, int32_t ys, int32_t w, int32_t h)
   int32_t xe = xs + w - 1;
   int32_t ye = ys + h - 1;
 
-  addr_col = 0xFFFF;
-  addr_row = 0xFFFF;
+  resetWindowCache();
 
 #ifdef CGRAM_OFFSET
   xs += colstart;
@@ -3248,8 +4223,9 @@ void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
   SPI_BUSY_CHECK;
 
   // Set window to full screen to optimise sequential pixel rendering
-  if (addr_row != 0x9225) {
-    addr_row = 0x9225; // addr_row used for flag
+  if (win_xs != 0 || win_xe != 175 || win_ys != 0 || win_ye != 219) {
+    win_xs = 0; win_xe = 175;
+    win_ys = 0; win_ye = 219;
     DC_C; tft_Write_8(TFT_CASET1);
     DC_D; tft_Write_16(0);
     DC_C; tft_Write_8(TFT_CASET2);
@@ -3356,33 +4332,34 @@ void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
   DC_D; tft_Write_32D(y);
 #elif defined (SSD1351_DRIVER)
   // No need to send x if it has not changed (speeds things up)
-  if (addr_col != x) {
+  if (win_xs != x || win_xe != x) {
     DC_C; tft_Write_8(TFT_CASET);
     DC_D; tft_Write_16(x | (x << 8));
-    addr_col = x;
+    win_xs = win_xe = x;
   }
 
   // No need to send y if it has not changed (speeds things up)
-  if (addr_row != y) {
+  if (win_ys != y || win_ye != y) {
     DC_C; tft_Write_8(TFT_PASET);
     DC_D; tft_Write_16(y | (y << 8));
-    addr_row = y;
+    win_ys = win_ye = y;
   }
 #else
   // No need to send x if it has not changed (speeds things up)
-  if (addr_col != x) {
+  if (win_xs != x || win_xe != x) {
     DC_C; tft_Write_8(TFT_CASET);
     DC_D; tft_Write_32D(x);
-    addr_col = x;
+    win_xs = win_xe = x;
   }
 
   // No need to send y if it has not changed (speeds things up)
-  if (addr_row != y) {
+  if (win_ys != y || win_ye != y) {
     DC_C; tft_Write_8(TFT_PASET);
     DC_D; tft_Write_32D(y);
-    addr_row = y;
+    win_ys = win_ye = y;
   }
 #endif
+  win_row = -1;
   DC_C; tft_Write_8(TFT_RAMWR);
   
   #if defined(TFT_PARALLEL_8_BIT) || !defined(ESP32)
@@ -3607,7 +4584,7 @@ void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 
   begin_tft_write();
 
-  setWindow(x, y, x + w - 1, y);
+  setRowWindow(x, y, x + w - 1);
 
   pushBlock(color, w);
 
@@ -3650,6 +4627,14 @@ void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t col
 
   setWindow(x, y, x + w - 1, y + h - 1);
 
+#ifdef STM32_DMA_QUEUE
+  // Returns while the DMA sends, the next TFT access waits for it to end
+  if (DMA_Enabled && w * h >= DMA_FILL_MIN) {
+    dmaCommand c = { -1, 0, 0, 0, nullptr, (uint32_t)(w * h), (uint16_t)color };
+    dmaQueueAdd(&c);
+  }
+  else
+#endif
   pushBlock(color, w * h);
 
   end_tft_write();
@@ -3836,28 +4821,22 @@ uint16_t TFT_eSPI::decodeUTF8(uint8_t c)
 *************************************************************************************x*/
 uint16_t TFT_eSPI::decodeUTF8(uint8_t *buf, uint16_t *index, uint16_t remaining)
 {
-  uint16_t c = buf[(*index)++];
-  //Serial.print("Byte from string = 0x"); Serial.println(c, HEX);
-
-  if (!_utf8) return c;
-
-  // 7 bit Unicode
-  if ((c & 0x80) == 0x00) return c;
+  if (!_utf8) return buf[(*index)++];
 
-  // 11 bit Unicode
-  if (((c & 0xE0) == 0xC0) && (remaining > 1))
-    return ((c & 0x1F)<<6) | (buf[(*index)++]&0x3F);
+  return tftDecodeUTF8(buf, index, remaining); // See Fonts/Utf8.h
+}
 
-  // 16 bit Unicode
-  if (((c & 0xF0) == 0xE0) && (remaining > 2)) {
-    c = ((c & 0x0F)<<12) | ((buf[(*index)++]&0x3F)<<6);
-    return  c | ((buf[(*index)++]&0x3F));
-  }
 
-  // 21 bit Unicode not supported so fall-back to extended ASCII
-  // if ((c & 0xF8) == 0xF0) return c;
+/***************************************************************************************
+** Function name:           asciiLength
+** Description:             Length of the start of a string that needs no decoding
+***************************************************************************************/
+// The text functions take the characters before this as they are and decode the rest
+uint16_t TFT_eSPI::asciiLength(const char *string, uint16_t len)
+{
+  if (!_utf8) return len;
 
-  return c; // fall-back to extended ASCII
+  return tftAsciiLength((const uint8_t *)string, len);
 }
 
 
@@ -3945,22 +4924,123 @@ size_t TFT_eSPI::write(uint8_t utf8)
 
   uint16_t uniCode = decodeUTF8(utf8);
 
-  if (!uniCode) return 1;
+  if (uniCode) printChar(uniCode);
+
+  return 1;
+}
+
+
+/***************************************************************************************
+** Function name:           write
+** Description:             draw a run of characters piped through serial stream
+***************************************************************************************/
+// Print sends strings here, not byte by byte through the virtual write(uint8_t). The run
+// is drawn as one transaction, so the chip select is not toggled between characters and
+// a glyph can continue the RAM write of the window above it
+size_t TFT_eSPI::write(const uint8_t *buffer, size_t size)
+{
+  if (_vpOoB) return size;
+
+  // The characters end their drawing with inTransaction = lockTransaction, so the lock is
+  // held as by startWrite() and given back as it was, in case the sketch holds it too
+  bool sketchLock = lockTransaction;
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  lockTransaction = true;
+  inTransaction = true;
+
+  // Opaque size 1 span font characters are collected while they fit on the cursor line and
+  // drawn together by printRun(). Newlines, wraps and characters the font does not have end
+  // the run and go through printChar() as before
+  const tftSpanFont *sf = spanFont(textfont);
+#ifdef SMOOTH_FONT
+  if (fontLoaded) sf = nullptr;
+#endif
+#ifdef LOAD_GFXFF
+  if (gfxFont) sf = nullptr;
+#endif
+  if (sf && (textsize != 1 || textcolor == textbgcolor || pgm_read_byte(&sf->alpha))) sf = nullptr;
+
+  const tftSpanGlyph *run[TFT_PRINT_RUN];
+  uint16_t code[TFT_PRINT_RUN];
+  uint8_t  n = 0;
+  int32_t  runX = 0, runW = 0;
+
+  // The ASCII start of the run is printed as it is, what the serial decoder would return
+  size_t ascii = _utf8 ? tftAsciiLength(buffer, size) : 0;
+  if (ascii) decoderState = 0;
+
+  for (size_t i = 0; i < size; i++) {
+    uint16_t uniCode = (i < ascii) ? buffer[i] : decodeUTF8(buffer[i]);
+    if (!uniCode) continue;
+    if (!sf) { printChar(uniCode); continue; }
+
+    const tftSpanGlyph *g = (uniCode < 32) ? nullptr : spanGlyph(sf, uniCode);
+    int32_t cw = g ? pgm_read_byte(&g->advance) : 0;
+    bool    wrap = textwrapX && (cursor_x + cw > width());
 
-  if (utf8 == '\r') return 1;
+    if (n && (!g || wrap || n == TFT_PRINT_RUN || runW + cw > TFT_SPAN_PIXELS)) {
+      printRun(runX, sf, run, code, n);
+      n = 0;
+    }
+    if (!g || wrap) { printChar(uniCode); continue; }
+
+    if (!n) {
+      if (textwrapY && (cursor_y >= (int32_t) height())) cursor_y = 0;
+      runX = cursor_x;
+      runW = 0;
+    }
+    run[n] = g;
+    code[n++] = uniCode;
+    runW += cw;
+    cursor_x += cw;
+  }
+  if (n) printRun(runX, sf, run, code, n);
+
+  lockTransaction = sketchLock;
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+
+  return size;
+}
+
+
+/***************************************************************************************
+** Function name:           printRun
+** Description:             draw span font characters laid out by write()
+***************************************************************************************/
+// The cursor has already moved past them. If they cannot be sent as one window they are
+// drawn one at a time as printChar() would
+void TFT_eSPI::printRun(int32_t x, const tftSpanFont *sf, const tftSpanGlyph * const *g, const uint16_t *c, uint8_t n)
+{
+  if (pushSpanGlyphs(x, cursor_y, sf, g, n)) return;
+
+  for (uint8_t i = 0; i < n; i++) x += drawChar(c[i], x, cursor_y, textfont);
+}
+
+
+/***************************************************************************************
+** Function name:           printChar
+** Description:             draw a decoded character at the cursor
+***************************************************************************************/
+void TFT_eSPI::printChar(uint16_t uniCode)
+{
+  if (uniCode == '\r') return;
 
 #ifdef SMOOTH_FONT
   if(fontLoaded) {
-    if (uniCode < 32 && utf8 != '\n') return 1;
+    if (uniCode < 32 && uniCode != '\n') return;
 
     drawGlyph(uniCode);
 
-    return 1;
+    return;
   }
 #endif
 
-  if (uniCode == '\n') uniCode+=22; // Make it a valid space character to stop errors
-  else if (uniCode < 32) return 1;
+  bool newline = (uniCode == '\n');
+
+  if (newline) uniCode+=22; // Make it a valid space character to stop errors
+  else if (uniCode < 32) return;
 
   uint16_t cwidth = 0;
   uint16_t cheight = 0;
@@ -3977,9 +5057,11 @@ size_t TFT_eSPI::write(uint8_t utf8)
 #endif
 //<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
+  const tftSpanFont *sf = spanFont(textfont);
+
 #ifdef LOAD_FONT2
-  if (textfont == 2) {
-    if (uniCode > 127) return 1;
+  if (textfont == 2 && !sf) {
+    if (uniCode > 127) return;
 
     cwidth = pgm_read_byte(widtbl_f16 + uniCode-32);
     cheight = chr_hgt_f16;
@@ -3994,8 +5076,8 @@ size_t TFT_eSPI::write(uint8_t utf8)
 
 #ifdef LOAD_RLE
   {
-    if ((textfont>2) && (textfont<9)) {
-      if (uniCode > 127) return 1;
+    if ((textfont>2) && (textfont<9) && !sf) {
+      if (uniCode > 127 || !(fontsloaded & (1 << textfont))) return;
       // Uses the fontinfo struct array to avoid lots of 'if' or 'switch' statements
       cwidth = pgm_read_byte( (uint8_t *)pgm_read_dword( &(fontdata[textfont].widthtbl ) ) + uniCode-32 );
       cheight= pgm_read_byte( &fontdata[textfont].height );
@@ -4003,18 +5085,25 @@ size_t TFT_eSPI::write(uint8_t utf8)
   }
 #endif
 
+  if (sf) {
+    const tftSpanGlyph *g = spanGlyph(sf, uniCode);
+    if (!g) { spanMissing = uniCode; return; }
+    cwidth  = pgm_read_byte(&g->advance);
+    cheight = pgm_read_byte(&sf->height);
+  }
+
 #ifdef LOAD_GLCD
   if (textfont==1) {
       cwidth =  6;
       cheight = 8;
   }
 #else
-  if (textfont==1) return 1;
+  if (textfont==1) return;
 #endif
 
   cheight = cheight * textsize;
 
-  if (utf8 == '\n') {
+  if (newline) {
     cursor_y += cheight;
     cursor_x  = 0;
   }
@@ -4031,12 +5120,12 @@ size_t TFT_eSPI::write(uint8_t utf8)
 #ifdef LOAD_GFXFF
   } // Custom GFX font
   else {
-    if(utf8 == '\n') {
+    if(newline) {
       cursor_x  = 0;
       cursor_y += (int16_t)textsize * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
     } else {
-      if (uniCode > pgm_read_word(&gfxFont->last )) return 1;
-      if (uniCode < pgm_read_word(&gfxFont->first)) return 1;
+      if (uniCode > pgm_read_word(&gfxFont->last )) return;
+      if (uniCode < pgm_read_word(&gfxFont->first)) return;
 
       uint16_t   c2    = uniCode - pgm_read_word(&gfxFont->first);
       GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c2]);
@@ -4057,8 +5146,6 @@ size_t TFT_eSPI::write(uint8_t utf8)
   }
 #endif // LOAD_GFXFF
 //<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
-
-  return 1;
 }
 
 
@@ -4112,6 +5199,12 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
 #endif
   }
 
+  const tftSpanFont *sf = spanFont(font);
+  if (sf) return drawSpanChar(uniCode, x, y, sf);
+
+  // The tables of a font not compiled in are a one entry placeholder
+  if ((font>1) && (font<9) && !(fontsloaded & (1 << font))) return 0;
+
   if ((font>1) && (font<9) && ((uniCode < 32) || (uniCode > 127))) return 0;
 
   int32_t width  = 0;
@@ -4160,6 +5253,9 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
       //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
       inTransaction = true;
 
+      tftSpan  batch[TFT_SPAN_BATCH];
+      uint32_t n = 0;
+
       for (int32_t i = 0; i < height; i++) {
         if (textcolor != textbgcolor) fillRect(x, pY, width * textsize, textsize, textbgcolor);
 
@@ -4167,15 +5263,14 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
           line = pgm_read_byte((uint8_t *)flash_address + w * i + k);
           if (line) {
             if (textsize == 1) {
+              // Runs of set bits become spans, drawSpanList() joins runs across bytes
               pX = x + k * 8;
-              if (line & 0x80) drawPixel(pX, pY, textcolor);
-              if (line & 0x40) drawPixel(pX + 1, pY, textcolor);
-              if (line & 0x20) drawPixel(pX + 2, pY, textcolor);
-              if (line & 0x10) drawPixel(pX + 3, pY, textcolor);
-              if (line & 0x08) drawPixel(pX + 4, pY, textcolor);
-              if (line & 0x04) drawPixel(pX + 5, pY, textcolor);
-              if (line & 0x02) drawPixel(pX + 6, pY, textcolor);
-              if (line & 0x01) drawPixel(pX + 7, pY, textcolor);
+              for (int32_t b = 0; b < 8; ) {
+                if (!(line & (0x80 >> b))) { b++; continue; }
+                int32_t bs = b;
+                while (b < 8 && (line & (0x80 >> b))) b++;
+                addSpan(batch, n, pX + bs, pY, b - bs, textcolor);
+              }
             }
             else {
               pX = x + k * 8 * textsize;
@@ -4192,6 +5287,7 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
         }
         pY += textsize;
       }
+      drawSpanList(batch, n, textcolor);
 
       inTransaction = lockTransaction;
       end_tft_write();
@@ -4347,6 +5443,299 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
 }
 
 
+/***************************************************************************************
+** Function name:           spanGlyph
+** Description:             Find the glyph of a span font character
+***************************************************************************************/
+const tftSpanGlyph *TFT_eSPI::spanGlyph(const tftSpanFont *sf, uint16_t c)
+{
+  uint16_t first = pgm_read_word(&sf->first);
+  if (c < first || c > pgm_read_word(&sf->last)) return nullptr;
+  const tftSpanGlyph *g = (const tftSpanGlyph *)pgm_read_dword(&sf->glyph) + (c - first);
+  return pgm_read_byte(&g->advance) ? g : nullptr;
+}
+
+
+/***************************************************************************************
+** Function name:           drawSpanChar
+** Description:             Draw a span font character as lines and rectangles
+***************************************************************************************/
+// Each run is one line, rows repeated k times one rectangle k rows high, so no pixel
+// is looked at. Opaque size 1 characters are sent as one window by pushSpanGlyphs()
+int16_t TFT_eSPI::drawSpanChar(uint16_t c, int32_t x, int32_t y, const tftSpanFont *sf)
+{
+  const tftSpanGlyph *g = spanGlyph(sf, c);
+  if (!g) { spanMissing = c; return 0; }
+
+  int32_t width = pgm_read_byte(&g->advance) * textsize;
+  if (_vpOoB) return width;
+
+  if (pgm_read_byte(&sf->alpha)) {
+    drawAlphaGlyph(x, y, sf, g);
+    return width;
+  }
+
+  bool opaque = textcolor != textbgcolor;
+  if (opaque && pushSpanGlyphs(x, y, sf, &g, 1)) return width;
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  if (opaque) fillRect(x, y, width, pgm_read_byte(&sf->height) * textsize, textbgcolor);
+
+  const uint8_t *p   = (const uint8_t *)pgm_read_dword(&sf->rows) + pgm_read_word(&g->offset);
+  const uint8_t *row = p;
+  int32_t gx   = x + (int8_t)pgm_read_byte(&g->xOffset) * textsize;
+  int32_t gy   = y + (int8_t)pgm_read_byte(&g->yOffset) * textsize;
+  uint8_t rows = pgm_read_byte(&g->rows);
+
+  while (rows) {
+    uint8_t n = pgm_read_byte(p++), k = 1;
+    const uint8_t *r = p;
+    if (n & 0x80) { k = (n & 0x7F) + 1; r = row; n = pgm_read_byte(r++); }
+    else { row = p - 1; p += 2 * n; }
+
+    int32_t px = gx, h = k * textsize;
+    while (n--) {
+      px += pgm_read_byte(r++) * textsize;
+      int32_t len = pgm_read_byte(r++) * textsize;
+      if (h == 1) drawFastHLine(px, gy, len, textcolor);
+      else fillRect(px, gy, len, h, textcolor);
+      px += len;
+    }
+    gy   += h;
+    rows -= k;
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+
+  return width;
+}
+
+
+/***************************************************************************************
+** Function name:           pushSpanGlyphs
+** Description:             Send opaque span font characters through one window
+***************************************************************************************/
+// Whole rows of the cells with their background are built in a buffer and sent a few at
+// a time, in place of a fill of each cell and a window for every run drawn over it
+bool TFT_eSPI::pushSpanGlyphs(int32_t x, int32_t y, const tftSpanFont *sf, const tftSpanGlyph * const *g, uint8_t n)
+{
+  if (textsize != 1 || n < 1 || n > TFT_PRINT_RUN) return false;
+
+  struct {
+    const uint8_t *p, *r; // Next row of runs, runs of the row being built
+    int32_t x, y, rows;   // Glyph box left in the line and top in the cell
+    uint8_t k;            // More rows that are the same as r
+  } cell[TFT_PRINT_RUN];
+
+  int32_t w = 0;
+  int32_t h = pgm_read_byte(&sf->height);
+  const uint8_t *data = (const uint8_t *)pgm_read_dword(&sf->rows);
+
+  for (uint8_t c = 0; c < n; c++) {
+    int32_t cw = pgm_read_byte(&g[c]->advance);
+    int32_t gx = (int8_t)pgm_read_byte(&g[c]->xOffset);
+    int32_t gy = (int8_t)pgm_read_byte(&g[c]->yOffset);
+    int32_t gr = pgm_read_byte(&g[c]->rows);
+
+    // Set pixels outside the cell would be cut off
+    if (gr && (gx < 0 || gy < 0 || gx + pgm_read_byte(&g[c]->width) > cw || gy + gr > h)) return false;
+
+    cell[c].p = cell[c].r = data + pgm_read_word(&g[c]->offset);
+    cell[c].x = w + gx;
+    cell[c].y = gy;
+    cell[c].rows = gr;
+    cell[c].k = 0;
+    w += cw;
+  }
+  if (w < 1 || w > TFT_SPAN_PIXELS) return false;
+
+  int32_t xd = x + _xDatum;
+  int32_t yd = y + _yDatum;
+  if (xd < _vpX || yd < _vpY || xd + w > _vpW || yd + h > _vpH) return false;
+
+  // pushPixels() sends the buffer as it is in RAM unless bytes are swapped
+  uint16_t fg = textcolor, bg = textbgcolor;
+  if (!_swapBytes) { fg = fg >> 8 | fg << 8; bg = bg >> 8 | bg << 8; }
+
+  uint16_t buf[TFT_SPAN_PIXELS];
+  int32_t  lines = TFT_SPAN_PIXELS / w, filled = 0;
+
+  begin_tft_write();
+  setWindow(xd, yd, xd + w - 1, yd + h - 1);
+
+  for (int32_t j = 0; j < h; j++) {
+    uint16_t *line = buf + filled * w;
+    for (int32_t i = 0; i < w; i++) line[i] = bg;
+
+    for (uint8_t c = 0; c < n; c++) {
+      if (j < cell[c].y || j >= cell[c].y + cell[c].rows) continue;
+
+      const uint8_t *&p = cell[c].p;
+      if (cell[c].k) cell[c].k--;
+      else if (pgm_read_byte(p) & 0x80) cell[c].k = pgm_read_byte(p++) & 0x7F;
+      else { cell[c].r = p; p += 1 + 2 * pgm_read_byte(p); }
+
+      uint16_t *px = line + cell[c].x;
+      const uint8_t *s = cell[c].r;
+      for (uint8_t runs = pgm_read_byte(s++); runs; runs--) {
+        px += pgm_read_byte(s++);
+        for (uint8_t len = pgm_read_byte(s++); len; len--) *px++ = fg;
+      }
+    }
+
+    if (++filled == lines || j == h - 1) {
+      pushPixels(buf, filled * w);
+      filled = 0;
+    }
+  }
+
+  end_tft_write();
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           alphaLut
+** Description:             Colours of the 16 alpha levels between two colours
+***************************************************************************************/
+// Only made again when the text colours change, so an anti-aliased pixel is a table
+// look up and not a blend
+const uint16_t *TFT_eSPI::alphaLut(uint16_t fg, uint16_t bg)
+{
+  if (!aaLutValid || fg != aaLutFg || bg != aaLutBg) {
+    for (uint8_t a = 0; a < 16; a++) aaLut[a] = alphaBlend(a * 17, fg, bg);
+    aaLutFg = fg;
+    aaLutBg = bg;
+    aaLutValid = true;
+  }
+  return aaLut;
+}
+
+
+/***************************************************************************************
+** Function name:           drawAlphaGlyph
+** Description:             Draw an anti-aliased span font character
+***************************************************************************************/
+// Opaque size 1 characters are sent as one window by pushAlphaGlyph(). Otherwise the
+// cell is filled and each run of pixels with the same alpha is one line in its colour
+// from the blend table. Transparent text has no background colour to blend with, so
+// the edges are blended with the setCallback() colour of each pixel if there is one,
+// or drawn in the text colour where they are at least half covered
+void TFT_eSPI::drawAlphaGlyph(int32_t x, int32_t y, const tftSpanFont *sf, const tftSpanGlyph *g)
+{
+  bool opaque = textcolor != textbgcolor;
+  if (opaque && pushAlphaGlyph(x, y, sf, g)) return;
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  if (opaque) fillRect(x, y, pgm_read_byte(&g->advance) * textsize, pgm_read_byte(&sf->height) * textsize, textbgcolor);
+
+  const uint16_t *lut = alphaLut(textcolor, textbgcolor);
+  const uint8_t  *p   = (const uint8_t *)pgm_read_dword(&sf->rows) + pgm_read_word(&g->offset);
+  int32_t gx   = x + (int8_t)pgm_read_byte(&g->xOffset) * textsize;
+  int32_t gy   = y + (int8_t)pgm_read_byte(&g->yOffset) * textsize;
+  int32_t w    = pgm_read_byte(&g->width);
+  uint8_t rows = pgm_read_byte(&g->rows);
+
+  for (; rows; rows--, gy += textsize, p += (w + 1) >> 1) {
+    uint8_t level = 0;
+    int32_t start = 0;
+    for (int32_t i = 0; i <= w; i++) {
+      uint8_t a = 0;
+      if (i < w) a = (i & 1) ? pgm_read_byte(p + (i >> 1)) & 0x0F : pgm_read_byte(p + (i >> 1)) >> 4;
+
+      if (!opaque && a < 15) {
+        if (a && getColor) {
+          int32_t px = gx + i * textsize;
+          uint16_t color = alphaBlend(a * 17, textcolor, getColor(px, gy));
+          if (textsize == 1) drawPixel(px, gy, color);
+          else fillRect(px, gy, textsize, textsize, color);
+          a = 0;
+        }
+        else a = (a < 8) ? 0 : 15;
+      }
+
+      if (i < w && a == level) continue;
+      if (level) {
+        int32_t len = (i - start) * textsize;
+        if (textsize == 1) drawFastHLine(gx + start, gy, len, lut[level]);
+        else fillRect(gx + start * textsize, gy, len, textsize, lut[level]);
+      }
+      level = a;
+      start = i;
+    }
+  }
+
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+}
+
+
+/***************************************************************************************
+** Function name:           pushAlphaGlyph
+** Description:             Send an opaque anti-aliased character through one window
+***************************************************************************************/
+// As pushSpanGlyph(), with each pixel of the glyph box taken from the blend table by its
+// alpha, so every pixel of the cell is written once
+bool TFT_eSPI::pushAlphaGlyph(int32_t x, int32_t y, const tftSpanFont *sf, const tftSpanGlyph *g)
+{
+  int32_t w = pgm_read_byte(&g->advance);
+  int32_t h = pgm_read_byte(&sf->height);
+  if (textsize != 1 || w < 1 || w > TFT_SPAN_PIXELS) return false;
+
+  // Pixels outside the cell would be cut off
+  int32_t gx   = (int8_t)pgm_read_byte(&g->xOffset);
+  int32_t gy   = (int8_t)pgm_read_byte(&g->yOffset);
+  int32_t gw   = pgm_read_byte(&g->width);
+  int32_t rows = pgm_read_byte(&g->rows);
+  if (rows && (gx < 0 || gy < 0 || gx + gw > w || gy + rows > h)) return false;
+
+  int32_t xd = x + _xDatum;
+  int32_t yd = y + _yDatum;
+  if (xd < _vpX || yd < _vpY || xd + w > _vpW || yd + h > _vpH) return false;
+
+  // pushPixels() sends the buffer as it is in RAM unless bytes are swapped
+  const uint16_t *blend = alphaLut(textcolor, textbgcolor);
+  uint16_t lut[16];
+  for (uint8_t a = 0; a < 16; a++) lut[a] = _swapBytes ? blend[a] : (blend[a] >> 8 | blend[a] << 8);
+
+  uint16_t buf[TFT_SPAN_PIXELS];
+  int32_t  lines = TFT_SPAN_PIXELS / w, filled = 0;
+  const uint8_t *p = (const uint8_t *)pgm_read_dword(&sf->rows) + pgm_read_word(&g->offset);
+
+  begin_tft_write();
+  setWindow(xd, yd, xd + w - 1, yd + h - 1);
+
+  for (int32_t j = 0; j < h; j++) {
+    uint16_t *line = buf + filled * w;
+    for (int32_t i = 0; i < w; i++) line[i] = lut[0];
+
+    if (j >= gy && j < gy + rows) {
+      uint16_t *px = line + gx;
+      int32_t i = gw;
+      for (; i > 1; i -= 2) {
+        uint8_t b = pgm_read_byte(p++);
+        *px++ = lut[b >> 4];
+        *px++ = lut[b & 0x0F];
+      }
+      if (i) *px = lut[pgm_read_byte(p++) >> 4];
+    }
+
+    if (++filled == lines || j == h - 1) {
+      pushPixels(buf, filled * w);
+      filled = 0;
+    }
+  }
+
+  end_tft_write();
+  return true;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawString (with or without user defined font)
 ** Description :            draw string with padding if it is defined
@@ -4412,7 +5801,8 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
   else
 #endif
   if (font!=1) {
-    baseline = pgm_read_byte( &fontdata[font].baseline ) * textsize;
+    if (spanFont(font)) baseline = pgm_read_byte( &spanFont(font)->baseline ) * textsize;
+    else baseline = pgm_read_byte( &fontdata[font].baseline ) * textsize;
     cheight = fontHeight(font);
   }
 
@@ -4475,6 +5865,7 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
 
   int8_t xo = 0;
 #ifdef LOAD_GFXFF
+  bool cells = false;
   if (freeFont && (textcolor!=textbgcolor)) {
       cheight = (glyph_ab + glyph_bb) * textsize;
       // Get the offset for the first character only to allow for negative offsets
@@ -4494,7 +5885,8 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
         // Add 1 pixel of padding all round
         //cheight +=2;
         //fillRect(poX+xo-1, poY - 1 - glyph_ab * textsize, cwidth+2, cheight, textbgcolor);
-        fillRect(poX+xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+        // The box is filled glyph cell by glyph cell with the glyphs, see drawStringCells()
+        cells = true;
       }
       padding -=100;
     }
@@ -4518,6 +5910,8 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
 */
     setCursor(poX, poY);
 
+    uint16_t ascii = asciiLength(string, len);
+    while (n < ascii) drawGlyph((uint8_t)string[n++]);
     while (n < len) {
       uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
       drawGlyph(uniCode);
@@ -4526,14 +5920,34 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
     //fontFile.close();
   }
   else
+#endif
+#ifdef LOAD_GFXFF
+  if (cells) sumX = drawStringCells(string, poX, poY, poX + xo, poX + xo + cwidth);
+  else
 #endif
   {
+    uint16_t ascii = asciiLength(string, len);
+    while (n < ascii) sumX += drawChar((uint8_t)string[n++], poX+sumX, poY, font);
     while (n < len) {
       uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
       sumX += drawChar(uniCode, poX+sumX, poY, font);
     }
   }
 
+  // The glyph cells, for redrawString()
+  textBox.x = poX;
+  textBox.y = poY;
+  textBox.w = sumX;
+  textBox.h = cheight;
+#ifdef LOAD_GFXFF
+  if (freeFont) {
+    textBox.x = poX + xo;
+    textBox.y = poY - glyph_ab * textsize;
+    textBox.w = cwidth;
+    textBox.h = (glyph_ab + glyph_bb) * textsize;
+  }
+#endif
+
 //vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv DEBUG vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv
 // Switch on debugging for the padding areas
 //#define PADDING_DEBUG
@@ -4601,6 +6015,48 @@ return sumX;
 }
 
 
+/***************************************************************************************
+** Function name:           redrawString
+** Description:             draw a string over an old one, clearing what it leaves
+***************************************************************************************/
+int16_t TFT_eSPI::redrawString(const String& string, int32_t poX, int32_t poY, uint8_t font, tftRect *box)
+{
+  int16_t len = string.length() + 2;
+  char buffer[len];
+  string.toCharArray(buffer, len);
+  return redrawString(buffer, poX, poY, font, box);
+}
+
+// drawString() records the box of the glyph cells it drew. Opaque cells write their
+// background, so the old text is only cleared where the new box does not reach, and
+// without padding nothing else is written. Smooth fonts fill their box before drawing
+// the glyphs, so they write the glyph pixels twice whatever is done here
+int16_t TFT_eSPI::redrawString(const char *string, int32_t poX, int32_t poY, uint8_t font, tftRect *box)
+{
+  bool opaque = (textcolor != textbgcolor);
+  bool sketchLock = lockTransaction;
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  lockTransaction = true;
+  inTransaction = true;
+
+  int32_t padding = padX;
+  padX = 0;
+  textBox.w = 0;
+  int16_t sumX = drawString(string, poX, poY, font);
+  padX = padding;
+
+  if (opaque) fillRectOutside(box, &textBox, textbgcolor);
+  *box = textBox;
+
+  lockTransaction = sketchLock;
+  inTransaction = lockTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+
+  return sumX;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawCentreString (deprecated, use setTextDatum())
 ** Descriptions:            draw string centred on dX
@@ -4668,6 +6124,28 @@ int16_t TFT_eSPI::drawNumber(long long_num, int32_t poX, int32_t poY, uint8_t fo
 }
 
 
+/***************************************************************************************
+** Function name:           fixedString
+** Descriptions:            Format a fixed point number
+***************************************************************************************/
+// Writes [-]whole[.fraction], the fraction zero padded to decimal digits, returns str
+static char *fixedString(char *str, bool negative, uint32_t whole, uint32_t fraction, uint8_t decimal)
+{
+  char *p = str;
+  if (negative) *p++ = '-';
+  ultoa(whole, p, 10); // whole may be 2^31, out of ltoa() range
+  while (*p) p++;
+
+  if (decimal) {
+    *p++ = '.';
+    p += decimal;
+    *p = 0;
+    for (char *d = p; decimal--; fraction /= 10) *--d = '0' + fraction % 10;
+  }
+  return str;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawFloat
 ** Descriptions:            drawFloat, prints 7 non zero digits maximum
@@ -4679,66 +6157,89 @@ int16_t TFT_eSPI::drawFloat(float floatNumber, uint8_t dp, int32_t poX, int32_t
   return drawFloat(floatNumber, dp, poX, poY, textfont);
 }
 
+// The number is taken apart from its bits as m x 2^e and rounded to dp decimals with integer
+// shifts and one multiply, processors without an FPU do not run any soft float code
 int16_t TFT_eSPI::drawFloat(float floatNumber, uint8_t dp, int32_t poX, int32_t poY, uint8_t font)
 {
   isDigits = true;
   char str[14];               // Array to contain decimal string
-  uint8_t ptr = 0;            // Initialise pointer for array
-  int8_t  digits = 1;         // Count the digits to avoid array overflow
-  float rounding = 0.5;       // Round up down delta
 
   if (dp > 7) dp = 7; // Limit the size of decimal portion
 
-  // Adjust the rounding value
-  for (uint8_t i = 0; i < dp; ++i) rounding /= 10.0;
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < dp; i++) scale *= 10;
 
-  if (floatNumber < -rounding) {   // add sign, avoid adding - sign to 0.0!
-    str[ptr++] = '-'; // Negative number
-    str[ptr] = 0; // Put a null in the array as a precaution
-    digits = 0;   // Set digits to 0 to compensate so pointer value can be used later
-    floatNumber = -floatNumber; // Make positive
-  }
-
-  floatNumber += rounding; // Round up or down
+  uint32_t bits;
+  memcpy(&bits, &floatNumber, sizeof(bits));
+  bool     negative = bits >> 31;
+  int32_t  e = (bits >> 23) & 0xFF;
+  uint32_t m = bits & 0x7FFFFF;
 
   // For error put ... in string and return (all TFT_eSPI library fonts contain . character)
-  if (floatNumber >= 2147483647) {
+  // Infinity, not a number and magnitudes of 2^31 and over
+  if (e == 0xFF || e > 150 + 7) {
     strcpy(str, "...");
     return drawString(str, poX, poY, font);
   }
-  // No chance of overflow from here on
 
-  // Get integer part
-  uint32_t temp = (uint32_t)floatNumber;
+  if (e) m |= 0x800000; // Implied leading 1, else subnormal
+  else e = 1;
+  e -= 150;             // Number is m x 2^e
 
-  // Put integer part into array
-  ltoa(temp, str + ptr, 10);
+  uint32_t whole, fraction = 0;
+  if (e >= 0) whole = m << e;
+  else {
+    uint32_t sh = -e;
+    whole = (sh < 32) ? m >> sh : 0;
+    // Fraction bits x scale, rounded. Under 2^48, so it is 0 if shifted by 60 or more
+    if (sh < 60) {
+      uint64_t r = (sh < 32) ? (m & ((1UL << sh) - 1)) : m;
+      fraction = (r * scale + (1ULL << (sh - 1))) >> sh;
+      if (fraction >= scale) { whole++; fraction = 0; }
+    }
+  }
 
-  // Find out where the null is to get the digit count loaded
-  while ((uint8_t)str[ptr] != 0) ptr++; // Move the pointer along
-  digits += ptr;                  // Count the digits
+  // Avoid adding - sign to 0.0!
+  negative = negative && (whole || fraction);
 
-  str[ptr++] = '.'; // Add decimal point
-  str[ptr] = '0';   // Add a dummy zero
-  str[ptr + 1] = 0; // Add a null but don't increment pointer so it can be overwritten
+  // Limit digit count so we don't get a false sense of resolution, 8 digits in all
+  int8_t digits = 1;
+  for (uint32_t w = whole; w >= 10; w /= 10) digits++;
+  int8_t decimals = 8 - digits;
+  if (decimals > dp) decimals = dp;
 
-  // Get the decimal portion
-  floatNumber = floatNumber - temp;
+  // No decimals room left, or none asked for, still ends with .0
+  if (decimals <= 0) return drawString(fixedString(str, negative, whole, 0, 1), poX, poY, font);
 
-  // Get decimal digits one by one and put in array
-  // Limit digit count so we don't get a false sense of resolution
-  uint8_t i = 0;
-  while ((i < dp) && (digits < 9)) { // while (i < dp) for no limit but array size must be increased
-    i++;
-    floatNumber *= 10;       // for the next decimal
-    temp = floatNumber;      // get the decimal
-    ltoa(temp, str + ptr, 10);
-    ptr++; digits++;         // Increment pointer and digits count
-    floatNumber -= temp;     // Remove that digit
-  }
+  for (int8_t i = decimals; i < dp; i++) fraction /= 10;
 
   // Finally we can plot the string and return pixel length
-  return drawString(str, poX, poY, font);
+  return drawString(fixedString(str, negative, whole, fraction, decimals), poX, poY, font);
+}
+
+
+/***************************************************************************************
+** Function name:           drawFixed
+** Descriptions:            Draw a fixed point number, value / 10^dp
+***************************************************************************************/
+int16_t TFT_eSPI::drawFixed(int32_t value, uint8_t dp, int32_t poX, int32_t poY)
+{
+  return drawFixed(value, dp, poX, poY, textfont);
+}
+
+int16_t TFT_eSPI::drawFixed(int32_t value, uint8_t dp, int32_t poX, int32_t poY, uint8_t font)
+{
+  isDigits = true;
+  char str[14];
+
+  if (dp > 9) dp = 9;
+
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < dp; i++) scale *= 10;
+
+  uint32_t magnitude = (value < 0) ? 0 - (uint32_t)value : value;
+
+  return drawString(fixedString(str, value < 0, magnitude / scale, magnitude % scale, dp), poX, poY, font);
 }
 
 
@@ -4764,7 +6265,7 @@ void TFT_eSPI::setFreeFont(const GFXfont *f)
   uint16_t numChars = pgm_read_word(&gfxFont->last) - pgm_read_word(&gfxFont->first);
 
   // Find the biggest above and below baseline offsets
-  for (uint8_t c = 0; c < numChars; c++) {
+  for (uint16_t c = 0; c <= numChars; c++) {
     GFXglyph *glyph1  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c]);
     int8_t ab = -pgm_read_byte(&glyph1->yOffset);
     if (ab > glyph_ab) glyph_ab = ab;
@@ -4810,6 +6311,83 @@ void TFT_eSPI::setTextFont(uint8_t f)
 #endif
 
 
+/***************************************************************************************
+** Function name:           setSpanFont
+** Description:             Draw a numbered font from span encoded glyphs
+***************************************************************************************/
+const tftSpanFont *TFT_eSPI::spanFonts[7];
+uint8_t  TFT_eSPI::spanDigits[7];
+uint16_t TFT_eSPI::spanMissing;
+
+// Numbered fonts compiled in, as set in init(). Their bits stay set when a span font is
+// taken off them
+static const uint16_t builtInFonts = 0
+#ifdef LOAD_FONT2
+  | 0x0004
+#endif
+#ifdef LOAD_FONT4
+  | 0x0010
+#endif
+#ifdef LOAD_FONT6
+  | 0x0040
+#endif
+#ifdef LOAD_FONT7
+  | 0x0080
+#endif
+#ifdef LOAD_FONT8
+  | 0x0100
+#endif
+  ;
+
+void TFT_eSPI::setSpanFont(uint8_t font, const tftSpanFont *spans)
+{
+  if (font < 2 || font > 8) return;
+  spanFonts[font - 2] = spans;
+  spanDigits[font - 2] = 0;
+  if (!spans) {
+    // Back to the built in font, or to none if it is not compiled in
+    fontsloaded = (fontsloaded & ~(1 << font)) | (builtInFonts & (1 << font));
+    return;
+  }
+  fontsloaded |= 1 << font;
+
+  // textWidth() counts digits if a trimmed font still has all ten
+  const tftSpanGlyph *g = spanGlyph(spans, '0');
+  uint8_t digit = g ? pgm_read_byte(&g->advance) : 0;
+  for (uint8_t c = '1'; c <= '9' && digit; c++) {
+    g = spanGlyph(spans, c);
+    if (!g || pgm_read_byte(&g->advance) != digit) digit = 0;
+  }
+  spanDigits[font - 2] = digit;
+}
+
+
+/***************************************************************************************
+** Function name:           missingGlyph
+** Description:             Find characters a span font cannot draw
+***************************************************************************************/
+// Fonts trimmed by tools/font_compiler only have the characters the firmware was built
+// with, so the firmware can check at startup that every string it draws is there
+uint16_t TFT_eSPI::missingGlyph(uint8_t font, const char *string)
+{
+  const tftSpanFont *sf = spanFont(font);
+  if (!sf) return 0;
+
+  while (*string) {
+    uint8_t c = *string++;
+    if (!spanGlyph(sf, c)) return c;
+  }
+  return 0;
+}
+
+uint16_t TFT_eSPI::missingGlyph(void)
+{
+  uint16_t c = spanMissing;
+  spanMissing = 0;
+  return c;
+}
+
+
 /***************************************************************************************
 ** Function name:           getSPIinstance
 ** Description:             Get the instance of the SPI class
@@ -4976,6 +6554,12 @@ void TFT_eSPI::getSetup(setup_t &tft_settings)
 
 #include "Extensions/Sprite.cpp"
 
+#include "Extensions/DisplayList.cpp"
+
+#include "Extensions/ArcMeter.cpp"
+
+#include "Extensions/DigitAtlas.cpp"
+
 #ifdef SMOOTH_FONT
   #include "Extensions/Smooth_font.cpp"
 #endif
@@ -167,6 +167,12 @@
   #include <User_Setups/User_Custom_Fonts.h>
 #endif // #ifdef LOAD_GFXFF
 
+// Widths and heights of the numbered fonts for compile time layout, loaded or not
+#include <Fonts/FontMetrics.h>
+
+// UTF-8 decoding that skips the ASCII start of a string
+#include <Fonts/Utf8.h>
+
 // Create a null default font in case some fonts not used (to prevent crash)
 const  uint8_t widtbl_null[1] = {0};
 PROGMEM const uint8_t chr_null[1] = {0};
@@ -378,8 +384,62 @@ swap_coord(T& a, T& b) { T t = a; a = b; b = t; }
 // Callback prototype for smooth font pixel colour read
 typedef uint16_t (*getColorCallback)(uint16_t x, uint16_t y);
 
+// Callback prototype for pushBands(), renders rows row to row + lines - 1 of the area into band
+typedef void (*renderBandCallback)(uint16_t* band, int32_t row, int32_t lines);
+
+// Point and horizontal span (w pixels from x,y to the right) for drawPixels() and drawSpans()
+typedef struct { int16_t x, y; } tftPoint;
+typedef struct { int16_t x, y, w; } tftSpan;
+
+// Rectangle, e.g. the box of text for redrawString(), w = 0 for none
+typedef struct { int16_t x, y, w, h; } tftRect;
+
+// Span encoded font made by tools/font_compiler for setSpanFont(). Each row of a glyph box
+// is a run count n followed by n (skip, run) byte pairs, skip counted from the end of the
+// last run, or 0x80 | (k - 1) for the last row again k more times. An anti-aliased font
+// made with --aa has alpha 4 and rows of 4 bit alpha pixels instead, two to a byte with
+// the left pixel in the high nibble, each row starting on a whole byte
+typedef struct {
+  uint16_t offset;           // First row in tftSpanFont rows
+  uint8_t  advance;          // Character cell width, the cursor step, 0 if left out of the font
+  uint8_t  width, rows;      // Box around the set pixels, no rows for a blank glyph
+  int8_t   xOffset, yOffset; // Box top left relative to the cell top left
+} tftSpanGlyph;
+
+typedef struct {
+  const uint8_t      *rows;
+  const tftSpanGlyph *glyph;
+  uint16_t first, last;      // Character codes of the first and last glyph
+  uint8_t  height, baseline; // Cell height and baseline row, as the numbered fonts
+  uint8_t  alpha;            // 4 for 4 bit alpha rows, 0 for span encoded rows
+} tftSpanFont;
+
+// Spans collected on the stack by the outline primitives before they are drawn
+#define TFT_SPAN_BATCH 16
+
+// Widest glyph cell drawStringCells() sends in one window, wider cells are filled first
+#ifndef TFT_CELL_WIDTH
+  #define TFT_CELL_WIDTH 64
+#endif
+
+// Pixels of span font rows built on the stack and sent together, a wider cell is filled first
+#ifndef TFT_SPAN_PIXELS
+  #define TFT_SPAN_PIXELS 256
+#endif
+
+// Span font characters write() lays out on a line before sending them as one window
+#ifndef TFT_PRINT_RUN
+  #define TFT_PRINT_RUN 16
+#endif
+
+// Sloped edges fillPolygon() keeps in its edge table, each takes 27 bytes of stack while it
+// runs. Polygons with more are drawn by a slower fill that needs no table
+#ifndef TFT_POLY_EDGES
+  #define TFT_POLY_EDGES 24
+#endif
+
 // Class functions and variables
-class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has access to protected members
+class TFT_eSPI : public Print { friend class TFT_eSprite; friend class TFT_eDigitAtlas; // Sprite and atlas classes have access to protected members
 
  //--------------------------------------- public ------------------------------------//
  public:
@@ -436,8 +496,9 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Write a set of pixels stored in memory, use setSwapBytes(true/false) function to correct endianess
   void     pushPixels(const void * data_in, uint32_t len);
 
-           // Read the colour of a pixel at x,y and return value in 565 format 
-  uint16_t readPixel(int32_t x, int32_t y);
+           // Read the colour of a pixel at x,y and return value in 565 format, virtual so the
+           // anti-aliased functions drawing in a Sprite read the Sprite
+  virtual uint16_t readPixel(int32_t x, int32_t y);
 
            // Support for half duplex (bi-directional SDA) SPI bus where MOSI must be switched to input
            #ifdef TFT_SDA_READ
@@ -467,6 +528,33 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            drawTriangle(int32_t x1,int32_t y1, int32_t x2,int32_t y2, int32_t x3,int32_t y3, uint32_t color),
            fillTriangle(int32_t x1,int32_t y1, int32_t x2,int32_t y2, int32_t x3,int32_t y3, uint32_t color);
 
+           // Any simple or concave polygon, the last corner joins the first. Each row is drawn as
+           // merged spans, stacked equal spans continue the RAM write, so it sends less than the
+           // same shape made of fillTriangle() calls. Above TFT_POLY_EDGES sloped edges every row
+           // scans all the edges, which is slower
+  void     fillPolygon(const tftPoint *points, uint16_t count, uint32_t color);
+
+           // Anti-aliased lines and arcs. Edge pixels are blended with bg, without bg they are
+           // blended with what is there already: a Sprite reads its own buffer, the TFT reads
+           // the pixel back (slow, and only possible if the TFT can be read)
+  void     drawSmoothLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color, uint32_t bg = 0x00FFFFFF),
+           // Line wd pixels wide with round ends, positions along it are 16.16 so up to 32000 pixels long
+           drawWideLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t wd, uint32_t color, uint32_t bg = 0x00FFFFFF),
+           // Ring between radius ir and r from startAngle clockwise to endAngle, in degrees with
+           // 0 at 12 o'clock. Equal angles draw nothing, 0 to 360 the whole ring. Without
+           // smoothEnds the ends are cut sharp, so sections that meet leave no seam or overlap
+           drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, int32_t startAngle, int32_t endAngle, uint32_t color, uint32_t bg = 0x00FFFFFF, bool smoothEnds = true);
+
+           // Many pixels or horizontal spans of one colour. The array is sorted in place (top to
+           // bottom, then left to right), touching and overlapping entries are merged and the rest
+           // is drawn in one transaction, so a row costs one window and a stack of spans with the
+           // same ends continues the RAM write. drawSpans() only reorders the caller's spans
+  void     drawPixels(tftPoint *points, uint32_t count, uint32_t color),
+           drawSpans(tftSpan *spans, uint32_t count, uint32_t color);
+
+           // Fill the part of area that is outside keep, as up to four rectangles
+  void     fillRectOutside(const tftRect *area, const tftRect *keep, uint32_t color);
+
   // Image rendering
            // Swap the byte order for pushImage() and pushPixels() - corrects endianness
   void     setSwapBytes(bool swap);
@@ -519,6 +607,10 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            drawFloat(float floatNumber, uint8_t decimal, int32_t x, int32_t y, uint8_t font), // Draw float using specified font number
            drawFloat(float floatNumber, uint8_t decimal, int32_t x, int32_t y),               // Draw float using current font
 
+           // Draw value / 10^decimal, e.g. 234 with 1 decimal is 23.4, formatted without floating point
+           drawFixed(int32_t value, uint8_t decimal, int32_t x, int32_t y, uint8_t font),     // Draw fixed point using specified font number
+           drawFixed(int32_t value, uint8_t decimal, int32_t x, int32_t y),                   // Draw fixed point using current font
+
            // Handle char arrays
            // Use with setTextDatum() to position string on TFT, and setTextPadding() to blank old displayed strings
            drawString(const char *string, int32_t x, int32_t y, uint8_t font),  // Draw string using specified font number
@@ -526,6 +618,13 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            drawString(const String& string, int32_t x, int32_t y, uint8_t font),// Draw string using specified font number
            drawString(const String& string, int32_t x, int32_t y),              // Draw string using current font
 
+           // Draw string over the text drawn before in box, in place of setTextPadding(). Opaque
+           // text clears only the part of the old box its glyph cells do not cover, so no pixel
+           // is written twice. Transparent text has no colour to clear with and is drawn over
+           // the old text. box is set to the box of the new text, start with w = 0
+           redrawString(const char *string, int32_t x, int32_t y, uint8_t font, tftRect *box),
+           redrawString(const String& string, int32_t x, int32_t y, uint8_t font, tftRect *box),
+
            drawCentreString(const char *string, int32_t x, int32_t y, uint8_t font),  // Deprecated, use setTextDatum() and drawString()
            drawRightString(const char *string, int32_t x, int32_t y, uint8_t font),   // Deprecated, use setTextDatum() and drawString()
            drawCentreString(const String& string, int32_t x, int32_t y, uint8_t font),// Deprecated, use setTextDatum() and drawString()
@@ -558,6 +657,19 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            setTextFont(uint8_t font);                       // Set the font number to use in future
 #endif
 
+           // Draw font number 2 to 8 from span encoded glyphs made by tools/font_compiler, NULL
+           // goes back to the built in font. The font does not need to be loaded in the setup
+           // file, numbers 3 and 5 are free. The fonts are shared by the TFT and all Sprites.
+           // Anti-aliased fonts are blended between the text colours, transparent text has
+           // its edges blended with the setCallback() colour or cut at half coverage
+  void     setSpanFont(uint8_t font, const tftSpanFont *spans);
+
+           // First character of string that span font number font does not have, 0 if it has
+           // them all or is not a span font. Without arguments, the last character a span font
+           // was asked for and did not have since the previous call, 0 if none
+  uint16_t missingGlyph(uint8_t font, const char *string),
+           missingGlyph(void);
+
   int16_t  textWidth(const char *string, uint8_t font),     // Returns pixel width of string in specified font
            textWidth(const char *string),                   // Returns pixel width of string in current font
            textWidth(const String& string, uint8_t font),   // As above for String types
@@ -569,8 +681,15 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   uint16_t decodeUTF8(uint8_t *buf, uint16_t *index, uint16_t remaining),
            decodeUTF8(uint8_t c);
 
+           // Bytes at the start of a string that are characters as they are, no decoding needed
+  uint16_t asciiLength(const char *string, uint16_t len);
+
            // Support function to UTF8 decode and draw characters piped through print stream
   size_t   write(uint8_t);
+           // As above for a run of characters, e.g. from print() or printf(), drawn in one transaction.
+           // Opaque size 1 span font text is laid out first and each line sent as one window
+  size_t   write(const uint8_t *buffer, size_t size);
+  using    Print::write;
   
            // Used by Smooth font class to fetch a pixel colour for the anti-aliasing
   void     setCallback(getColorCallback getCol);
@@ -638,6 +757,11 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // function will wait for the DMA to complete, so this may defeat any DMA performance benefit.
            //
 
+           // STM32F1: after initDMA() solid fills of DMA_FILL_MIN pixels or more by fillRect(), fillScreen()
+           // and text padding go through the DMA queue (see queueFill() below) and are sent from one colour
+           // word. Between startWrite() and endWrite() they return at once and the CPU is only held up by
+           // the next TFT access while DMA is busy.
+
   bool     initDMA(bool ctrl_cs = false);  // Initialise the DMA engine and attach to SPI bus - typically used in setup()
                                            // Parameter "true" enables DMA engine control of TFT chip select (ESP32 only)
                                            // For ESP32 only, TFT reads will not work if parameter is true
@@ -654,10 +778,41 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Push a block of pixels into a window set up using setAddrWindow()
   void     pushPixelsDMA(uint16_t* image, uint32_t len);
 
+#if defined (STM32_DMA) && !defined (TFT_PARALLEL_8_BIT)
+           // Send the area x,y,w,h in bands of "lines" rows, each rendered by the callback into
+           // buf0 and buf1 in turn. The next band is rendered while DMA sends the last one, so a
+           // full screen redraw takes about the bus time alone. The window is set once and all bands
+           // continue the same RAM write. On STM32F1 the DMA end interrupt starts each band. The area
+           // must be inside the viewport, w x lines at most 32767 pixels. Render pixels in TFT byte
+           // order like a 16 bit Sprite, or swap with setSwapBytes(true). buf1 may be nullptr for a
+           // single buffer. Returns when the last band is sent. Works without initDMA() too, just
+           // without the overlap. STM32 with SPI only at present
+  void     pushBands(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t lines,
+                     uint16_t* buf0, uint16_t* buf1, renderBandCallback render);
+#endif
+
            // Check if the DMA is complete - use while(tft.dmaBusy); for a blocking wait
   bool     dmaBusy(void); // returns true if DMA is still in progress
   void     dmaWait(void); // wait until DMA is complete
 
+#ifdef STM32_DMA_QUEUE
+           // Queue a filled rectangle or an image to be sent by DMA and return at once, the DMA end
+           // interrupt sets the window and starts each command in turn. Must be called between
+           // startWrite() and endWrite(): the queue does not select the TFT itself, it only sends
+           // while the chip select is held low. Any other TFT function or endWrite() waits for the
+           // queue to empty. Only waits here if DMA_QUEUE_SIZE commands are already queued. Without
+           // initDMA() they draw at once in their own transaction. Image pixels are sent as they
+           // are in RAM, in TFT byte order like a 16 bit Sprite
+  void     queueFill(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color),
+           queueImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+           // A fence marks everything queued so far. An image buffer may be reused once a fence
+           // taken after it was queued has passed
+  uint32_t queueFence(void);
+  bool     fencePassed(uint32_t fence);
+  void     fenceWait(uint32_t fence);
+#endif
+
   bool     DMA_Enabled = false;   // Flag for DMA enabled state
   uint8_t  spiBusyCheck = 0;      // Number of ESP32 transfer buffers to check
 
@@ -722,6 +877,85 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Same as setAddrWindow but exits with CGRAM in read mode
   void     readAddrWindow(int32_t xs, int32_t ys, int32_t w, int32_t h);
 
+           // Window for a single row of xe - xs + 1 pixels which MUST all be pushed before the
+           // next graphics call. The window is left open to the bottom of the screen so a run on
+           // the next row with the same columns continues the RAM write without any commands.
+  void     setRowWindow(int32_t xs, int32_t y, int32_t xe);
+
+           // Forget the address window held by the TFT so the next window sends CASET and PASET
+  inline void resetWindowCache(void) { win_xs = win_ys = INT32_MIN; win_row = -1; }
+
+           // drawSpans() without the transaction, for functions that already hold one. Unlike
+           // drawSpans() it works in the array given: merged spans are written over the entries
+           // and drawn ones get w = 0, so it is only passed scratch batches
+  void     drawSpanList(tftSpan *spans, uint32_t count, uint32_t color);
+
+           // fillPolygon() for more edges than TFT_POLY_EDGES
+  void     fillPolygonRows(const tftPoint *points, uint16_t count, uint32_t color);
+
+           // Adds a span to a batch of TFT_SPAN_BATCH, drawing the batch when it is full
+  void     addSpan(tftSpan *batch, uint32_t &count, int32_t x, int32_t y, int32_t w, uint32_t color);
+
+           // Draws a pixel of color over bg with coverage alpha (0-255), bg 0x00FFFFFF reads it
+  void     blendPixel(int32_t x, int32_t y, uint8_t alpha, uint32_t color, uint32_t bg);
+
+           // Ellipse outline as spans, the pixels of the midpoint algorithm
+  void     drawEllipseSpans(int32_t x0, int32_t y0, int32_t rx, int32_t ry, uint32_t color);
+
+#ifdef LOAD_GFXFF
+           // Glyph of free font character c, nullptr if the font does not have it
+  GFXglyph *gfxGlyph(uint16_t c);
+
+           // Opaque free font text: each glyph cell is sent through one window with its
+           // background, instead of filling the text box and drawing the glyphs over it
+  int16_t  drawStringCells(const char *string, int32_t poX, int32_t poY, int32_t left, int32_t right);
+
+           // True if no glyph's ink reaches past the cells next to its own, which is all a
+           // cell draws of its neighbours, or out of the text box. Otherwise the box is filled
+           // and the glyphs drawn over it. The Sprite class always does that, its RAM does not
+           // flicker, so it returns false
+  virtual bool cellsHoldInk(const char *string, int32_t poX, int32_t left, int32_t right);
+
+           // One cell of drawStringCells(), returns false if it must be filled and drawn over
+           // instead
+  virtual bool drawCharCell(int32_t x, int32_t y, uint16_t prev, uint16_t c, uint16_t next,
+                            int32_t cl, int32_t cr, uint32_t color, uint32_t bg);
+#endif
+
+           // Span font set for font number 2 to 8, nullptr if the built in font is used
+  static const tftSpanFont *spanFont(uint8_t font) { return (font > 1 && font < 9) ? spanFonts[font - 2] : nullptr; }
+  static const tftSpanFont *spanFonts[7];
+  static uint8_t  spanDigits[7]; // Advance of the digits of each span font, 0 if not all ten
+  static uint16_t spanMissing;
+
+           // Glyph of span font character c, nullptr if the font does not have it
+  const tftSpanGlyph *spanGlyph(const tftSpanFont *sf, uint16_t c);
+
+           // Character c of a span font, the runs are drawn as lines and rectangles
+  int16_t  drawSpanChar(uint16_t c, int32_t x, int32_t y, const tftSpanFont *sf);
+
+           // n opaque size 1 span glyphs side by side inside the viewport, sent as one window of
+           // whole rows. Returns false if they must be filled and drawn over instead, as the Sprite class does
+  virtual bool pushSpanGlyphs(int32_t x, int32_t y, const tftSpanFont *sf, const tftSpanGlyph * const *g, uint8_t n);
+
+           // Glyph of an anti-aliased span font, runs of one alpha level are drawn as lines
+  void     drawAlphaGlyph(int32_t x, int32_t y, const tftSpanFont *sf, const tftSpanGlyph *g);
+
+           // Opaque size 1 alpha glyph inside the viewport, sent as one window through the blend
+           // table. Returns false if it must be filled and drawn over instead, as for span glyphs
+  virtual bool pushAlphaGlyph(int32_t x, int32_t y, const tftSpanFont *sf, const tftSpanGlyph *g);
+
+           // Colours of the 16 alpha levels from bg to fg, made again when the colours change
+  const uint16_t *alphaLut(uint16_t fg, uint16_t bg);
+  uint16_t aaLut[16], aaLutFg, aaLutBg;
+  bool     aaLutValid;
+
+           // Draw a decoded character at the cursor and move the cursor on, for write()
+  void     printChar(uint16_t uniCode);
+
+           // Draw n span font characters write() has laid out on the cursor line from x
+  void     printRun(int32_t x, const tftSpanFont *sf, const tftSpanGlyph * const *g, const uint16_t *c, uint8_t n);
+
            // Byte read prototype
   uint8_t  readByte(void);
 
@@ -755,11 +989,11 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
  //-------------------------------------- protected ----------------------------------//
  protected:
 
-  //int32_t  win_xe, win_ye;          // Window end coords - not needed
+  int32_t  win_xs, win_xe, win_ys, win_ye; // Address window last sent - used to skip unchanged CASET/PASET and by drawPixel()
+  int32_t  win_row, win_row_xs, win_row_xe; // Next row and columns of an open setRowWindow() run, win_row -1 if none
 
   int32_t  _init_width, _init_height; // Display w/h as input, used by setRotation()
   int32_t  _width, _height;           // Display w/h as modified by current rotation
-  int32_t  addr_row, addr_col;        // Window position - used to minimise window commands
 
   int16_t  _xPivot;   // TFT x pivot point coordinate for rotated Sprites
   int16_t  _yPivot;   // TFT x pivot point coordinate for rotated Sprites
@@ -774,6 +1008,7 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   bool     _vpOoB;
 
   int32_t  cursor_x, cursor_y, padX;       // Text cursor x,y and padding setting
+  tftRect  textBox;                        // Box of the glyph cells of the last drawString()
 
   uint32_t fontsloaded;               // Bit field of fonts loaded
 
@@ -822,4 +1057,13 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 // Load the Sprite Class
 #include "Extensions/Sprite.h"
 
+// Load the Display List Class
+#include "Extensions/DisplayList.h"
+
+// Load the Arc Meter Class
+#include "Extensions/ArcMeter.h"
+
+// Load the Digit Atlas Class
+#include "Extensions/DigitAtlas.h"
+
 #endif // ends #ifndef _TFT_eSPIH_
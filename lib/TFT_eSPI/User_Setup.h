@@ -348,3 +348,9 @@
 // so changing it here has no effect
 
 // #define SUPPORT_TRANSACTIONS
+
+// The library remembers the last address window sent to the TFT and skips the
+// column/row address commands that would not change it. Uncomment to send the
+// full window every time, e.g. to compare timings with the Window_Benchmark sketch
+// or if another driver instance also writes to the same display
+// #define TFT_NO_WINDOW_CACHE
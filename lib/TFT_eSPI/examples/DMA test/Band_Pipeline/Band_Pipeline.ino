@@ -0,0 +1,70 @@
+// This sketch is for STM32 processors with little RAM, e.g. the
+// STM32F103 "Blue Pill" with 20 Kbytes, and an SPI TFT.
+// The whole screen is redrawn every frame without a full screen
+// buffer: a Sprite with 2 frames holds 2 bands of 8 rows and
+// pushBands() renders one band while DMA sends the other.
+// Compare the two times printed, the first is rendering and
+// sending one after the other, the second overlaps them.
+
+// With DMA the frame time gets close to the larger of the
+// rendering time and the bus time for the screen.
+
+#include <TFT_eSPI.h>
+
+#define BAND_LINES 8
+
+TFT_eSPI    tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+uint16_t* bandPtr[2];
+uint16_t  frame = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.initDMA();
+  tft.fillScreen(TFT_BLACK);
+
+  // 2 frames of the band size, drawn through the Sprite functions
+  bandPtr[0] = (uint16_t*)spr.createSprite(tft.width(), BAND_LINES, 2);
+  bandPtr[1] = (uint16_t*)spr.frameBuffer(2);
+  spr.frameBuffer(1);
+}
+
+void loop() {
+  // Render and send in turn, as pushSprite() does
+  uint32_t t = micros();
+  for (int32_t row = 0; row < tft.height(); row += BAND_LINES) {
+    renderBand(bandPtr[0], row, BAND_LINES);
+    spr.pushSprite(0, row);
+  }
+  t = micros() - t;
+
+  // Render while DMA sends
+  uint32_t tb = micros();
+  tft.pushBands(0, 0, tft.width(), tft.height(), BAND_LINES, bandPtr[0], bandPtr[1], renderBand);
+  tb = micros() - tb;
+
+  Serial.print("Sprite bands "); Serial.print(t);
+  Serial.print(" us, pushBands "); Serial.print(tb); Serial.println(" us");
+
+  frame++;
+}
+
+// Called by pushBands() for rows row to row + lines - 1 of the screen
+void renderBand(uint16_t* band, int32_t row, int32_t lines) {
+  spr.frameBuffer(band == bandPtr[0] ? 1 : 2);
+
+  // Move the Sprite datum up so screen coordinates can be used
+  spr.setViewport(0, -row, tft.width(), row + lines);
+
+  spr.fillSprite(TFT_NAVY);
+  for (int32_t y = 0; y < tft.height(); y += 20) spr.drawFastHLine(0, y, tft.width(), TFT_DARKGREY);
+  spr.fillCircle(tft.width() / 2, tft.height() / 2, tft.height() / 3, TFT_RED);
+  spr.drawLine(0, frame % tft.height(), tft.width() - 1, tft.height() - 1 - frame % tft.height(), TFT_YELLOW);
+  spr.setTextColor(TFT_WHITE);
+  spr.drawNumber(frame, 10, 10, 4);
+
+  spr.resetViewport();
+}
@@ -0,0 +1,73 @@
+// This sketch is for STM32F1 processors and an SPI TFT.
+// Fills and images are queued with queueFill() and queueImage()
+// and sent by DMA while loop() carries on. The DMA end interrupt
+// sets the window for each command and starts the next one.
+// A fence tells when an image buffer may be changed again.
+
+// The time printed is how long loop() was held up by the TFT,
+// the rest of each frame was free for other work.
+
+#include <TFT_eSPI.h>
+
+#define BARS  8
+#define BAR_W 24
+
+TFT_eSPI tft = TFT_eSPI();
+
+// Bar tops are drawn from a small image, two copies so one can be
+// changed while DMA still reads the other
+uint16_t  cap[2][BAR_W * 8];
+uint8_t   capSel = 0;
+uint32_t  capFence[2] = { 0, 0 };
+
+uint16_t  level[BARS];
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.initDMA();
+  tft.fillScreen(TFT_BLACK);
+}
+
+void loop() {
+  uint32_t held = micros();
+
+  // Do not overwrite a cap image the DMA may still be sending
+  tft.fenceWait(capFence[capSel]);
+  makeCap(cap[capSel], millis() >> 4);
+
+  tft.startWrite();
+  held = micros() - held;
+
+  int32_t barH = tft.height() - 8;
+  for (int i = 0; i < BARS; i++) {
+    int32_t x = 8 + i * (BAR_W + 8);
+    level[i] = (level[i] * 3 + random(barH)) / 4;
+    tft.queueFill(x, 0, BAR_W, barH - level[i], TFT_BLACK);
+    tft.queueImage(x, barH - level[i], BAR_W, 8, cap[capSel]);
+    tft.queueFill(x, barH - level[i] + 8, BAR_W, level[i], TFT_DARKGREEN);
+  }
+  capFence[capSel] = tft.queueFence();
+  capSel ^= 1;
+
+  // The queue is being sent now, other work can be done here
+  uint32_t work = micros();
+  while (!tft.fencePassed(capFence[capSel ^ 1])) ; // e.g. read sensors instead
+  work = micros() - work;
+
+  tft.endWrite();
+
+  Serial.print("TFT held loop() for "); Serial.print(held);
+  Serial.print(" us, DMA ran alone for "); Serial.print(work); Serial.println(" us");
+  delay(20);
+}
+
+// A shaded cap in TFT byte order, as queueImage() sends RAM as it is
+void makeCap(uint16_t* img, uint8_t phase) {
+  for (int y = 0; y < 8; y++) {
+    uint16_t c = tft.color565(255, 128 + ((y * 16 + phase) & 127), 0);
+    c = c >> 8 | c << 8;
+    for (int x = 0; x < BAR_W; x++) img[y * BAR_W + x] = c;
+  }
+}
@@ -0,0 +1,48 @@
+// Ring meters drawn with TFT_eArcMeter.
+
+// The first draw() draws the whole ring. After that only the
+// section between the old and the new value is drawn, so a small
+// change of value costs a few pixels instead of the whole ring.
+// The time each update took is printed to the Serial monitor.
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI      tft = TFT_eSPI();
+TFT_eArcMeter speed(&tft);
+TFT_eArcMeter temp(&tft);
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  // 0 to 180 km/h over 240 degrees, from 8 o'clock to 4 o'clock
+  speed.setArc(110, 120, 100, 80, 240, 240);
+  speed.setRange(0, 180);
+  speed.setColors(TFT_GREEN, TFT_DARKGREY, TFT_BLACK);
+
+  // -20 to 60 C on a half ring
+  temp.setArc(270, 120, 45, 38, 270, 180);
+  temp.setRange(-20, 60);
+  temp.setColors(TFT_ORANGE, TFT_DARKGREY, TFT_BLACK);
+}
+
+void loop() {
+  static int32_t kmh = 0, step = 1;
+
+  uint32_t t = micros();
+  speed.draw(kmh);
+  temp.draw(kmh / 3 - 20);
+  t = micros() - t;
+
+  Serial.print(kmh);
+  Serial.print(F(" km/h drawn in "));
+  Serial.print(t);
+  Serial.println(F(" us"));
+
+  kmh += step;
+  if (kmh == 0 || kmh == 180) step = -step;
+  delay(20);
+}
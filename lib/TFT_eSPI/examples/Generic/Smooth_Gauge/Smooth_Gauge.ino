@@ -0,0 +1,56 @@
+// Draws a speedometer face with anti-aliased arcs and lines.
+
+// The face is drawn straight to the TFT, blending the edges with
+// the known background colour. The needle is drawn in a Sprite,
+// where the edges blend with what is already in the Sprite, so
+// nothing needs to be read back from the TFT.
+
+#include <TFT_eSPI.h>
+
+#define FACE_BG  TFT_BLACK
+#define RADIUS   100
+#define NEEDLE_W 120 // Sprite the needle moves in, centred on the gauge
+
+TFT_eSPI    tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+int32_t cx, cy;
+
+void setup() {
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(FACE_BG);
+
+  cx = tft.width() / 2;
+  cy = tft.height() / 2 + 10;
+
+  // Scale from 0 to 180 km/h over 240 degrees, red from 150
+  tft.drawSmoothArc(cx, cy, RADIUS, RADIUS - 6, 240, 120, TFT_DARKGREY, FACE_BG);
+  tft.drawSmoothArc(cx, cy, RADIUS, RADIUS - 6, 80, 120, TFT_RED, FACE_BG);
+
+  for (int v = 0; v <= 180; v += 20) {
+    float a = (240 + v * 4 / 3) * DEG_TO_RAD;
+    tft.drawWideLine(cx + sin(a) * (RADIUS - 10), cy - cos(a) * (RADIUS - 10),
+                     cx + sin(a) * (RADIUS - 22), cy - cos(a) * (RADIUS - 22), 3, TFT_WHITE, FACE_BG);
+  }
+
+  spr.createSprite(NEEDLE_W, NEEDLE_W);
+}
+
+void loop() {
+  static int32_t kmh = 0, step = 1;
+
+  spr.fillSprite(FACE_BG);
+
+  float a = (240 + kmh * 4 / 3.0) * DEG_TO_RAD;
+  int32_t c = NEEDLE_W / 2;
+  spr.drawWideLine(c, c, c + sin(a) * (c - 4), c - cos(a) * (c - 4), 5, TFT_ORANGE);
+  spr.drawSmoothArc(c, c, 8, 0, 0, 360, TFT_LIGHTGREY);
+  spr.drawSmoothLine(c - 4, c, c + 4, c, TFT_BLACK);
+
+  spr.pushSprite(cx - c, cy - c);
+
+  kmh += step;
+  if (kmh == 0 || kmh == 180) step = -step;
+  delay(20);
+}
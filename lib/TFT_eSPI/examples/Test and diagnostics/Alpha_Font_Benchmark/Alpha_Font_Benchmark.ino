@@ -0,0 +1,77 @@
+/*
+ Times drawString() in the FreeSans12pt7b free font and in FreeSans12ptAA,
+ FreeSans24pt7b shrunk to half size by tools/font_compiler --aa 2.
+
+ Each pixel of the anti-aliased font is the share of its 2 x 2 source pixels
+ that are set, stored as 4 bit alpha. A table of the 16 colours between the
+ text and background colour is made when the colours change, so an opaque
+ glyph is sent through one window with one look up per pixel, as fast as
+ bitmap text. No font file is parsed and nothing is blended while drawing.
+
+ LOAD_GFXFF must be defined in the setup file for the free font figures.
+ Results are printed to the Serial monitor in microseconds.
+
+ #########################################################################
+ ###### DON'T FORGET TO UPDATE THE User_Setup.h FILE IN THE LIBRARY ######
+ #########################################################################
+*/
+
+#include <TFT_eSPI.h>
+#include <SPI.h>
+#include <Fonts/Spans/FreeSans12ptAA.h>
+
+TFT_eSPI tft = TFT_eSPI();
+
+#define AA_FONT 3 // Font number 3 is free
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+  tft.setSpanFont(AA_FONT, &FreeSans12ptAA);
+
+  Serial.println();
+  Serial.println(F("Benchmark                Free font  Anti-aliased (microseconds)"));
+}
+
+void loop() {
+  compare(F("Opaque                   "), "Avg speed 23.4 km/h", true);
+  compare(F("Transparent              "), "Avg speed 23.4 km/h", false);
+  Serial.println();
+
+  // Both fonts side by side
+  tft.fillScreen(TFT_NAVY);
+  tft.setTextColor(TFT_WHITE, TFT_NAVY);
+  tft.setFreeFont(&FreeSans12pt7b);
+  tft.drawString("Free font 0123", 10, 40);
+  tft.drawString("Anti-aliased 0123", 10, 80, AA_FONT);
+
+  delay(5000);
+}
+
+void compare(const __FlashStringHelper *name, const char *text, bool opaque) {
+  tft.setFreeFont(&FreeSans12pt7b);
+  uint32_t freeFont = testText(text, 1, opaque); // Font 1 is the free font once one is set
+
+  tft.setFreeFont(NULL);
+  uint32_t alpha = testText(text, AA_FONT, opaque);
+
+  Serial.print(name);
+  Serial.print(freeFont);
+  Serial.print(F("       "));
+  Serial.println(alpha);
+}
+
+// Text drawn down the screen, one line per font height
+uint32_t testText(const char *text, uint8_t font, bool opaque) {
+  tft.fillScreen(TFT_BLACK);
+  if (opaque) tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+  else tft.setTextColor(TFT_YELLOW);
+  uint32_t start = micros();
+  for (int y = 0; y <= tft.height() - tft.fontHeight(font); y += tft.fontHeight(font)) {
+    tft.drawString(text, 0, y, font);
+  }
+  return micros() - start;
+}
@@ -0,0 +1,92 @@
+/*
+ Times one Font 8 digit drawn from the built in run length encoded glyphs, from
+ the same glyphs span encoded by tools/font_compiler and from a TFT_eDigitAtlas,
+ the digits rasterised into RAM as runs of set pixels when the sketch starts.
+
+ The atlas needs no decoding at all, an opaque digit is built row by row from
+ its runs and sent through one window. Opaque digits this big
+ are mostly pixel data, so on a slow bus the three are close, the difference is
+ the CPU time freed for other work. The RAM the atlas takes is printed too.
+
+ The built in figures are 0 unless Font 8 is loaded in the setup file.
+ Results are printed to the Serial monitor in microseconds per digit.
+
+ #########################################################################
+ ###### DON'T FORGET TO UPDATE THE User_Setup.h FILE IN THE LIBRARY ######
+ #########################################################################
+*/
+
+#include <TFT_eSPI.h>
+#include <SPI.h>
+#include <Fonts/Spans/Font8spans.h>
+
+TFT_eSPI tft = TFT_eSPI();
+TFT_eDigitAtlas atlas = TFT_eDigitAtlas(&tft);
+
+#define DIGITS 40
+
+bool builtInLoaded;
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  builtInLoaded = tft.fontsLoaded() & (1 << 8);
+
+  // The atlas is rasterised from the span glyphs, they draw the same pixels
+  tft.setSpanFont(8, &Font8spans);
+  atlas.createAtlas(8, 1, "0123456789.:");
+
+  Serial.println();
+  Serial.print(F("Atlas RAM "));
+  Serial.print(atlas.atlasBytes());
+  Serial.println(F(" bytes"));
+  Serial.println(F("Benchmark                Built in   Spans   Atlas (microseconds per digit)"));
+}
+
+void loop() {
+  compare(F("Font 8 opaque            "), true);
+  compare(F("Font 8 transparent       "), false);
+  Serial.println();
+
+  delay(5000);
+}
+
+void compare(const __FlashStringHelper *name, bool opaque) {
+  uint32_t builtIn = 0;
+  if (builtInLoaded) {
+    tft.setSpanFont(8, NULL);
+    builtIn = testDigits(opaque, false);
+  }
+
+  tft.setSpanFont(8, &Font8spans);
+  uint32_t spans = testDigits(opaque, false);
+
+  uint32_t blits = testDigits(opaque, true);
+
+  Serial.print(name);
+  Serial.print(builtIn);
+  Serial.print(F("       "));
+  Serial.print(spans);
+  Serial.print(F("     "));
+  Serial.println(blits);
+}
+
+// Digits drawn one at a time across the screen, as a speed readout does
+uint32_t testDigits(bool opaque, bool fromAtlas) {
+  tft.fillScreen(TFT_BLACK);
+  if (opaque) tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+  else tft.setTextColor(TFT_YELLOW);
+  int16_t w = tft.textWidth("0", 8);
+  uint32_t start = micros();
+  for (int i = 0; i < DIGITS; i++) {
+    char c = '0' + i % 10;
+    int32_t x = (i % (tft.width() / w)) * w;
+    if (fromAtlas) atlas.drawChar(c, x, 40);
+    else tft.drawChar(c, x, 40, 8);
+  }
+  return (micros() - start) / DIGITS;
+}
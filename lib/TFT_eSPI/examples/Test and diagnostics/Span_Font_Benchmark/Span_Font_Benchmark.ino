@@ -0,0 +1,75 @@
+/*
+ Times drawString() in fonts 4 and 8 with the built in run length encoded
+ glyphs and with the same glyphs span encoded by tools/font_compiler.
+
+ A span font stores each glyph row as (skip, run) pairs. Transparent text is
+ drawn one line per run instead of one window per pixel, and opaque text is
+ built a few rows at a time in a buffer and sent in one transfer instead of
+ one per run. Opaque text in a big font is mostly pixel data, so the bus
+ clock sets a floor that no encoding gets under.
+
+ Fonts 4 and 8 must be loaded in the setup file for the built in figures,
+ "-" is printed for a font that is not. Results are printed to the Serial
+ monitor in microseconds.
+
+ #########################################################################
+ ###### DON'T FORGET TO UPDATE THE User_Setup.h FILE IN THE LIBRARY ######
+ #########################################################################
+*/
+
+#include <TFT_eSPI.h>
+#include <SPI.h>
+#include <Fonts/Spans/Font4spans.h>
+#include <Fonts/Spans/Font8spans.h>
+
+TFT_eSPI tft = TFT_eSPI();
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  Serial.println();
+  Serial.println(F("Benchmark                Built in   Spans (microseconds)"));
+}
+
+void loop() {
+  compare(F("Font 4 opaque            "), 4, "Avg speed 23.4", true);
+  compare(F("Font 4 transparent       "), 4, "Avg speed 23.4", false);
+  compare(F("Font 8 opaque            "), 8, "123", true);
+  compare(F("Font 8 transparent       "), 8, "123", false);
+  Serial.println();
+
+  delay(5000);
+}
+
+void compare(const __FlashStringHelper *name, uint8_t font, const char *text, bool opaque) {
+  tft.setSpanFont(4, NULL);
+  tft.setSpanFont(8, NULL);
+  bool loaded = tft.fontsLoaded() & (1 << font);
+  uint32_t builtIn = loaded ? testText(font, text, opaque) : 0;
+
+  tft.setSpanFont(4, &Font4spans);
+  tft.setSpanFont(8, &Font8spans);
+  uint32_t spans = testText(font, text, opaque);
+
+  Serial.print(name);
+  if (loaded) Serial.print(builtIn);
+  else Serial.print(F("-"));
+  Serial.print(F("       "));
+  Serial.println(spans);
+}
+
+// Text drawn down the screen, one line per font height
+uint32_t testText(uint8_t font, const char *text, bool opaque) {
+  tft.fillScreen(TFT_BLACK);
+  if (opaque) tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+  else tft.setTextColor(TFT_YELLOW);
+  uint32_t start = micros();
+  for (int y = 0; y <= tft.height() - tft.fontHeight(font); y += tft.fontHeight(font)) {
+    tft.drawString(text, 0, y, font);
+  }
+  return micros() - start;
+}
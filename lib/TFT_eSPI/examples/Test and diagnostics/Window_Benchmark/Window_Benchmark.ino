@@ -0,0 +1,170 @@
+/*
+ Times workloads that are dominated by address window commands rather than
+ pixel data: single pixels, free font text and shapes made of short lines.
+
+ The library skips CASET/PASET commands when the window has not changed and
+ continues the RAM write for lines drawn directly below each other. To see
+ what that saves, run this sketch, then uncomment #define TFT_NO_WINDOW_CACHE
+ in your setup file, run it again and compare the figures.
+
+ The batched drawPixels() and drawSpans() sort their input into rows first,
+ compare "Batched pixels" with "Scattered pixels". fillPolygon() draws a shape as
+ merged row spans, compare "Polygons" with "Polygon triangles", the same stars
+ drawn as fillTriangle() calls.
+
+ Results are printed to the Serial monitor in microseconds.
+
+ #########################################################################
+ ###### DON'T FORGET TO UPDATE THE User_Setup.h FILE IN THE LIBRARY ######
+ #########################################################################
+*/
+
+#include <TFT_eSPI.h>
+#include <SPI.h>
+#include "Free_Fonts.h" // Include the header file attached to this sketch
+
+TFT_eSPI tft = TFT_eSPI();
+
+tftPoint points[500];
+
+void setup() {
+  Serial.begin(115200);
+
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  Serial.println();
+  Serial.println(F("Benchmark                Time (microseconds)"));
+}
+
+void loop() {
+  report(F("Scattered pixels         "), testScatteredPixels());
+  report(F("Batched pixels           "), testBatchedPixels());
+  report(F("Pixel rows               "), testPixelRows());
+  report(F("Pixel columns            "), testPixelColumns());
+  report(F("Free font 24pt text      "), testFreeFont(FSSB24));
+  report(F("Free font 9pt text       "), testFreeFont(FSS9));
+  report(F("Filled circles           "), testFilledCircles());
+  report(F("Ellipses                 "), testEllipses());
+  report(F("Stacked lines            "), testStackedLines());
+  report(F("Polygons                 "), testPolygons(false));
+  report(F("Polygon triangles        "), testPolygons(true));
+  Serial.println();
+
+  delay(5000);
+}
+
+void report(const __FlashStringHelper *name, uint32_t t) {
+  Serial.print(name);
+  Serial.println(t);
+}
+
+uint32_t testScatteredPixels() {
+  tft.fillScreen(TFT_BLACK);
+  randomSeed(1);
+  uint32_t start = micros();
+  for (int i = 0; i < 5000; i++) {
+    tft.drawPixel(random(tft.width()), random(tft.height()), TFT_WHITE);
+  }
+  return micros() - start;
+}
+
+// The same pixels as testScatteredPixels(), 500 at a time
+uint32_t testBatchedPixels() {
+  tft.fillScreen(TFT_BLACK);
+  randomSeed(1);
+  uint32_t start = micros();
+  for (int k = 0; k < 10; k++) {
+    for (int i = 0; i < 500; i++) {
+      points[i].x = random(tft.width());
+      points[i].y = random(tft.height());
+    }
+    tft.drawPixels(points, 500, TFT_WHITE);
+  }
+  return micros() - start;
+}
+
+// Every pixel after the first one in a row changes only x
+uint32_t testPixelRows() {
+  tft.fillScreen(TFT_BLACK);
+  uint32_t start = micros();
+  for (int y = 0; y < tft.height(); y += 8) {
+    for (int x = 0; x < tft.width(); x += 2) tft.drawPixel(x, y, TFT_GREEN);
+  }
+  return micros() - start;
+}
+
+// Every pixel after the first one in a column changes only y
+uint32_t testPixelColumns() {
+  tft.fillScreen(TFT_BLACK);
+  uint32_t start = micros();
+  for (int x = 0; x < tft.width(); x += 8) {
+    for (int y = 0; y < tft.height(); y += 2) tft.drawPixel(x, y, TFT_CYAN);
+  }
+  return micros() - start;
+}
+
+// Free font glyphs are drawn as one short line per run of set pixels
+uint32_t testFreeFont(const GFXfont *font) {
+  tft.fillScreen(TFT_BLACK);
+  tft.setFreeFont(font);
+  tft.setTextColor(TFT_YELLOW);
+  uint32_t start = micros();
+  for (int y = 0; y < tft.height() - tft.fontHeight(); y += tft.fontHeight()) {
+    tft.drawString("0123456789 km/h", 0, y);
+  }
+  return micros() - start;
+}
+
+uint32_t testFilledCircles() {
+  tft.fillScreen(TFT_BLACK);
+  uint32_t start = micros();
+  for (int x = 20; x < tft.width(); x += 40) {
+    for (int y = 20; y < tft.height(); y += 40) tft.fillCircle(x, y, 18, TFT_RED);
+  }
+  return micros() - start;
+}
+
+uint32_t testEllipses() {
+  tft.fillScreen(TFT_BLACK);
+  uint32_t start = micros();
+  for (int r = 10; r < tft.height() / 2; r += 10) {
+    tft.drawEllipse(tft.width() / 2, tft.height() / 2, r + r / 2, r, TFT_MAGENTA);
+  }
+  return micros() - start;
+}
+
+// Lines of equal length directly below each other, e.g. bar graphs or glyph stems
+uint32_t testStackedLines() {
+  tft.fillScreen(TFT_BLACK);
+  uint32_t start = micros();
+  tft.startWrite();
+  for (int x = 0; x < tft.width(); x += 16) {
+    for (int y = 0; y < tft.height(); y++) tft.drawFastHLine(x, y, 12, TFT_BLUE);
+  }
+  tft.endWrite();
+  return micros() - start;
+}
+
+// Five pointed stars, concave, as one polygon or as eight triangles
+uint32_t testPolygons(bool triangles) {
+  static const int8_t star[10][2] = { {0, -40}, {10, -13}, {38, -12}, {16, 5}, {24, 32},
+                                      {0, 16}, {-24, 32}, {-16, 5}, {-38, -12}, {-10, -13} };
+  static const uint8_t tri[8][3] = { {0, 1, 9}, {1, 2, 3}, {3, 4, 5}, {5, 6, 7},
+                                     {7, 8, 9}, {1, 3, 5}, {1, 5, 7}, {1, 7, 9} };
+  tftPoint p[10];
+  tft.fillScreen(TFT_BLACK);
+  uint32_t start = micros();
+  for (int x = 40; x < tft.width(); x += 80) {
+    for (int y = 40; y < tft.height(); y += 80) {
+      for (int i = 0; i < 10; i++) { p[i].x = x + star[i][0]; p[i].y = y + star[i][1]; }
+      if (!triangles) tft.fillPolygon(p, 10, TFT_ORANGE);
+      else for (int t = 0; t < 8; t++) {
+        const tftPoint &a = p[tri[t][0]], &b = p[tri[t][1]], &c = p[tri[t][2]];
+        tft.fillTriangle(a.x, a.y, b.x, b.y, c.x, c.y, TFT_ORANGE);
+      }
+    }
+  }
+  return micros() - start;
+}
@@ -0,0 +1,36 @@
+#include "font_check.h"
+
+static void printMissing(uint8_t font, uint16_t c, Print &out)
+{
+  if (font)
+    out.printf("fonts: font %u has no glyph for ", font);
+  else
+    out.print("fonts: no glyph for ");
+  if (c >= 32 && c < 127)
+    out.printf("'%c'\n", c);
+  else
+    out.printf("0x%02X\n", c);
+}
+
+bool fontCheck(TFT_eSPI &tft, uint8_t font, const char *chars, Print &out)
+{
+  bool ok = true;
+  char one[2] = {0, 0};
+  for (; *chars; chars++)
+  {
+    one[0] = *chars;
+    if (tft.missingGlyph(font, one))
+    {
+      printMissing(font, (uint8_t)*chars, out);
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+void fontCheckReport(TFT_eSPI &tft, Print &out)
+{
+  uint16_t c = tft.missingGlyph();
+  if (c)
+    printMissing(0, c, out);
+}
@@ -0,0 +1,116 @@
+#include "latency_probe.h"
+
+static volatile uint32_t pulseUs = 0;
+static volatile uint16_t pulseSeq = 0;
+
+static uint16_t drawnSeq = 0;
+static uint32_t samplePulseUs = 0;
+static uint32_t sampleStartUs = 0;
+static bool sampling = false;
+
+static uint32_t totalUs[LATENCY_SAMPLES];
+static uint32_t drawUs[LATENCY_SAMPLES];
+static uint16_t head = 0;
+static uint16_t count = 0;
+static uint32_t samples = 0;
+
+void latencyPulse()
+{
+  pulseUs = micros();
+  pulseSeq++;
+}
+
+void latencyWidgetBegin()
+{
+  noInterrupts();
+  uint16_t seq = pulseSeq;
+  uint32_t at = pulseUs;
+  interrupts();
+
+  sampling = seq != drawnSeq;
+  if (!sampling)
+    return;
+  drawnSeq = seq;
+  samplePulseUs = at;
+  sampleStartUs = micros();
+}
+
+void latencyPixelsDone()
+{
+  if (!sampling)
+    return;
+  sampling = false;
+
+  uint32_t now = micros();
+  totalUs[head] = now - samplePulseUs;
+  drawUs[head] = now - sampleStartUs;
+  head = (head + 1) % LATENCY_SAMPLES;
+  if (count < LATENCY_SAMPLES)
+    count++;
+  samples++;
+}
+
+uint32_t latencyLastUs()
+{
+  return count ? totalUs[(head + LATENCY_SAMPLES - 1) % LATENCY_SAMPLES] : 0;
+}
+
+uint16_t latencySeq()
+{
+  return samples;
+}
+
+// Sorts v[0..n) in place, n is at most LATENCY_SAMPLES so insertion sort will do
+static void sortSamples(uint32_t *v, uint16_t n)
+{
+  for (uint16_t i = 1; i < n; i++)
+  {
+    uint32_t x = v[i];
+    uint16_t j = i;
+    while (j && v[j - 1] > x)
+    {
+      v[j] = v[j - 1];
+      j--;
+    }
+    v[j] = x;
+  }
+}
+
+// Prints microseconds as milliseconds with one decimal
+static void printMs(Print &out, const char *label, uint32_t us)
+{
+  out.printf(" %s %lu.%lu", label, (unsigned long)(us / 1000), (unsigned long)(us / 100 % 10));
+}
+
+static void printStage(Print &out, const char *name, uint32_t *v, uint16_t n)
+{
+  sortSamples(v, n);
+  out.printf(" %s", name);
+  printMs(out, "p50", v[n * 50 / 100]);
+  printMs(out, "p90", v[n * 90 / 100]);
+  printMs(out, "p99", v[n * 99 / 100]);
+  printMs(out, "max", v[n - 1]);
+}
+
+void latencyReport(Print &out)
+{
+  if (!count)
+  {
+    out.println("latency: no pulses yet");
+    return;
+  }
+
+  uint32_t v[LATENCY_SAMPLES];
+  out.printf("latency: %lu samples, last %u,", (unsigned long)samples, count);
+
+  for (uint16_t i = 0; i < count; i++)
+    v[i] = totalUs[i] - drawUs[i];
+  printStage(out, "queue", v, count);
+
+  memcpy(v, drawUs, count * sizeof(v[0]));
+  printStage(out, "| draw", v, count);
+
+  memcpy(v, totalUs, count * sizeof(v[0]));
+  printStage(out, "| total", v, count);
+  out.println(" ms");
+}
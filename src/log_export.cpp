@@ -0,0 +1,43 @@
+#include <Arduino.h>
+#include "log_export.h"
+
+static LogExportSession *session = nullptr;
+
+void logExportBegin(const LogSource &source)
+{
+  // Later calls switch the session over to the new source
+  static LogExportSession instance(source);
+  instance.setSource(source);
+  session = &instance;
+}
+
+bool logExportPoll()
+{
+  if (!session)
+    return false;
+
+  int budget = LOG_EXPORT_POLL_BYTES;
+  bool moved = false;
+  while (budget-- > 0 && Serial.available() > 0)
+  {
+    session->receive(Serial.read());
+    moved = true;
+  }
+
+  int room = Serial.availableForWrite();
+  if (room <= 0)
+    return moved;
+  if (room > LOG_EXPORT_POLL_BYTES)
+    room = LOG_EXPORT_POLL_BYTES;
+
+  uint8_t buf[LOG_EXPORT_POLL_BYTES];
+  size_t n = session->transmit(buf, room);
+  if (n)
+    Serial.write(buf, n);
+  return moved || n;
+}
+
+bool logExportActive()
+{
+  return session && session->active();
+}
@@ -0,0 +1,267 @@
+#include "log_protocol.h"
+
+// Nibble table keeps the CRC at 64 bytes of flash instead of 1 KB
+static const uint32_t crcTable[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+uint32_t logCrc32(const uint8_t *data, size_t len, uint32_t crc)
+{
+  crc = ~crc;
+  while (len--)
+  {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ crcTable[crc & 0x0F];
+    crc = (crc >> 4) ^ crcTable[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+size_t cobsEncode(const uint8_t *in, size_t len, uint8_t *out)
+{
+  size_t codePos = 0;
+  size_t pos = 1;
+  uint8_t code = 1;
+
+  for (size_t i = 0; i < len; i++)
+  {
+    if (in[i] == 0)
+    {
+      out[codePos] = code;
+      codePos = pos++;
+      code = 1;
+      continue;
+    }
+    out[pos++] = in[i];
+    if (++code == 0xFF)
+    {
+      out[codePos] = code;
+      codePos = pos++;
+      code = 1;
+    }
+  }
+  out[codePos] = code;
+  out[pos++] = 0;
+  return pos;
+}
+
+size_t cobsDecode(const uint8_t *in, size_t len, uint8_t *out)
+{
+  size_t pos = 0;
+  size_t outLen = 0;
+
+  while (pos < len)
+  {
+    uint8_t code = in[pos++];
+    if (code == 0 || pos + code - 1 > len)
+      return 0;
+    for (uint8_t i = 1; i < code; i++)
+      out[outLen++] = in[pos++];
+    if (code != 0xFF && pos < len)
+      out[outLen++] = 0;
+  }
+  return outLen;
+}
+
+size_t logBuildFrame(uint8_t type, const uint8_t *payload, size_t len, uint8_t *wire)
+{
+  uint8_t raw[LOG_FRAME_MAX];
+
+  raw[0] = type;
+  for (size_t i = 0; i < len; i++)
+    raw[1 + i] = payload[i];
+  logPut32(raw + 1 + len, logCrc32(raw, 1 + len));
+  return cobsEncode(raw, len + 5, wire);
+}
+
+int logCheckFrame(const uint8_t *frame, size_t len)
+{
+  if (len < 5)
+    return -1;
+  if (logCrc32(frame, len - 4) != logGet32(frame + len - 4))
+    return -1;
+  return len - 5;
+}
+
+size_t LogFrameReader::feed(uint8_t b)
+{
+  if (b != 0)
+  {
+    if (len < sizeof(buf))
+      buf[len++] = b;
+    else
+      overflow = true;
+    return 0;
+  }
+
+  // Delimiter: decode in place, dropping anything that overflowed
+  size_t frameLen = overflow ? 0 : cobsDecode(buf, len, buf);
+  len = 0;
+  overflow = false;
+  return frameLen;
+}
+
+// A window end that saturates instead of wrapping past 4 GB
+static uint32_t windowEnd(uint32_t start, uint32_t len)
+{
+  return len > UINT32_MAX - start ? UINT32_MAX : start + len;
+}
+
+void LogExportSession::setSource(const LogSource &source)
+{
+  src = source;
+  streaming = false;
+  endPending = false;
+  restart();
+}
+
+// Cuts a frame still going out for the old stream short. A lone delimiter
+// ends it on the wire, the host drops the fragment on its CRC.
+void LogExportSession::restart()
+{
+  if (txPos == txLen)
+    return;
+  tx[0] = 0;
+  txLen = 1;
+  txPos = 0;
+}
+
+void LogExportSession::receive(uint8_t b)
+{
+  size_t len = reader.feed(b);
+  if (len)
+    handle(reader.frame(), len);
+}
+
+void LogExportSession::handle(const uint8_t *frame, size_t len)
+{
+  // Corrupt requests are dropped, the host retries on timeout
+  int payload = logCheckFrame(frame, len);
+  if (payload < 0)
+    return;
+
+  uint8_t out[7];
+  const uint8_t *p = frame + 1;
+
+  switch (frame[0])
+  {
+  case LOG_CMD_INFO:
+    logPut32(out, src.size());
+    out[4] = LOG_CHUNK_SIZE & 0xFF;
+    out[5] = LOG_CHUNK_SIZE >> 8;
+    out[6] = LOG_PROTOCOL_VERSION;
+    reply(LOG_RSP_INFO, out, 7);
+    break;
+
+  case LOG_CMD_READ:
+    if (payload < 8)
+      return;
+    if (logGet32(p) > src.size())
+    {
+      out[0] = LOG_ERR_RANGE;
+      reply(LOG_RSP_ERROR, out, 1);
+      streaming = false;
+      return;
+    }
+    // A READ restarts the stream, the rest of a frame for the old position
+    // is no longer wanted
+    restart();
+    offset = logGet32(p);
+    limit = windowEnd(offset, logGet32(p + 4));
+    streaming = true;
+    endPending = true;
+    break;
+
+  case LOG_CMD_ACK:
+    if (payload < 8 || !streaming)
+      return;
+    // Windows only ever slide forward, stale ACKs are harmless
+    if (windowEnd(logGet32(p), logGet32(p + 4)) > limit)
+      limit = windowEnd(logGet32(p), logGet32(p + 4));
+    break;
+
+  case LOG_CMD_STOP:
+    streaming = false;
+    endPending = false;
+    break;
+
+  default:
+    out[0] = LOG_ERR_COMMAND;
+    reply(LOG_RSP_ERROR, out, 1);
+    break;
+  }
+}
+
+void LogExportSession::reply(uint8_t type, const uint8_t *payload, uint8_t len)
+{
+  // Only the latest control reply is kept, the host re-asks if it loses one
+  replyType = type;
+  replyLen = len;
+  for (uint8_t i = 0; i < len; i++)
+    replyPayload[i] = payload[i];
+}
+
+bool LogExportSession::nextFrame()
+{
+  if (replyType)
+  {
+    txLen = logBuildFrame(replyType, replyPayload, replyLen, tx);
+    replyType = 0;
+    return true;
+  }
+
+  if (!streaming)
+    return false;
+
+  uint32_t size = src.size();
+  if (offset >= size)
+  {
+    streaming = false;
+    if (!endPending)
+      return false;
+    uint8_t out[4];
+    logPut32(out, size);
+    txLen = logBuildFrame(LOG_RSP_END, out, 4, tx);
+    endPending = false;
+    return true;
+  }
+
+  if (offset >= limit)
+    return false; // window exhausted, wait for the host to ACK
+
+  uint32_t n = size - offset;
+  if (n > LOG_CHUNK_SIZE)
+    n = LOG_CHUNK_SIZE;
+  if (n > limit - offset)
+    n = limit - offset;
+
+  uint8_t payload[4 + LOG_CHUNK_SIZE];
+  logPut32(payload, offset);
+  src.read(offset, payload + 4, n);
+  txLen = logBuildFrame(LOG_RSP_DATA, payload, 4 + n, tx);
+  offset += n;
+  return true;
+}
+
+size_t LogExportSession::transmit(uint8_t *out, size_t room)
+{
+  size_t sent = 0;
+
+  while (sent < room)
+  {
+    if (txPos == txLen)
+    {
+      txPos = txLen = 0;
+      if (!nextFrame())
+        break;
+    }
+    size_t n = txLen - txPos;
+    if (n > room - sent)
+      n = room - sent;
+    for (size_t i = 0; i < n; i++)
+      out[sent + i] = tx[txPos + i];
+    txPos += n;
+    sent += n;
+  }
+  return sent;
+}
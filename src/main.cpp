@@ -6,13 +6,36 @@
 #include <Wire.h>
 #include <SPI.h>
 #include "Free_Fonts.h"
+#include "dash_font4.h" // fonts 4, 6 and 8 trimmed to FONTn_CHARS and the literals below
+#include "dash_font6.h"
+#include "dash_font8.h"
 #include "RTClib.h"
 #include "ms_to_time.h" // library convert ms to normal time
+#include "log_export.h"
+#include "telemetry.h"
+#include "latency_probe.h"
+#include "mem_monitor.h"
+#include "font_check.h"
 
 #define HALL PB3
 #define TRIP_RESET PB4
 #define DISPLAY_CHANGE PB5
 #define SCREEN_UPDATE_TIME 250
+#define SERIAL_BAUD 115200
+#define TELEMETRY_HZ 100 // bench telemetry frame rate, 0 disables it
+#define REPORT_MS 10000 // latency and memory report on Serial, 0 disables it
+#define MEM_POLL_MS 1000 // stack high water scan interval
+#define LIST_CMDS 16      // display list commands per screen, see TFT_eDisplayList
+#define LIST_TEXT 160     // display list string bytes per screen
+#define LIST_TILES 0      // 1 composes the display list in 64x32 tiles (4 KB RAM) instead of drawing changes directly
+#define SPEED_ATLAS 0     // 1 draws the speed from font 8 and 6 digits rasterised at startup (5.3 KB RAM)
+
+// What numbers, times and temperatures print as in each font. Font 4 also keeps the
+// characters of the string literals in this file. tools/font_compiler/subset_fonts.py
+// trims the fonts to these before every build and fontCheck() tests them at startup
+#define FONT4_CHARS "0123456789:,.- "
+#define FONT6_CHARS "0123456789"
+#define FONT8_CHARS "0123456789"
 
 int addressOdo = 0;
 int addressTrip = 5;
@@ -24,6 +47,14 @@ int addressTripStartTime = 25;
 int screenRotation = 1;
 
 TFT_eSPI tft = TFT_eSPI(); // Invoke custom library
+TFT_eDisplayList screenList = TFT_eDisplayList(&tft); // odometer and trip widgets, only changes are drawn
+#if LIST_TILES
+TFT_eSprite screenTile = TFT_eSprite(&tft);
+#endif
+#if SPEED_ATLAS
+TFT_eDigitAtlas speedAtlas = TFT_eDigitAtlas(&tft); // km/h digits in font 8
+TFT_eDigitAtlas meterAtlas = TFT_eDigitAtlas(&tft); // tenths digit in font 6
+#endif
 
 Adafruit_BME280 bme;
 
@@ -41,9 +72,14 @@ unsigned long tripIdleTime = 0;
 unsigned long distanceRstTime;
 unsigned long screenChangeTime;
 unsigned long screenRstTime;
+unsigned long reportTime;
+unsigned long memPollTime;
 int screenSelector = 1;
 int scrensAvailable = 2;
 
+unsigned long loopTimeUs = 0; // time spent on the last screen update
+uint16_t cpuIdle = 10000;     // share of the last loop spent waiting, 0.01 %
+
 bool savedToEeprom = false;
 bool afterStartTemp = true;
 
@@ -63,6 +99,7 @@ void displayTripStart();
 void displayTripDriveTime();
 void displayTripDriveAvgSpeed();
 void displayTripIdleTime();
+int displayLabel(const char *label, const String &value, int y);
 void getDataFromEeprom();
 void writeDataToEeprom();
 // Available screens
@@ -73,17 +110,43 @@ void changeView();
 void screenReset();
 void displayView();
 
+void idle(unsigned long ms);
+uint32_t eepromLogSize();
+void eepromLogRead(uint32_t offset, uint8_t *dst, uint16_t len);
+
+// Until rides are logged the exported "log" is the trip record kept in EEPROM
+const LogSource eepromLog = {eepromLogSize, eepromLogRead};
+
 void setup()
 {
+  memBegin();
 
   start = millis();
+  Serial.begin(SERIAL_BAUD);
+  logExportBegin(eepromLog);
+  telemetryBegin(TELEMETRY_HZ);
+
   //Set up the display
   tft.init();
   tft.setRotation(screenRotation);
+  tft.setSpanFont(4, &dashFont4);
+  tft.setSpanFont(6, &dashFont6);
+  tft.setSpanFont(8, &dashFont8);
+  fontCheck(tft, 4, FONT4_CHARS, Serial);
+  fontCheck(tft, 6, FONT6_CHARS, Serial);
+  fontCheck(tft, 8, FONT8_CHARS, Serial);
+#if SPEED_ATLAS
+  speedAtlas.createAtlas(8, 1, FONT8_CHARS); // falls back to the fonts if out of RAM
+  meterAtlas.createAtlas(6, 1, FONT6_CHARS);
+#endif
   for (int i = 0; i < 2; i++)
   {
     tft.fillScreen(TFT_BLACK);
   }
+  screenList.createList(LIST_CMDS, LIST_TEXT, TFT_BLACK);
+#if LIST_TILES
+  screenTile.createSprite(64, 32);
+#endif
 
   // Set up bme280
   bme.begin(0x76);
@@ -105,6 +168,7 @@ void setup()
 
 void loop()
 {
+  unsigned long workStart = micros();
   displayView();
   changeView();
 
@@ -113,7 +177,60 @@ void loop()
   writeDataToEeprom();
   resetDistance();
   resetSpeed();
-  delay(SCREEN_UPDATE_TIME);
+  loopTimeUs = micros() - workStart;
+  idle(SCREEN_UPDATE_TIME);
+}
+
+// Wait between screen updates while servicing background work. Passes that
+// find nothing to do count as waiting for cpuIdle, the rest as busy.
+void idle(unsigned long ms)
+{
+  unsigned long from = millis();
+  unsigned long fromUs = micros();
+  unsigned long busyUs = 0;
+  while (millis() - from < ms)
+  {
+    unsigned long passUs = micros();
+    bool worked = logExportPoll();
+
+    TelemetrySnapshot snapshot;
+    snapshot.pulseMs = elapsed;
+    snapshot.distanceCm = distance;
+    snapshot.speed = speedk;
+    snapshot.idle = cpuIdle;
+    snapshot.loopUs = loopTimeUs;
+    snapshot.latencyUs = latencyLastUs();
+    snapshot.latencySeq = latencySeq();
+    const MemStats &mem = memStats(); // 20 KB of RAM, the byte counts fit 16 bits
+    snapshot.stackUsed = mem.stackUsed;
+    snapshot.heapUsed = mem.heapUsed;
+    snapshot.heapPeak = mem.heapPeak;
+    snapshot.largestFree = mem.largestFree;
+    snapshot.fragmentation = mem.fragmentation;
+    worked |= telemetryPoll(snapshot);
+
+    if (millis() - memPollTime >= MEM_POLL_MS)
+    {
+      memPoll();
+      memPollTime = millis();
+      worked = true;
+    }
+
+    // Text on Serial would corrupt a running log export
+    if (REPORT_MS && !logExportActive() && millis() - reportTime >= REPORT_MS)
+    {
+      latencyReport(Serial);
+      memReport(Serial);
+      fontCheckReport(tft, Serial);
+      reportTime = millis();
+      worked = true;
+    }
+
+    if (worked)
+      busyUs += micros() - passUs;
+  }
+  unsigned long spentUs = micros() - fromUs;
+  cpuIdle = 10000ULL * (spentUs - busyUs) / (spentUs + loopTimeUs);
 }
 
 void calcSpeed()
@@ -121,6 +238,7 @@ void calcSpeed()
   bool x = digitalRead(HALL);
   if (!x)
   {
+    latencyPulse();
     //calculate elapsed
     elapsed = millis() - start;
     //reset start
@@ -184,37 +302,62 @@ void displayTime()
   tft.printf("%02d:%02d", now.hour(), now.minute());
 }
 
+// km/h right aligned in two font 8 digit cells, the tenths in font 6 after them. The
+// cells are compile time constants, so nothing is measured
 void displaySpeed()
 {
-  int speedPos = 100;
+  constexpr int speedPos = 100;
+  constexpr int digitW = tftDigitWidth(8);
+  constexpr int meterPos = speedPos + 2 * digitW + 4;
   int kmph = speedk / 100;
   kmph = constrain(kmph, 0, 99);
   int meterph = speedk / 10 - (kmph * 10);
   if (kmph >= 99)
     meterph = 9;
-  String space;
+  char text[4];
+  // Box of the km/h digits on the panel, only the part the new digits leave is cleared
+  static tftRect speedBox = {0, 0, 0, 0};
   tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  if (kmph < 10)
-    space = "  ";
-  tft.drawString(space + String(kmph), speedPos, 80, 8);
-  tft.drawString(String(meterph), speedPos + 114, 80, 6);
+  latencyWidgetBegin();
+  snprintf(text, sizeof(text), "%d", kmph);
+#if SPEED_ATLAS
+  tftRect box = {(int16_t)(speedPos + (kmph < 10 ? digitW : 0)), 80,
+                 (int16_t)(kmph < 10 ? digitW : 2 * digitW), tftFontHeight(8)};
+  tft.fillRectOutside(&speedBox, &box, TFT_BLACK);
+  speedBox = box;
+  speedAtlas.drawString(text, box.x, 80);
+  snprintf(text, sizeof(text), "%d", meterph);
+  meterAtlas.drawString(text, meterPos, 80);
+#else
+  tft.redrawString(text, speedPos + (kmph < 10 ? digitW : 0), 80, 8, &speedBox);
+  snprintf(text, sizeof(text), "%d", meterph);
+  tft.drawString(text, meterPos, 80, 6);
+#endif
+  latencyPixelsDone(); // drawString returns once the SPI transfer has finished
 }
 
 void displayTemp()
 {
   if (millis() - tempUpdated > 5000 || afterStartTemp)
   {
-    String temp = String(bme.readTemperature(), 1);
-    tft.setCursor(230, 5);
+    // Box of the last reading on the panel, only the part the new text leaves is cleared
+    static tftRect tempBox = {0, 0, 0, 0};
+    char text[12] = "... C"; // a failed reading, NAN fails the range test
+    float t = bme.readTemperature();
+    if (t > -100 && t < 100)
+    {
+      int t10 = (int)(t * 10 + (t < 0 ? -0.5f : 0.5f));
+      snprintf(text, sizeof(text), "%s%d.%d C", t10 < 0 ? "-" : "", abs(t10) / 10, abs(t10) % 10);
+    }
     tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-    tft.setTextFont(4);
-    tft.print(temp);
-    tft.print(" C");
+    tft.redrawString(text, 230, 5, 4, &tempBox);
     tempUpdated = millis();
     afterStartTemp = false;
   }
 }
 
+// The odometer, trip and trip data widgets are recorded in screenList and drawn by
+// displayView(), so labels that did not change cost nothing
 void displayOdo()
 {
   int odoPos = 5;
@@ -222,12 +365,13 @@ void displayOdo()
   if (km >= 10000)
     odometer = 0;
   int m100 = odometer / 10000 - (odometer / 100000 * 10);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setCursor(odoPos, 200);
-  tft.setTextFont(4);
-  tft.printf("%04d,", km);
-  tft.setTextColor(TFT_RED, TFT_BLACK);
-  tft.printf("%d", m100);
+  char text[8];
+  screenList.setTextColor(TFT_YELLOW, TFT_BLACK);
+  snprintf(text, sizeof(text), "%04d,", km);
+  odoPos += screenList.drawString(text, odoPos, 200, 4);
+  screenList.setTextColor(TFT_RED, TFT_BLACK);
+  snprintf(text, sizeof(text), "%d", m100);
+  screenList.drawString(text, odoPos, 200, 4);
 }
 
 void displayTrip()
@@ -237,63 +381,53 @@ void displayTrip()
   if (km >= 10000)
     distance = 0;
   int m100 = distance / 100 - (distance / 100000 * 1000);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setCursor(odoPos, 200);
-  tft.setTextFont(4);
-  tft.printf("%04d,", km);
-  tft.setTextColor(TFT_RED, TFT_BLACK);
-  tft.printf("%03d", m100);
+  char text[8];
+  screenList.setTextColor(TFT_YELLOW, TFT_BLACK);
+  snprintf(text, sizeof(text), "%04d,", km);
+  odoPos += screenList.drawString(text, odoPos, 200, 4);
+  screenList.setTextColor(TFT_RED, TFT_BLACK);
+  snprintf(text, sizeof(text), "%03d", m100);
+  screenList.drawString(text, odoPos, 200, 4);
+}
+
+// Label in yellow followed by a value in red, returns the x after the value
+int displayLabel(const char *label, const String &value, int y)
+{
+  screenList.setTextColor(TFT_YELLOW, TFT_BLACK);
+  int x = 5 + screenList.drawString(label, 5, y, 4);
+  screenList.setTextColor(TFT_RED, TFT_BLACK);
+  return x + screenList.drawString(value, x, y, 4);
 }
 
 void displayTripStart()
 {
   MsConverter time(tripStartTime);
-
-  tft.setCursor(5, 5);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setTextFont(4);
-  tft.print("Trip start ");
-  tft.setTextColor(TFT_RED,TFT_BLACK);
-  tft.print(time.getTimeString());
+  displayLabel("Trip start ", time.getTimeString(), 5);
 }
 
 void displayTripDriveTime()
 {
   MsConverter time(tripDriveTime);
-
-  tft.setCursor(5, 45);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setTextFont(4);
-  tft.print("Drive time ");
-  tft.setTextColor(TFT_RED,TFT_BLACK);
-  tft.print(time.getTimeString());
+  displayLabel("Drive time ", time.getTimeString(), 45);
 }
 
 void displayTripDriveAvgSpeed()
 {
-  float time = tripDriveTime / 3600000.0;
-  float avgSpeed = (distance / 100000.0) / time;
-  if(distance == 0) avgSpeed = 0.0;
-  tft.setCursor(5, 85);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setTextFont(4);
-  tft.print("Avg speed ");
-  tft.setTextColor(TFT_RED,TFT_BLACK);
-  tft.print(avgSpeed, 1);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.print(" km/h");
+  // Centimetres per millisecond times 360 is tenths of a km/h, rounded
+  unsigned long avgSpeed = 0;
+  if (distance && tripDriveTime)
+    avgSpeed = ((uint64_t)distance * 360 + tripDriveTime / 2) / tripDriveTime;
+  char text[12];
+  snprintf(text, sizeof(text), "%lu.%lu", avgSpeed / 10, avgSpeed % 10);
+  int x = displayLabel("Avg speed ", text, 85);
+  screenList.setTextColor(TFT_YELLOW, TFT_BLACK);
+  screenList.drawString(" km/h", x, 85, 4);
 }
 
 void displayTripIdleTime()
 {
   MsConverter time(tripIdleTime);
-
-  tft.setCursor(5, 125);
-  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.setTextFont(4);
-  tft.print("Idle time ");
-  tft.setTextColor(TFT_RED,TFT_BLACK);
-  tft.print(time.getTimeString());
+  displayLabel("Idle time ", time.getTimeString(), 125);
 }
 
 void getDataFromEeprom()
@@ -322,6 +456,17 @@ void writeDataToEeprom()
   }
 }
 
+uint32_t eepromLogSize()
+{
+  return addressTripStartTime + sizeof(tripStartTime);
+}
+
+void eepromLogRead(uint32_t offset, uint8_t *dst, uint16_t len)
+{
+  while (len--)
+    *dst++ = EEPROM.read(offset++);
+}
+
 void mainScreen()
 {
   displayTime();
@@ -355,6 +500,7 @@ void changeView()
         screenSelector = scrensAvailable;
       screenChangeTime = millis();
       tft.fillScreen(TFT_BLACK);
+      screenList.invalidate();
       displayView();
     }
   }
@@ -384,6 +530,11 @@ void displayView()
     mainScreen();
   else if (screenSelector == 2)
     tripDataScreen();
+#if LIST_TILES
+  screenList.flush(&screenTile);
+#else
+  screenList.flush();
+#endif
 
   // screenReset();
 }
\ No newline at end of file
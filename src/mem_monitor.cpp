@@ -0,0 +1,168 @@
+#include "mem_monitor.h"
+
+#include <malloc.h>
+#include <unistd.h>
+
+// Linker script symbols: top of RAM where the stack starts, end of .bss
+extern "C" char _estack;
+extern "C" char _end;
+
+// newlib-nano's free list (nano-mallocr.c), address ordered. size is the whole chunk,
+// the size word included. Weak, so a build against full newlib links with it null
+struct NanoChunk
+{
+  long size;
+  NanoChunk *next;
+};
+extern "C" NanoChunk *__malloc_free_list __attribute__((weak));
+
+static uint32_t *paintLow = nullptr;
+static uint32_t *paintHigh = nullptr;
+static MemStats stats;
+
+#ifdef MEM_MONITOR_WRAP
+// Linked with -Wl,--wrap=malloc etc: calls to malloc() and friends from our
+// code and the libraries land here first. newlib's own _malloc_r() calls
+// (stdio buffers, strdup and the like) bypass --wrap and are not counted.
+// Not used from interrupts, so no locking.
+static uint32_t live = 0;
+static uint32_t livePeak = 0;
+
+static void countAlloc(void *p, size_t n)
+{
+  stats.allocs++;
+  if (!p)
+  {
+    if (n)
+      stats.failedAllocs++;
+    return;
+  }
+  live += malloc_usable_size(p);
+  if (live > livePeak)
+    livePeak = live;
+}
+
+// Blocks newlib allocated for itself are freed through the wrapper too, e.g. when
+// a stdio stream is closed, so live stops at 0 rather than wrapping
+static void countFree(size_t n)
+{
+  live = live > n ? live - n : 0;
+}
+
+extern "C"
+{
+  void *__real_malloc(size_t n);
+  void __real_free(void *p);
+  void *__real_realloc(void *p, size_t n);
+  void *__real_calloc(size_t count, size_t n);
+
+  void *__wrap_malloc(size_t n)
+  {
+    void *p = __real_malloc(n);
+    countAlloc(p, n);
+    return p;
+  }
+
+  void __wrap_free(void *p)
+  {
+    if (p)
+      countFree(malloc_usable_size(p));
+    __real_free(p);
+  }
+
+  void *__wrap_realloc(void *p, size_t n)
+  {
+    size_t before = p ? malloc_usable_size(p) : 0;
+    void *q = __real_realloc(p, n);
+    if (q || !n)
+      countFree(before); // moved, resized or freed
+    countAlloc(q, n);
+    return q;
+  }
+
+  void *__wrap_calloc(size_t count, size_t n)
+  {
+    void *p = __real_calloc(count, n);
+    countAlloc(p, count * n);
+    return p;
+  }
+}
+#endif
+
+// Paints from the current heap end up to just below this function's frame.
+// Kept out of line so the frame it skips is its own and nothing of setup()'s.
+__attribute__((noinline)) void memBegin()
+{
+  uint32_t marker;
+  paintLow = (uint32_t *)(((uintptr_t)sbrk(0) + 3) & ~(uintptr_t)3);
+  paintHigh = (uint32_t *)(((uintptr_t)&marker - 64) & ~(uintptr_t)3);
+  for (uint32_t *p = paintLow; p < paintHigh; p++)
+    *p = MEM_PAINT;
+  stats.stackPainted = (uintptr_t)&_estack - (uintptr_t)paintLow;
+  memPoll();
+}
+
+// Lowest address the stack has reached. The heap may since have grown into
+// the painted area, so the scan starts above the current heap end.
+static uintptr_t stackLowWater(uintptr_t heapEnd)
+{
+  uint32_t *p = paintLow;
+  if ((uintptr_t)p < heapEnd)
+    p = (uint32_t *)((heapEnd + 3) & ~(uintptr_t)3);
+  while (p < paintHigh && *p == MEM_PAINT)
+    p++;
+  return (uintptr_t)p;
+}
+
+void memPoll()
+{
+  if (!paintLow)
+    return;
+
+  uintptr_t heapEnd = (uintptr_t)sbrk(0);
+  uintptr_t low = stackLowWater(heapEnd);
+  stats.stackUsed = (uintptr_t)&_estack - low;
+
+  struct mallinfo mi = mallinfo();
+#ifdef MEM_MONITOR_WRAP
+  stats.heapUsed = live;
+  stats.heapPeak = livePeak;
+#else
+  stats.heapUsed = mi.uordblks;
+  if (stats.heapUsed > stats.heapPeak)
+    stats.heapPeak = stats.heapUsed;
+#endif
+  stats.heapArena = mi.arena;
+
+  // nano malloc() takes a new chunk from sbrk() when no free chunk fits, so the
+  // biggest block is the larger of the biggest free chunk and the room above the heap
+  uint32_t room = low > heapEnd + MEM_STACK_GUARD ? low - heapEnd - MEM_STACK_GUARD : 0;
+  uint32_t chunk = 0;
+  if (&__malloc_free_list)
+  {
+    for (NanoChunk *c = __malloc_free_list; c; c = c->next)
+      if ((uint32_t)c->size > chunk)
+        chunk = c->size;
+  }
+  chunk = chunk > sizeof(long) ? chunk - sizeof(long) : 0; // less the size word
+  stats.freeTotal = mi.fordblks + room;
+  stats.largestFree = chunk > room ? chunk : room;
+  stats.fragmentation = stats.freeTotal ? 10000 - 10000ULL * stats.largestFree / stats.freeTotal : 0;
+}
+
+const MemStats &memStats()
+{
+  return stats;
+}
+
+void memReport(Print &out)
+{
+  out.printf("mem: stack %lu/%lu, heap %lu peak %lu arena %lu, free %lu largest %lu frag %u.%02u%%",
+             (unsigned long)stats.stackUsed, (unsigned long)stats.stackPainted, (unsigned long)stats.heapUsed,
+             (unsigned long)stats.heapPeak, (unsigned long)stats.heapArena, (unsigned long)stats.freeTotal,
+             (unsigned long)stats.largestFree, stats.fragmentation / 100, stats.fragmentation % 100);
+#ifdef MEM_MONITOR_WRAP
+  out.printf(", %lu allocs %lu failed", (unsigned long)stats.allocs, (unsigned long)stats.failedAllocs);
+#endif
+  out.println();
+}
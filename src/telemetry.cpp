@@ -0,0 +1,129 @@
+#include <Arduino.h>
+#include "telemetry.h"
+#include "log_protocol.h"
+
+// USART3 is free on the Black Pill: USART1 carries Serial and PA2/PA3 drive the TFT
+static HardwareSerial telemetrySerial(PB11, PB10);
+
+static uint8_t frames[2][TELEMETRY_FRAME_SIZE];
+static int8_t inFlight = -1;  // buffer owned by DMA, -1 when idle
+static int8_t pending = -1;   // buffer waiting for DMA
+static uint8_t seq = 0;
+static uint16_t dropped = 0;
+static uint32_t periodUs = 0;
+static uint32_t lastFrameUs = 0;
+
+#if defined(STM32F1xx)
+// USART3 TX is hard wired to DMA1 channel 2 on the F1
+static void startDma(uint8_t buf)
+{
+  DMA1_Channel2->CCR &= ~DMA_CCR_EN;
+  DMA1->IFCR = DMA_IFCR_CGIF2;
+  DMA1_Channel2->CMAR = (uint32_t)frames[buf];
+  DMA1_Channel2->CNDTR = TELEMETRY_FRAME_SIZE;
+  DMA1_Channel2->CCR |= DMA_CCR_EN;
+  inFlight = buf;
+}
+
+static bool dmaDone()
+{
+  return DMA1->ISR & DMA_ISR_TCIF2;
+}
+
+static void initDma()
+{
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  DMA1_Channel2->CCR = 0;
+  DMA1_Channel2->CPAR = (uint32_t)&USART3->DR;
+  DMA1_Channel2->CCR = DMA_CCR_MINC | DMA_CCR_DIR; // byte wide, memory to peripheral
+  USART3->CR3 |= USART_CR3_DMAT;
+}
+#else
+// No DMA mapping for this part, fall back to the buffered UART driver
+static void startDma(uint8_t buf)
+{
+  telemetrySerial.write(frames[buf], TELEMETRY_FRAME_SIZE);
+  inFlight = buf;
+}
+
+static bool dmaDone()
+{
+  return telemetrySerial.availableForWrite() >= TELEMETRY_FRAME_SIZE;
+}
+
+static void initDma() {}
+#endif
+
+void telemetryBegin(uint16_t rateHz)
+{
+  if (!rateHz)
+    return;
+  periodUs = 1000000UL / rateHz;
+  telemetrySerial.begin(TELEMETRY_BAUD);
+  initDma();
+}
+
+static void buildFrame(uint8_t *f, const TelemetrySnapshot &s, uint32_t now)
+{
+  f[0] = TELEMETRY_SYNC & 0xFF;
+  f[1] = TELEMETRY_SYNC >> 8;
+  f[2] = TELEMETRY_VERSION;
+  f[3] = seq++;
+  logPut32(f + 4, now);
+  logPut32(f + 8, s.pulseMs);
+  logPut32(f + 12, s.distanceCm);
+  f[16] = s.speed;
+  f[17] = s.speed >> 8;
+  f[18] = s.idle;
+  f[19] = s.idle >> 8;
+  logPut32(f + 20, s.loopUs);
+  logPut32(f + 24, s.latencyUs);
+  f[28] = dropped;
+  f[29] = dropped >> 8;
+  f[30] = s.latencySeq;
+  f[31] = s.latencySeq >> 8;
+  f[32] = s.stackUsed;
+  f[33] = s.stackUsed >> 8;
+  f[34] = s.heapUsed;
+  f[35] = s.heapUsed >> 8;
+  f[36] = s.heapPeak;
+  f[37] = s.heapPeak >> 8;
+  f[38] = s.largestFree;
+  f[39] = s.largestFree >> 8;
+  f[40] = s.fragmentation;
+  f[41] = s.fragmentation >> 8;
+  uint32_t crc = logCrc32(f, 42);
+  f[42] = crc;
+  f[43] = crc >> 8;
+}
+
+bool telemetryPoll(const TelemetrySnapshot &snapshot)
+{
+  if (!periodUs)
+    return false;
+
+  bool worked = false;
+  if (inFlight >= 0 && dmaDone())
+    inFlight = -1;
+
+  uint32_t now = micros();
+  if (now - lastFrameUs >= periodUs)
+  {
+    lastFrameUs = now;
+    // A pending frame not yet sent is replaced by the fresher one
+    if (pending >= 0)
+      dropped++;
+    uint8_t buf = inFlight == 0 ? 1 : 0;
+    buildFrame(frames[buf], snapshot, now);
+    pending = buf;
+    worked = true;
+  }
+
+  if (pending >= 0 && inFlight < 0)
+  {
+    startDma(pending);
+    pending = -1;
+    worked = true;
+  }
+  return worked;
+}
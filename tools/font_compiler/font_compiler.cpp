@@ -0,0 +1,566 @@
+// Converts the TFT_eSPI fonts to span encoded glyphs for tft.setSpanFont().
+//
+// Font 2 bitmaps, the run length encoded fonts 4, 6, 7 and 8 and the GFX free
+// fonts are compiled in and decoded to pixels. Each glyph is cut to the box
+// around its set pixels and stored a row at a time as (skip, run) byte pairs,
+// which the library draws as lines without looking at single pixels. The
+// output is decoded again and compared with the source, any pixel that
+// differs is an error.
+//
+//   g++ -O2 -std=c++17 -I../../lib/TFT_eSPI font_compiler.cpp -o font_compiler
+//
+//   ./font_compiler [--name Name] [--out file.h] [--chars text] [--scan file] [--aa k] font
+//
+// font is 2, 4, 6, 7, 8 or 8N (font 8 with 53 pixel digits), or the name of a
+// GFX font, e.g. FreeSansBold12pt7b. A GFX font keeps its line height and has
+// its baseline where the tallest glyph needs it, so it can be registered in an
+// unused font number such as 3 or 5. The header goes to stdout by default.
+// The library keeps whole fonts 4 and 8 in Fonts/Spans:
+//
+//   ./font_compiler --out ../../lib/TFT_eSPI/Fonts/Spans/Font4spans.h 4
+//
+// --chars keeps only the glyphs of the characters given and --scan those of
+// the string literals in a source file, skipping comments, #include lines and
+// printf conversions. Both can be repeated. A glyph left out keeps its table
+// entry with an advance of 0, tft.missingGlyph() reports it if it is asked
+// for, and the range is cut to the first and last glyph kept. subset_fonts.py
+// trims the firmware fonts this way before every build.
+//
+// Row format, for the rows of the glyph box from the top:
+//   n, then n pairs of (skip, run)  n runs, skip counted from the end of the
+//                                   last run or the left edge of the box
+//   0x80 | (k - 1)                  the last row again, k more times
+//
+// --aa k makes an anti-aliased font k times smaller than the source instead.
+// Each pixel is the share of its k x k source pixels that are set, as 4 bit
+// alpha, and the rows are these two pixels to a byte, left pixel in the high
+// nibble, each row starting on a whole byte. The grid is lined up with the
+// baseline and the left edge of the cell, advances are rounded. A GFX font
+// drawn at 2 or 3 times the size wanted gives smooth text that the library
+// draws through a table of 16 blended colours, with no font file to parse:
+//
+//   ./font_compiler --aa 2 --name FreeSans12ptAA --out ../../lib/TFT_eSPI/Fonts/Spans/FreeSans12ptAA.h FreeSans24pt7b
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#define PROGMEM
+#define LOAD_GFXFF
+
+namespace f2  {
+#include "Fonts/Font16.h"
+}
+namespace f4  {
+#include "Fonts/Font32rle.h"
+}
+namespace f6  {
+#include "Fonts/Font64rle.h"
+}
+namespace f7  {
+#include "Fonts/Font7srle.h"
+}
+namespace f8  {
+#include "Fonts/Font72rle.h"
+}
+namespace f8n {
+#include "Fonts/Font72x53rle.h"
+}
+#include "Fonts/GFXFF/gfxfont.h"
+#include "Fonts/FontMetrics.h"
+
+#define GFX_FONTS(X) \
+  X(TomThumb) \
+  X(FreeMono9pt7b) X(FreeMono12pt7b) X(FreeMono18pt7b) X(FreeMono24pt7b) \
+  X(FreeMonoOblique9pt7b) X(FreeMonoOblique12pt7b) X(FreeMonoOblique18pt7b) X(FreeMonoOblique24pt7b) \
+  X(FreeMonoBold9pt7b) X(FreeMonoBold12pt7b) X(FreeMonoBold18pt7b) X(FreeMonoBold24pt7b) \
+  X(FreeMonoBoldOblique9pt7b) X(FreeMonoBoldOblique12pt7b) X(FreeMonoBoldOblique18pt7b) X(FreeMonoBoldOblique24pt7b) \
+  X(FreeSans9pt7b) X(FreeSans12pt7b) X(FreeSans18pt7b) X(FreeSans24pt7b) \
+  X(FreeSansOblique9pt7b) X(FreeSansOblique12pt7b) X(FreeSansOblique18pt7b) X(FreeSansOblique24pt7b) \
+  X(FreeSansBold9pt7b) X(FreeSansBold12pt7b) X(FreeSansBold18pt7b) X(FreeSansBold24pt7b) \
+  X(FreeSansBoldOblique9pt7b) X(FreeSansBoldOblique12pt7b) X(FreeSansBoldOblique18pt7b) X(FreeSansBoldOblique24pt7b) \
+  X(FreeSerif9pt7b) X(FreeSerif12pt7b) X(FreeSerif18pt7b) X(FreeSerif24pt7b) \
+  X(FreeSerifItalic9pt7b) X(FreeSerifItalic12pt7b) X(FreeSerifItalic18pt7b) X(FreeSerifItalic24pt7b) \
+  X(FreeSerifBold9pt7b) X(FreeSerifBold12pt7b) X(FreeSerifBold18pt7b) X(FreeSerifBold24pt7b) \
+  X(FreeSerifBoldItalic9pt7b) X(FreeSerifBoldItalic12pt7b) X(FreeSerifBoldItalic18pt7b) X(FreeSerifBoldItalic24pt7b)
+
+// A glyph as pixels, x and y relative to the top left of its character cell
+struct Glyph {
+  int advance = 0;
+  int x = 0, y = 0, w = 0, h = 0;
+  std::vector<uint8_t> px;          // w x h, 1 = set, or the alpha 0 to 15 with --aa
+
+  uint8_t at(int i, int j) const { return (i >= 0 && j >= 0 && i < w && j < h) ? px[j * w + i] : 0; }
+};
+
+struct Font {
+  std::string source;
+  int first = 0, last = 0;
+  int height = 0, baseline = 0;
+  std::vector<Glyph> glyph;
+  size_t sourceBytes = 0;           // glyph data in the source format
+};
+
+struct NumberedFont {
+  const char *name;
+  const unsigned char *widths;
+  const unsigned char *const *chars;
+  int height, baseline;
+  bool rle;
+};
+
+static const NumberedFont numbered[] = {
+  { "2",  f2::widtbl_f16,  f2::chrtbl_f16,  chr_hgt_f16, baseline_f16, false },
+  { "4",  f4::widtbl_f32,  f4::chrtbl_f32,  chr_hgt_f32, baseline_f32, true },
+  { "6",  f6::widtbl_f64,  f6::chrtbl_f64,  chr_hgt_f64, baseline_f64, true },
+  { "7",  f7::widtbl_f7s,  f7::chrtbl_f7s,  chr_hgt_f7s, baseline_f7s, true },
+  { "8",  f8::widtbl_f72,  f8::chrtbl_f72,  chr_hgt_f72, baseline_f72, true },
+  { "8N", f8n::widtbl_f72, f8n::chrtbl_f72, chr_hgt_f72, baseline_f72, true },
+};
+
+// FontMetrics.h has the widths again for compile time layout, they must not drift apart
+static bool metricsMatch(const NumberedFont &nf)
+{
+  for (int c = 32; c < 128; c++) {
+    int w = tftCharWidth(nf.name[0] - '0', c);
+    if (nf.name[1] == 'N' && c >= '0' && c <= '9') w = 53; // Metrics are of font 8 unless LOAD_FONT8N
+    if (nf.widths[c - 32] != w) return false;
+  }
+  return true;
+}
+
+struct NamedGfxFont { const char *name; const GFXfont *font; };
+
+#define GFX_ENTRY(f) { #f, &f },
+static const NamedGfxFont gfxFonts[] = { GFX_FONTS(GFX_ENTRY) };
+
+// Cut the glyph down to the box around its set pixels, an empty glyph has no box
+static void trim(Glyph &g)
+{
+  int x0 = g.w, y0 = g.h, x1 = -1, y1 = -1;
+  for (int j = 0; j < g.h; j++)
+    for (int i = 0; i < g.w; i++)
+      if (g.at(i, j)) {
+        if (i < x0) x0 = i;
+        if (i > x1) x1 = i;
+        if (j < y0) y0 = j;
+        if (j > y1) y1 = j;
+      }
+
+  Glyph t;
+  t.advance = g.advance;
+  if (x1 >= 0) {
+    t.x = g.x + x0; t.y = g.y + y0;
+    t.w = x1 - x0 + 1; t.h = y1 - y0 + 1;
+    t.px.resize(t.w * t.h);
+    for (int j = 0; j < t.h; j++)
+      for (int i = 0; i < t.w; i++) t.px[j * t.w + i] = g.at(x0 + i, y0 + j);
+  }
+  g = t;
+}
+
+// Pixels as drawChar() draws them: font 2 rows are whole bytes, MSB left, and the
+// RLE fonts are runs of (n & 0x7F) + 1 pixels, set if bit 7 is set
+static Font loadNumbered(const NumberedFont &nf)
+{
+  Font f;
+  f.source = std::string("Font ") + nf.name;
+  f.first = 32; f.last = 127;
+  f.height = nf.height; f.baseline = nf.baseline;
+
+  for (int c = 0; c < 96; c++) {
+    Glyph g;
+    g.advance = g.w = nf.widths[c];
+    g.h = nf.height;
+    g.px.assign(g.w * g.h, 0);
+    const unsigned char *p = nf.chars[c];
+
+    if (!nf.rle) {
+      int bytes = (g.w + 6) / 8;
+      for (int j = 0; j < g.h; j++)
+        for (int i = 0; i < g.w && i < bytes * 8; i++)
+          g.px[j * g.w + i] = (p[j * bytes + i / 8] >> (7 - i % 8)) & 1;
+      f.sourceBytes += bytes * g.h;
+    }
+    else {
+      int n = 0, total = g.w * g.h;
+      while (n < total) {
+        uint8_t b = *p++;
+        int run = (b & 0x7F) + 1;
+        for (int k = 0; k < run && n < total; k++, n++) g.px[n] = b >> 7;
+        f.sourceBytes++;
+      }
+    }
+    trim(g);
+    f.glyph.push_back(g);
+  }
+  return f;
+}
+
+// A GFX glyph hangs from the baseline, the cell top is the tallest ascent above it
+static Font loadGfx(const NamedGfxFont &nf)
+{
+  const GFXfont *gf = nf.font;
+  Font f;
+  f.source = nf.name;
+  f.first = gf->first; f.last = gf->last;
+
+  int ascent = 0, descent = 0;
+  for (int c = 0; c <= f.last - f.first; c++) {
+    const GFXglyph &gg = gf->glyph[c];
+    if (-gg.yOffset > ascent) ascent = -gg.yOffset;
+    if (gg.yOffset + gg.height > descent) descent = gg.yOffset + gg.height;
+  }
+  f.baseline = ascent;
+  f.height = gf->yAdvance > ascent + descent ? gf->yAdvance : ascent + descent;
+
+  for (int c = 0; c <= f.last - f.first; c++) {
+    const GFXglyph &gg = gf->glyph[c];
+    Glyph g;
+    g.advance = gg.xAdvance;
+    g.x = gg.xOffset; g.y = ascent + gg.yOffset;
+    g.w = gg.width; g.h = gg.height;
+    g.px.resize(g.w * g.h);
+    uint32_t bit = gg.bitmapOffset * 8;
+    for (int n = 0; n < g.w * g.h; n++, bit++) g.px[n] = (gf->bitmap[bit >> 3] >> (7 - (bit & 7))) & 1;
+    f.sourceBytes += (g.w * g.h + 7) / 8;
+    trim(g);
+    f.glyph.push_back(g);
+  }
+  return f;
+}
+
+static int floorDiv(int a, int k) { return a >= 0 ? a / k : -((k - 1 - a) / k); }
+
+// The font k times smaller, each pixel the 4 bit share of the k x k source pixels set.
+// Source row baseline is the top of output row baseline / k, rounded up
+static void supersample(Font &f, int k)
+{
+  int above = (f.baseline + k - 1) / k;
+  int below = (f.height - f.baseline + k - 1) / k;
+
+  for (auto &g : f.glyph) {
+    Glyph s;
+    s.advance = (g.advance + k / 2) / k;
+    if (g.advance && !s.advance) s.advance = 1; // An advance of 0 is a glyph left out
+    if (g.w) {
+      int x0 = floorDiv(g.x, k), x1 = floorDiv(g.x + g.w - 1, k);
+      int y0 = floorDiv(g.y - f.baseline, k), y1 = floorDiv(g.y + g.h - 1 - f.baseline, k);
+      s.x = x0; s.y = y0 + above;
+      s.w = x1 - x0 + 1; s.h = y1 - y0 + 1;
+      s.px.resize(s.w * s.h);
+      for (int j = 0; j < s.h; j++)
+        for (int i = 0; i < s.w; i++) {
+          int set = 0;
+          for (int b = 0; b < k; b++)
+            for (int a = 0; a < k; a++)
+              set += g.at((x0 + i) * k + a - g.x, (y0 + j) * k + b + f.baseline - g.y) ? 1 : 0;
+          s.px[j * s.w + i] = (set * 15 + k * k / 2) / (k * k);
+        }
+      trim(s);
+    }
+    g = s;
+  }
+  f.baseline = above;
+  f.height = above + below;
+}
+
+// Characters of the string literals in a C++ source file
+static bool scanLiterals(const char *file, std::string &chars)
+{
+  FILE *in = fopen(file, "rb");
+  if (!in) return false;
+  std::string src;
+  char buf[4096];
+  for (size_t n; (n = fread(buf, 1, sizeof(buf), in)) > 0; ) src.append(buf, n);
+  fclose(in);
+
+  for (size_t i = 0; i < src.size(); i++) {
+    bool lineStart = i == 0 || src[i - 1] == '\n';
+    if (src.compare(i, 2, "//") == 0 || (lineStart && src.compare(i, 8, "#include") == 0)) {
+      while (i < src.size() && src[i] != '\n') i++;
+    }
+    else if (src.compare(i, 2, "/*") == 0) {
+      size_t e = src.find("*/", i + 2);
+      i = e == std::string::npos ? src.size() : e + 1;
+    }
+    else if (src[i] == '\'') {
+      for (i++; i < src.size() && src[i] != '\''; i++) if (src[i] == '\\') i++;
+    }
+    else if (src[i] == '"') {
+      for (i++; i < src.size() && src[i] != '"'; i++) {
+        char c = src[i];
+        if (c == '\\' && i + 1 < src.size()) {
+          c = src[++i];
+          if (c == 'x') { c = (char)strtol(src.substr(i + 1, 2).c_str(), nullptr, 16); i += 2; }
+          else if (c != '\\' && c != '"' && c != '\'') continue; // \n, \t...
+        }
+        else if (c == '%' && i + 1 < src.size()) {
+          // A printf conversion prints what --chars declares, %% prints %
+          size_t e = src.find_first_not_of("-+ #0123456789.hlLzjt", i + 1);
+          if (e != std::string::npos && strchr("diouxXeEfFgGcsp", src[e])) { i = e; continue; }
+          if (src[i + 1] == '%') i++;
+        }
+        if ((uint8_t)c >= 32) chars += c;
+      }
+    }
+  }
+  return true;
+}
+
+// Leave out the glyphs of characters not in chars and cut the range to the ones kept
+static bool subset(Font &f, const std::string &chars)
+{
+  int first = -1, last = -1;
+  for (int c = f.first; c <= f.last; c++) {
+    Glyph &g = f.glyph[c - f.first];
+    if (chars.find((char)c) == std::string::npos || c > 255) g = Glyph();
+    else {
+      if (first < 0) first = c;
+      last = c;
+    }
+  }
+  if (first < 0) return false;
+  f.glyph.erase(f.glyph.begin() + (last - f.first + 1), f.glyph.end());
+  f.glyph.erase(f.glyph.begin(), f.glyph.begin() + (first - f.first));
+  f.first = first; f.last = last;
+  return true;
+}
+
+typedef std::vector<std::pair<int, int>> Runs; // (skip, run)
+
+static Runs rowRuns(const Glyph &g, int j)
+{
+  Runs r;
+  int end = 0;
+  for (int i = 0; i < g.w; ) {
+    if (!g.at(i, j)) { i++; continue; }
+    int s = i;
+    while (i < g.w && g.at(i, j)) i++;
+    r.push_back(std::make_pair(s - end, i - s));
+    end = i;
+  }
+  return r;
+}
+
+static bool encode(const Glyph &g, std::vector<uint8_t> &out)
+{
+  Runs last;
+  int repeat = 0;
+  for (int j = 0; j <= g.h; j++) {
+    Runs r;
+    if (j < g.h) r = rowRuns(g, j);
+    if (j > 0 && j < g.h && r == last && repeat < 128) { repeat++; continue; }
+    if (repeat) out.push_back(0x80 | (repeat - 1));
+    repeat = 0;
+    if (j == g.h) break;
+    if (r.size() > 0x7F) return false;
+    out.push_back(r.size());
+    for (auto &s : r) { out.push_back(s.first); out.push_back(s.second); }
+    last = r;
+  }
+  return true;
+}
+
+// Glyph box rows of 4 bit alpha, two pixels to a byte
+static void encodeAlpha(const Glyph &g, std::vector<uint8_t> &out)
+{
+  for (int j = 0; j < g.h; j++)
+    for (int i = 0; i < g.w; i += 2) out.push_back(g.at(i, j) << 4 | g.at(i + 1, j));
+}
+
+// The library's decoder, into a cleared w x h cell
+static void decode(const uint8_t *p, int gx, int gy, int gw, int rows,
+                   std::vector<uint8_t> &cell, int cx, int cy, int cw, int ch, int &errors)
+{
+  auto set = [&](int i, int j) {
+    int x = cx + gx + i, y = cy + gy + j;
+    if (i >= gw || x < 0 || y < 0 || x >= cw || y >= ch) { errors++; return; }
+    cell[y * cw + x] = 1;
+  };
+
+  const uint8_t *row = p;
+  for (int j = 0; j < rows; ) {
+    uint8_t n = *p++, k = 1;
+    const uint8_t *r = p;
+    if (n & 0x80) { k = (n & 0x7F) + 1; r = row; n = *r++; }
+    else { row = p - 1; p += 2 * n; }
+    for (; k; k--, j++) {
+      const uint8_t *s = r;
+      int x = 0;
+      for (int i = 0; i < n; i++) {
+        x += *s++;
+        for (int len = *s++; len; len--) set(x++, j);
+      }
+    }
+  }
+}
+
+// The library's alpha decoder, as drawAlphaGlyph() and pushAlphaGlyph() read the rows
+static void decodeAlpha(const uint8_t *p, int gx, int gy, int gw, int rows,
+                        std::vector<uint8_t> &cell, int cx, int cy, int cw, int ch, int &errors)
+{
+  for (int j = 0; j < rows; j++, p += (gw + 1) >> 1)
+    for (int i = 0; i < gw; i++) {
+      int x = cx + gx + i, y = cy + gy + j;
+      if (x < 0 || y < 0 || x >= cw || y >= ch) { errors++; continue; }
+      cell[y * cw + x] = (i & 1) ? p[i >> 1] & 0x0F : p[i >> 1] >> 4;
+    }
+}
+
+static void printChar(FILE *out, int c)
+{
+  if (c >= 32 && c < 127 && c != '\\') fprintf(out, "0x%02X '%c'", c, c);
+  else fprintf(out, "0x%02X", c);
+}
+
+int main(int argc, char **argv)
+{
+  const char *name = nullptr, *outName = nullptr, *which = nullptr;
+  std::string chars;
+  bool sub = false;
+  int aa = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--name") && i + 1 < argc) name = argv[++i];
+    else if (!strcmp(argv[i], "--out") && i + 1 < argc) outName = argv[++i];
+    else if (!strcmp(argv[i], "--chars") && i + 1 < argc) chars += argv[++i], sub = true;
+    else if (!strcmp(argv[i], "--scan") && i + 1 < argc) {
+      if (!scanLiterals(argv[++i], chars)) {
+        fprintf(stderr, "font_compiler: cannot read %s\n", argv[i]);
+        return 1;
+      }
+      sub = true;
+    }
+    else if (!strcmp(argv[i], "--aa") && i + 1 < argc && (aa = atoi(argv[i + 1])) >= 1 && aa <= 4) i++;
+    else if (argv[i][0] != '-' && !which) which = argv[i];
+    else which = nullptr, i = argc;
+  }
+  if (!which) {
+    fprintf(stderr, "usage: font_compiler [--name Name] [--out file.h] [--chars text] [--scan file] "
+                    "[--aa 1-4] 2|4|6|7|8|8N|<GFX font>\n");
+    return 2;
+  }
+
+  Font f;
+  std::string defName;
+  bool found = false;
+  for (auto &nf : numbered)
+    if (!strcmp(which, nf.name)) {
+      if (!metricsMatch(nf)) {
+        fprintf(stderr, "font_compiler: Fonts/FontMetrics.h widths differ from font %s\n", nf.name);
+        return 1;
+      }
+      f = loadNumbered(nf); defName = std::string("Font") + nf.name + "spans"; found = true;
+    }
+  for (auto &nf : gfxFonts)
+    if (!strcmp(which, nf.name)) { f = loadGfx(nf); defName = std::string(nf.name) + "spans"; found = true; }
+  if (!found) {
+    fprintf(stderr, "font_compiler: unknown font %s\n", which);
+    return 2;
+  }
+  if (aa) defName.replace(defName.size() - 5, 5, "aa" + std::to_string(aa));
+  if (!name) name = defName.c_str();
+
+  if (sub && !subset(f, chars)) {
+    fprintf(stderr, "font_compiler: %s has none of the characters asked for\n", f.source.c_str());
+    return 1;
+  }
+  if (aa) supersample(f, aa);
+
+  std::vector<uint8_t> rows;
+  std::vector<uint16_t> offset;
+  for (size_t c = 0; c < f.glyph.size(); c++) {
+    const Glyph &g = f.glyph[c];
+    if (rows.size() > 0xFFFF) {
+      fprintf(stderr, "font_compiler: more than 64 KB of rows\n");
+      return 1;
+    }
+    if (g.advance > 255 || g.w > 255 || g.h > 255 || g.x < -128 || g.x > 127 || g.y < -128 || g.y > 127 ||
+        f.height > 255) {
+      fprintf(stderr, "font_compiler: glyph 0x%02X is too big\n", (int)(f.first + c));
+      return 1;
+    }
+    offset.push_back(rows.size());
+    if (aa) encodeAlpha(g, rows);
+    else if (!encode(g, rows)) {
+      fprintf(stderr, "font_compiler: glyph 0x%02X has more than 127 runs in a row\n", (int)(f.first + c));
+      return 1;
+    }
+  }
+
+  // Decode the output into cells and compare with the source pixels
+  int errors = 0;
+  for (size_t c = 0; c < f.glyph.size(); c++) {
+    const Glyph &g = f.glyph[c];
+    int cx = 128, cy = 128, cw = 512, ch = 512;
+    std::vector<uint8_t> cell(cw * ch, 0);
+    int bad = 0;
+    if (aa) decodeAlpha(&rows[offset[c]], g.x, g.y, g.w, g.h, cell, cx, cy, cw, ch, bad);
+    else decode(&rows[offset[c]], g.x, g.y, g.w, g.h, cell, cx, cy, cw, ch, bad);
+    for (int y = 0; y < ch; y++)
+      for (int x = 0; x < cw; x++)
+        if (cell[y * cw + x] != g.at(x - cx - g.x, y - cy - g.y)) bad++;
+    if (bad) fprintf(stderr, "font_compiler: glyph 0x%02X decodes with %d wrong pixels\n", (int)(f.first + c), bad);
+    errors += bad;
+  }
+  if (errors) return 1;
+
+  FILE *out = stdout;
+  if (outName && !(out = fopen(outName, "w"))) {
+    fprintf(stderr, "font_compiler: cannot write %s\n", outName);
+    return 1;
+  }
+
+  if (aa) fprintf(out, "// %s at 1/%d size as 4 bit alpha glyphs, generated by tools/font_compiler:\n", f.source.c_str(), aa);
+  else fprintf(out, "// %s as span encoded glyphs, generated by tools/font_compiler:\n", f.source.c_str());
+  fprintf(out, "//  ");
+  for (int i = 0; i < argc; i++) {
+    if (!i) fprintf(out, " ./font_compiler");
+    else if (strpbrk(argv[i], " \"'\\$`*?")) fprintf(out, " '%s'", argv[i]);
+    else fprintf(out, " %s", argv[i]);
+  }
+  fprintf(out, "\n");
+  if (sub) {
+    fprintf(out, "// Only these glyphs are kept: ");
+    for (size_t c = 0; c < f.glyph.size(); c++) if (f.glyph[c].advance) fprintf(out, "%c", (int)(f.first + c));
+    fprintf(out, "\n");
+  }
+  fprintf(out, "// Register it with tft.setSpanFont(font, &%s)\n\n", name);
+
+  fprintf(out, "const uint8_t %sRows[] PROGMEM = {\n", name);
+  for (size_t c = 0; c < f.glyph.size(); c++) {
+    size_t end = c + 1 < f.glyph.size() ? offset[c + 1] : rows.size();
+    if (offset[c] == end) continue;
+    fprintf(out, "  // ");
+    printChar(out, f.first + c);
+    for (size_t i = offset[c]; i < end; i++) fprintf(out, "%s0x%02X,", (i - offset[c]) % 16 ? " " : "\n  ", rows[i]);
+    fprintf(out, "\n");
+  }
+  if (rows.empty()) fprintf(out, "  0\n");
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "const tftSpanGlyph %sGlyphs[] PROGMEM = {\n", name);
+  for (size_t c = 0; c < f.glyph.size(); c++) {
+    const Glyph &g = f.glyph[c];
+    fprintf(out, "  { %5d, %3d, %3d, %3d, %4d, %4d }, // ", offset[c], g.advance, g.w, g.h, g.x, g.y);
+    printChar(out, f.first + c);
+    fprintf(out, "\n");
+  }
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "const tftSpanFont %s PROGMEM = {\n", name);
+  fprintf(out, "  %sRows, %sGlyphs, 0x%02X, 0x%02X, %d, %d%s\n};\n", name, name, f.first, f.last, f.height, f.baseline,
+          aa ? ", 4" : "");
+
+  if (out != stdout) fclose(out);
+
+  int kept = 0;
+  for (auto &g : f.glyph) if (g.advance) kept++;
+  fprintf(stderr, "%s: %d glyphs, %zu bytes of glyph data in the source, %zu of rows and %zu of glyph table\n",
+          f.source.c_str(), kept, f.sourceBytes, rows.size(), f.glyph.size() * 8);
+  return 0;
+}
@@ -0,0 +1,89 @@
+# Trims the firmware fonts to the characters it draws, run by PlatformIO before
+# every build (extra_scripts in platformio.ini) or by hand from anywhere:
+#
+#   python3 tools/font_compiler/subset_fonts.py
+#
+# Each font keeps the characters of its FONTn_CHARS define in src/main.cpp, what
+# numbers, times and temperatures print as, plus those of the string literals
+# in the sources listed for it below. The headers go to include/dash_fontN.h and
+# are only written again when a source, the tool or this script has changed, so
+# a build without a host compiler still works from the ones in git.
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+# Font number and the files whose string literals are drawn in it
+FONTS = [
+    (4, ["src/main.cpp"]),
+    (6, []),
+    (8, []),
+]
+DEFINES = "src/main.cpp"
+
+try:
+    Import("env")  # noqa: F821, run by PlatformIO, which does not set __file__
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+    BUILD = env.subst("$PROJECT_BUILD_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    BUILD = os.path.join(ROOT, ".pio", "build")
+HERE = os.path.join(ROOT, "tools", "font_compiler")
+
+
+def chars_defined(path):
+    with open(path) as f:
+        src = f.read()
+    found = {}
+    for n, text in re.findall(r'#define\s+FONT(\d)_CHARS\s+"((?:[^"\\]|\\.)*)"', src):
+        found[int(n)] = text.encode().decode("unicode_escape")
+    return found
+
+
+def newest(paths):
+    return max(os.path.getmtime(p) for p in paths)
+
+
+def build_tool(build_dir):
+    src = os.path.join(HERE, "font_compiler.cpp")
+    tool = os.path.join(build_dir, "font_compiler")
+    if os.path.exists(tool) and os.path.getmtime(tool) >= os.path.getmtime(src):
+        return tool
+    cxx = os.environ.get("HOST_CXX", "g++")
+    if not shutil.which(cxx):
+        return None
+    os.makedirs(build_dir, exist_ok=True)
+    subprocess.check_call([cxx, "-O2", "-std=c++17", "-I" + os.path.join(ROOT, "lib", "TFT_eSPI"),
+                           src, "-o", tool])
+    return tool
+
+
+def subset_fonts(build_dir):
+    defined = chars_defined(os.path.join(ROOT, DEFINES))
+    tool = None
+    for font, scans in FONTS:
+        out = os.path.join(ROOT, "include", "dash_font%d.h" % font)
+        inputs = [os.path.join(ROOT, p) for p in scans + [DEFINES]]
+        inputs += [os.path.join(HERE, "font_compiler.cpp"), os.path.join(HERE, "subset_fonts.py")]
+        if os.path.exists(out) and os.path.getmtime(out) >= newest(inputs):
+            continue
+
+        tool = tool or build_tool(build_dir)
+        if not tool:
+            if os.path.exists(out):
+                print("subset_fonts: no host C++ compiler, %s may be out of date" % out)
+                continue
+            sys.exit("subset_fonts: no host C++ compiler to make %s, set HOST_CXX" % out)
+
+        # Relative paths keep the command recorded in the header the same on every machine
+        args = [tool, "--name", "dashFont%d" % font, "--out", os.path.relpath(out, ROOT)]
+        if font in defined:
+            args += ["--chars", defined[font]]
+        for p in scans:
+            args += ["--scan", p]
+        subprocess.check_call(args + [str(font)], cwd=ROOT)
+
+
+subset_fonts(BUILD)
@@ -0,0 +1,370 @@
+// Host side of the log export protocol (include/log_protocol.h).
+//
+// Pulls the log from the speedometer over a serial port and writes the raw
+// bytes to a file. If the file already exists the transfer resumes from its
+// current size, so an interrupted download just needs the command re-run.
+//
+//   g++ -O2 -std=c++17 -I../../include log_receiver.cpp ../../src/log_protocol.cpp -o log_receiver
+//
+//   ./log_receiver /dev/ttyUSB0 ride.log [--baud 115200] [--fresh]
+//   ./log_receiver --selftest
+//
+// --selftest runs a simulated device on a local pseudo terminal and checks a
+// full transfer, a resumed transfer and a transfer over a lossy link.
+
+#include "log_protocol.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+static const uint32_t WINDOW = 16 * LOG_CHUNK_SIZE; // bytes in flight
+static const int TIMEOUT_MS = 500;
+static const int MAX_RETRIES = 20;
+static const size_t SIM_UART_ROOM = 64;             // simulated device TX buffer
+
+static speed_t baudConstant(long baud)
+{
+  switch (baud)
+  {
+  case 9600: return B9600;
+  case 19200: return B19200;
+  case 38400: return B38400;
+  case 57600: return B57600;
+  case 115200: return B115200;
+  case 230400: return B230400;
+  case 460800: return B460800;
+  case 921600: return B921600;
+  default: return 0;
+  }
+}
+
+static int openPort(const char *path, long baud)
+{
+  int fd = open(path, O_RDWR | O_NOCTTY);
+  if (fd < 0)
+  {
+    fprintf(stderr, "log_receiver: cannot open %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+
+  termios tio;
+  if (tcgetattr(fd, &tio) == 0)
+  {
+    cfmakeraw(&tio);
+    speed_t speed = baudConstant(baud);
+    if (speed)
+    {
+      cfsetispeed(&tio, speed);
+      cfsetospeed(&tio, speed);
+    }
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+    tcflush(fd, TCIOFLUSH);
+  }
+  return fd;
+}
+
+static bool sendFrame(int fd, uint8_t type, uint32_t a, uint32_t b, size_t payloadLen)
+{
+  uint8_t payload[8];
+  uint8_t wire[LOG_WIRE_MAX];
+  logPut32(payload, a);
+  logPut32(payload + 4, b);
+  size_t n = logBuildFrame(type, payload, payloadLen, wire);
+  return write(fd, wire, n) == (ssize_t)n;
+}
+
+static long nowMs()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// Runs one download, returns 0 on success
+static int receive(int fd, const char *outPath, bool fresh, bool quiet)
+{
+  FILE *out = fopen(outPath, fresh ? "wb" : "ab");
+  if (!out)
+  {
+    fprintf(stderr, "log_receiver: cannot open %s: %s\n", outPath, strerror(errno));
+    return 1;
+  }
+  fseek(out, 0, SEEK_END);
+  uint32_t expected = ftell(out);
+
+  LogFrameReader reader;
+  uint32_t logSize = 0;
+  bool haveInfo = false;
+  uint32_t acked = expected;
+  bool resync = false;
+  int retries = 0;
+  long lastProgress = nowMs();
+
+  sendFrame(fd, LOG_CMD_INFO, 0, 0, 0);
+
+  for (;;)
+  {
+    pollfd pfd = {fd, POLLIN, 0};
+    int ready = poll(&pfd, 1, 50);
+
+    if (ready > 0)
+    {
+      uint8_t buf[256];
+      ssize_t got = read(fd, buf, sizeof(buf));
+      for (ssize_t i = 0; i < got; i++)
+      {
+        size_t len = reader.feed(buf[i]);
+        if (!len)
+          continue;
+        const uint8_t *f = reader.frame();
+        int payload = logCheckFrame(f, len);
+        if (payload < 0)
+          continue; // corrupt, the gap is caught by the offset check
+
+        switch (f[0])
+        {
+        case LOG_RSP_INFO:
+          if (payload < 7 || haveInfo)
+            break;
+          haveInfo = true;
+          logSize = logGet32(f + 1);
+          if (expected > logSize)
+          {
+            fprintf(stderr, "log_receiver: %s holds %u bytes but the log is only %u, use --fresh\n",
+                    outPath, expected, logSize);
+            sendFrame(fd, LOG_CMD_STOP, 0, 0, 0);
+            fclose(out);
+            return 1;
+          }
+          if (!quiet)
+            printf("log size %u bytes, resuming at %u\n", logSize, expected);
+          sendFrame(fd, LOG_CMD_READ, expected, WINDOW, 8);
+          lastProgress = nowMs();
+          break;
+
+        case LOG_RSP_DATA:
+        {
+          if (!haveInfo || payload < 4)
+            break;
+          uint32_t offset = logGet32(f + 1);
+          if (offset != expected)
+          {
+            // A frame was lost: ask once for a restart from the last byte we
+            // hold and ignore the rest of the old stream still in flight
+            if (!resync)
+            {
+              sendFrame(fd, LOG_CMD_READ, expected, WINDOW, 8);
+              acked = expected;
+              resync = true;
+            }
+            break;
+          }
+          resync = false;
+          fwrite(f + 5, 1, payload - 4, out);
+          expected += payload - 4;
+          lastProgress = nowMs();
+          retries = 0;
+          if (expected - acked >= WINDOW / 2)
+          {
+            sendFrame(fd, LOG_CMD_ACK, expected, WINDOW, 8);
+            acked = expected;
+          }
+          break;
+        }
+
+        case LOG_RSP_END:
+          if (haveInfo && expected == logSize)
+          {
+            fclose(out);
+            if (!quiet)
+              printf("received %u bytes\n", expected);
+            return 0;
+          }
+          break;
+
+        case LOG_RSP_ERROR:
+          fprintf(stderr, "log_receiver: device error %u\n", payload > 0 ? f[1] : 0);
+          fclose(out);
+          return 1;
+        }
+      }
+    }
+
+    if (nowMs() - lastProgress > TIMEOUT_MS)
+    {
+      if (++retries > MAX_RETRIES)
+      {
+        fprintf(stderr, "log_receiver: no response, giving up at offset %u\n", expected);
+        fclose(out);
+        return 1;
+      }
+      // Go back to the last byte we hold and start a fresh window
+      if (haveInfo)
+        sendFrame(fd, LOG_CMD_READ, expected, WINDOW, 8);
+      else
+        sendFrame(fd, LOG_CMD_INFO, 0, 0, 0);
+      acked = expected;
+      resync = false;
+      lastProgress = nowMs();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Self test against a simulated device on a pseudo terminal
+//------------------------------------------------------------------------------
+
+static std::vector<uint8_t> simLog;
+
+static uint32_t simSize() { return simLog.size(); }
+
+static void simRead(uint32_t offset, uint8_t *dst, uint16_t len)
+{
+  memcpy(dst, simLog.data() + offset, len);
+}
+
+// Device loop: drains at most a UART-sized buffer per tick like the firmware
+// does, and optionally corrupts every lossEvery'th byte it sends
+static void runDevice(int fd, unsigned lossEvery)
+{
+  static const LogSource source = {simSize, simRead};
+  LogExportSession session(source);
+  unsigned long sent = 0;
+
+  for (;;)
+  {
+    pollfd pfd = {fd, POLLIN, 0};
+    if (poll(&pfd, 1, 1) > 0)
+    {
+      uint8_t buf[64];
+      ssize_t got = read(fd, buf, sizeof(buf));
+      if (got <= 0)
+        _exit(0);
+      for (ssize_t i = 0; i < got; i++)
+        session.receive(buf[i]);
+    }
+
+    uint8_t out[SIM_UART_ROOM];
+    size_t n = session.transmit(out, sizeof(out));
+    for (size_t i = 0; i < n; i++)
+      if (lossEvery && ++sent % lossEvery == 0)
+        out[i] ^= 0x5A;
+    if (n && write(fd, out, n) < 0)
+      _exit(0);
+  }
+}
+
+static bool runCase(const char *name, const char *path, unsigned lossEvery, size_t prefix)
+{
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) || unlockpt(master))
+  {
+    perror("posix_openpt");
+    return false;
+  }
+  std::string slave = ptsname(master);
+
+  termios tio;
+  tcgetattr(master, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(master, TCSANOW, &tio);
+
+  pid_t pid = fork();
+  if (pid == 0)
+    runDevice(master, lossEvery);
+
+  FILE *seed = fopen(path, "wb");
+  fwrite(simLog.data(), 1, prefix, seed);
+  fclose(seed);
+
+  int fd = openPort(slave.c_str(), 0);
+  int rc = fd < 0 ? 1 : receive(fd, path, false, true);
+  if (fd >= 0)
+    close(fd);
+  kill(pid, SIGTERM);
+  waitpid(pid, nullptr, 0);
+  close(master);
+
+  std::vector<uint8_t> got(simLog.size() + 1);
+  FILE *in = fopen(path, "rb");
+  size_t n = fread(got.data(), 1, got.size(), in);
+  fclose(in);
+  bool ok = rc == 0 && n == simLog.size() && memcmp(got.data(), simLog.data(), n) == 0;
+  printf("%-28s %s\n", name, ok ? "ok" : "FAILED");
+  return ok;
+}
+
+static int selfTest()
+{
+  simLog.resize(20000);
+  uint32_t x = 0x12345678;
+  for (auto &b : simLog)
+  {
+    x = x * 1664525 + 1013904223;
+    b = x >> 24; // plenty of zero bytes to exercise COBS
+  }
+
+  char path[] = "/tmp/log_receiver_XXXXXX";
+  int tmp = mkstemp(path);
+  if (tmp < 0)
+    return 1;
+  close(tmp);
+
+  bool ok = runCase("full transfer", path, 0, 0);
+  ok &= runCase("resume from offset", path, 0, 7777);
+  ok &= runCase("lossy link", path, 997, 0);
+  unlink(path);
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc == 2 && !strcmp(argv[1], "--selftest"))
+    return selfTest();
+
+  const char *port = nullptr;
+  const char *outPath = nullptr;
+  long baud = 115200;
+  bool fresh = false;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--baud") && i + 1 < argc)
+      baud = atol(argv[++i]);
+    else if (!strcmp(argv[i], "--fresh"))
+      fresh = true;
+    else if (!port)
+      port = argv[i];
+    else if (!outPath)
+      outPath = argv[i];
+  }
+
+  if (!port || !outPath)
+  {
+    fprintf(stderr, "usage: log_receiver <serial port> <output file> [--baud N] [--fresh]\n"
+                    "       log_receiver --selftest\n");
+    return 2;
+  }
+
+  int fd = openPort(port, baud);
+  if (fd < 0)
+    return 1;
+  int rc = receive(fd, outPath, fresh, false);
+  close(fd);
+  return rc;
+}
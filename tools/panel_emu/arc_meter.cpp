@@ -0,0 +1,53 @@
+// TFT_eArcMeter draws only the section between the old and the new value. Each
+// update of a 240 degree, 20 pixel ring is compared with a full redraw of the new
+// value, and the pixels it wrote are counted against the whole ring.
+//
+//   tools/panel_emu/build.sh arc_meter.cpp
+
+#include <TFT_eSPI.h>
+
+#include "panel_emu.h"
+
+TFT_eSPI tft;
+TFT_eArcMeter meter(&tft), full(&tft);
+
+static uint16_t frame[PanelModel::W * PanelModel::H];
+
+int main()
+{
+  tft.init();
+  tft.setRotation(0);
+  tft.fillScreen(TFT_BLACK);
+
+  for (TFT_eArcMeter *m : { &meter, &full }) {
+    m->setArc(120, 160, 100, 80, 240, 240);
+    m->setRange(0, 180);
+    m->setColors(TFT_GREEN, TFT_DARKGREY, TFT_BLACK);
+  }
+
+  panel.resetCounters();
+  meter.draw(0);
+  printf("first draw %lu pixels\n", panel.pixels);
+
+  const int values[] = { 0, 30, 31, 90, 89, 180, 200, 10, 11, 12, 150, 0, -5, 45 };
+  long bad = 0;
+  for (int v : values) {
+    panel.resetCounters();
+    meter.draw(v);
+    unsigned long pixels = panel.pixels, bytes = panel.cmdBytes + panel.dataBytes, errors = panel.errors;
+    memcpy(frame, panel.fb, sizeof(frame));
+
+    tft.fillScreen(TFT_BLACK);
+    full.invalidate();
+    full.draw(v);
+    int differ = 0;
+    for (int i = 0; i < PanelModel::W * PanelModel::H; i++) differ += frame[i] != panel.fb[i];
+    memcpy(panel.fb, frame, sizeof(frame));
+
+    printf("value %4d: %5lu pixels %6lu bytes, %d differ from a full redraw\n", v, pixels, bytes, differ);
+    bad += differ + errors;
+  }
+
+  printf("%s\n", bad ? "FAILED" : "ok");
+  return bad != 0;
+}
@@ -0,0 +1,90 @@
+// Just enough of the STM32 Arduino core for lib/TFT_eSPI on the host, see panel_emu.h
+
+#pragma once
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+// Flash is ordinary memory, pointers are read at their host size
+#define PROGMEM
+#define pgm_read_byte(a)  (*(const uint8_t *)(a))
+#define pgm_read_word(a)  (*(const uint16_t *)(a))
+#define pgm_read_dword(a) (*(const uintptr_t *)(a))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define FALLING 2
+#define MSBFIRST 1
+#define SPI_MODE0 0
+#define SPI_MODE3 3
+
+// Pins, numbered as their bit in the one GPIO port modelled
+#define PA2 2
+#define PA3 3
+#define A2 2
+#define A3 3
+#define A4 4
+#define PB3 19
+#define PB4 20
+#define PB5 21
+
+#ifndef DEG_TO_RAD
+  #define DEG_TO_RAD 0.017453292519943295769236907684886
+#endif
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// Writes to BSRR set and clear the DC and CS lines of the panel model
+struct BsrrReg { void operator=(uint32_t v); };
+typedef struct { BsrrReg BSRR; volatile uint32_t IDR, ODR, CRL; } GPIO_TypeDef;
+extern GPIO_TypeDef gpiox;
+inline GPIO_TypeDef *digitalPinToPort(int) { return &gpiox; }
+inline uint32_t digitalPinToBitMask(int p) { return 1u << p; }
+
+void pinMode(int, int);
+void digitalWrite(int, int);
+int  digitalRead(int);
+void attachInterrupt(int, void (*)(void), int);
+inline int digitalPinToInterrupt(int p) { return p; }
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long);
+void delayMicroseconds(unsigned);
+void yield();
+
+long random(long);
+long random(long, long);
+inline void randomSeed(unsigned long s) { srand(s); }
+
+template <class T> T constrain(T a, T l, T h) { return a < l ? l : a > h ? h : a; }
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+// The DMA thread runs the interrupt handler under the same lock
+void emuIrqOff();
+void emuIrqOn();
+#define noInterrupts()
+#define interrupts()
+#define __disable_irq()   emuIrqOff()
+#define __enable_irq()    emuIrqOn()
+#define __get_PRIMASK()   0u
+#define __set_PRIMASK(x)  (void)(x)
+
+inline char *ltoa(long v, char *b, int) { sprintf(b, "%d", (int32_t)v); return b; }
+inline char *ultoa(unsigned long v, char *b, int) { sprintf(b, "%u", (uint32_t)v); return b; }
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "stm32_hal.h"
@@ -0,0 +1,32 @@
+#pragma once
+
+#define DEC 10
+#define HEX 16
+
+// As the Arduino Print class: strings reach write(const uint8_t *, size_t) in one call
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *b, size_t n) { size_t r = 0; while (n--) r += write(*b++); return r; }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t write(const char *s, size_t n) { return write((const uint8_t *)s, n); }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int = DEC) { char b[16]; sprintf(b, "%d", v); return write(b); }
+  size_t print(unsigned v, int = DEC) { char b[16]; sprintf(b, "%u", v); return write(b); }
+  size_t print(long v, int = DEC) { char b[24]; sprintf(b, "%ld", v); return write(b); }
+  size_t print(unsigned long v, int = DEC) { char b[24]; sprintf(b, "%lu", v); return write(b); }
+  size_t print(double v, int d = 2) { char b[32]; sprintf(b, "%.*f", d, v); return write(b); }
+
+  template <class T> size_t println(T v) { size_t r = print(v); return r + write("\r\n"); }
+  template <class T> size_t println(T v, int d) { size_t r = print(v, d); return r + write("\r\n"); }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
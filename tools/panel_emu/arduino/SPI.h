@@ -0,0 +1,23 @@
+#pragma once
+#include <Arduino.h>
+
+#define SPI_HAS_TRANSACTION
+
+struct SPISettings { SPISettings(uint32_t, int, int) {} };
+
+// Bytes sent through SPI go to the panel model
+class SPIClass {
+ public:
+  SPIClass() {}
+  SPIClass(int, int, int) {}
+  void begin() {}
+  void end() {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+  void setFrequency(uint32_t) {}
+  uint8_t transfer(uint8_t);
+  void transfer(void *, uint32_t);
+  uint16_t transfer16(uint16_t) { return 0; }
+};
+
+extern SPIClass SPI;
@@ -0,0 +1,22 @@
+#pragma once
+
+class Stream : public Print {
+ public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int peek() { return -1; }
+};
+
+// Serial output goes to stdout
+class HardwareSerial : public Stream {
+ public:
+  HardwareSerial() {}
+  HardwareSerial(int, int) {}
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) { putchar(c); return 1; }
+  using Print::write;
+  int availableForWrite() { return 64; }
+  operator bool() { return true; }
+};
+
+extern HardwareSerial Serial, Serial1, Serial2;
@@ -0,0 +1,26 @@
+#pragma once
+
+// The parts of the Arduino String the library uses
+class String {
+  std::string s;
+
+ public:
+  String() {}
+  String(const char *c) : s(c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(float f, int d) { char b[32]; snprintf(b, sizeof(b), "%.*f", d, f); s = b; }
+  String(double f, int d = 2) { char b[32]; snprintf(b, sizeof(b), "%.*f", d, f); s = b; }
+
+  unsigned length() const { return s.size(); }
+  const char *c_str() const { return s.c_str(); }
+  void toCharArray(char *b, unsigned n) const { strncpy(b, s.c_str(), n); b[n - 1] = 0; }
+  char operator[](unsigned i) const { return s[i]; }
+  bool operator==(const char *o) const { return s == o; }
+  String operator+(const String &o) const { String r; r.s = s + o.s; return r; }
+  friend String operator+(const char *a, const String &b) { String r; r.s = std::string(a) + b.s; return r; }
+};
+
+class __FlashStringHelper;
+#define F(x) (reinterpret_cast<const __FlashStringHelper *>(x))
@@ -0,0 +1,74 @@
+// STM32F1 HAL types, registers and flags used by Processors/TFT_eSPI_STM32.c. The
+// registers are plain memory except SPI DR, whose writes go to the panel model, and
+// DMA1 channel 3, which a thread in panel_emu.cpp runs like the DMA controller
+
+#pragma once
+typedef struct { volatile uint32_t CCR, CNDTR, CPAR, CMAR; } DMA_Channel_TypeDef;
+typedef struct { volatile uint32_t ISR, IFCR; } DMA_TypeDef;
+struct SpiDrReg { volatile uint32_t v; void operator=(uint32_t b); operator uint32_t() const { return v; } };
+typedef struct { volatile uint32_t CR1, CR2, SR; SpiDrReg DR; } SPI_TypeDef;
+typedef struct { volatile uint32_t SR, DR, BRR, CR1, CR2, CR3; } USART_TypeDef;
+extern DMA_Channel_TypeDef *DMA1_Channel2, *DMA1_Channel3, *DMA1_Channel5, *DMA1_Channel4, *DMA1_Channel7;
+extern DMA_TypeDef *DMA1; extern SPI_TypeDef *SPI1, *SPI2; extern USART_TypeDef *USART1, *USART2, *USART3;
+typedef enum {HAL_OK=0} HAL_StatusTypeDef;
+typedef enum {HAL_SPI_STATE_READY, HAL_SPI_STATE_BUSY_TX} HAL_SPI_StateTypeDef;
+typedef struct { uint32_t Mode, Direction, PeriphInc, PeriphDataAlignment, MemInc, MemDataAlignment, Priority, Channel; } DMA_InitTypeDef;
+typedef struct __DMA { DMA_Channel_TypeDef* Instance; DMA_InitTypeDef Init; void* Parent; void (*XferCpltCallback)(struct __DMA*); } DMA_HandleTypeDef;
+typedef struct __SPI { SPI_TypeDef* Instance; volatile HAL_SPI_StateTypeDef State; DMA_HandleTypeDef* hdmatx; void (*TxCpltCallback)(struct __SPI*); } SPI_HandleTypeDef;
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef*, uint8_t*, uint16_t, uint32_t);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef*, uint8_t*, uint16_t);
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef*); HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef*);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef*);
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef*, uint32_t, uint32_t, uint32_t);
+#define HAL_MAX_DELAY 0xFFFFFFFFu
+#define __HAL_RCC_DMA1_CLK_ENABLE()
+#define __HAL_LINKDMA(a,b,c) do{(a)->b=&(c);(c).Parent=(a);}while(0)
+#define DMA_NORMAL 0
+#define DMA_MEMORY_TO_PERIPH 0x10
+#define DMA_PINC_DISABLE 0
+#define DMA_PDATAALIGN_BYTE 0
+#define DMA_PDATAALIGN_HALFWORD 0x100
+#define DMA_MINC_ENABLE 0x80
+#define DMA_MINC_DISABLE 0
+#define DMA_MDATAALIGN_BYTE 0
+#define DMA_MDATAALIGN_HALFWORD 0x400
+#define DMA_PRIORITY_LOW 0
+#define DMA1_Channel3_IRQn 13
+#define DMA1_Channel5_IRQn 15
+#define DMA1_Channel7_IRQn 17
+void HAL_NVIC_SetPriority(int,int,int); void HAL_NVIC_EnableIRQ(int); void HAL_NVIC_DisableIRQ(int);
+#define DMA_CCR_EN 1u
+#define DMA_CCR_TCIE 2u
+#define DMA_CCR_MINC 0x80u
+#define DMA_CCR_DIR 0x10u
+#define DMA_CCR_PSIZE_0 0x100u
+#define DMA_CCR_MSIZE_0 0x400u
+#define DMA_CCR_PL_0 0x1000u
+#define DMA_ISR_TCIF7 (1u<<25)
+#define DMA_IFCR_CGIF7 (1u<<24)
+#define DMA_ISR_TCIF3 (1u<<9)
+#define DMA_IFCR_CGIF3 (1u<<8)
+#define DMA_ISR_TCIF5 (1u<<17)
+#define DMA_IFCR_CGIF5 (1u<<16)
+#define USART_CR3_DMAT 0x80u
+#define USART_SR_TC 0x40u
+#define SPI_CR2_TXDMAEN 2u
+#define SPI_SR_BSY 0x80u
+#define SPI_SR_TXE 2u
+#define SPI_CR1_DFF 0x800u
+#define SPI_CR1_SPE 0x40u
+#define __HAL_SPI_ENABLE(h) ((h)->Instance->CR1 |= SPI_CR1_SPE)
+#define __DSB()
+#define __WFI()
+typedef int PinName;
+#define DMA_ISR_TCIF2 (1u<<5)
+#define DMA_IFCR_CGIF2 (1u<<4)
+#define PB10 26
+#define PB11 27
+#define DMA_CCR_HTIE 4u
+#define DMA_CCR_TEIE 8u
+#define DMA_CCR_PSIZE 0x300u
+#define DMA_CCR_MSIZE 0xC00u
+#define __HAL_DMA_GET_GI_FLAG_INDEX(h) DMA_IFCR_CGIF3
+#define __HAL_DMA_CLEAR_FLAG(h, f) (DMA1->IFCR = (f), DMA1->ISR &= ~(f))
+#define __HAL_SPI_CLEAR_OVRFLAG(h) do { (void)(h)->Instance->DR; (void)(h)->Instance->SR; } while (0)
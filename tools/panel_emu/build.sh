@@ -0,0 +1,28 @@
+#!/bin/sh
+# Builds a check against lib/TFT_eSPI with the panel model and runs it:
+#
+#   tools/panel_emu/build.sh arc_meter.cpp [extra g++ flags, e.g. -DTFT_NO_WINDOW_CACHE]
+#
+# The library is copied to $BUILD (default /tmp/panel_emu) first. Its RLE font code
+# keeps flash addresses in uint32_t, which is widened there to hold host pointers.
+# SAN=-fsanitize=address adds AddressSanitizer, but not for checks that send heap
+# buffers by DMA: ASan puts the heap above the 4 GB a 32 bit CMAR can address.
+# A check exits non-zero if anything it compares differs or the model saw a bus error.
+
+set -e
+HERE=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(cd "$HERE/../.." && pwd)
+BUILD=${BUILD:-/tmp/panel_emu}
+CHECK=$1
+shift
+
+rm -rf "$BUILD/TFT_eSPI"
+mkdir -p "$BUILD"
+cp -r "$ROOT/lib/TFT_eSPI" "$BUILD/TFT_eSPI"
+sed -i "s/uint32_t flash_address/uintptr_t flash_address/" "$BUILD/TFT_eSPI/TFT_eSPI.cpp" "$BUILD/TFT_eSPI/Extensions/Sprite.cpp"
+
+OUT="$BUILD/$(basename "$CHECK" .cpp)"
+g++ -std=gnu++17 -O1 -g -w -fpermissive -no-pie -pthread $SAN -DSTM32F1xx "$@" \
+    -I"$HERE/arduino" -I"$HERE" -I"$BUILD/TFT_eSPI" -I"$ROOT/include" \
+    "$HERE/panel_emu.cpp" "$HERE/$CHECK" "$BUILD/TFT_eSPI/TFT_eSPI.cpp" -o "$OUT"
+"$OUT"
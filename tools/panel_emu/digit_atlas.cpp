@@ -0,0 +1,90 @@
+// TFT_eDigitAtlas against drawString(). Each font is rasterised into an atlas and a
+// few strings are drawn both ways: whole, clipped at the screen edges and inside two
+// viewports. Pixels, widths and font height must match. The atlas RAM and the bus
+// bytes and windows of both ways are printed.
+//
+//   tools/panel_emu/build.sh digit_atlas.cpp
+
+#include <TFT_eSPI.h>
+
+#include "panel_emu.h"
+#include "dash_font4.h"
+#include "dash_font6.h"
+#include "dash_font8.h"
+
+TFT_eSPI tft;
+TFT_eDigitAtlas atlas(&tft);
+
+static uint64_t scene(bool useAtlas, uint8_t font, uint8_t size, const char *s, int *width)
+{
+  tft.fillScreen(TFT_NAVY);
+  tft.setTextSize(size);
+
+  const int xs[] = { 3, -20, 250 }, ys[] = { 5, 100, 290 };
+  for (int k = 0; k < 3; k++) {
+    int w = useAtlas ? atlas.drawString(s, xs[k], ys[k]) : tft.drawString(s, xs[k], ys[k], font);
+    if (k == 0) *width = w;
+  }
+
+  for (int datum = 0; datum < 2; datum++) {
+    tft.setViewport(40, 200, 150, 60, datum);
+    if (useAtlas) atlas.drawString(s, 10, 10);
+    else tft.drawString(s, 10, 10, font);
+    tft.resetViewport();
+  }
+
+  tft.setTextSize(1);
+  return panel.hash();
+}
+
+int main()
+{
+  tft.init();
+  tft.setRotation(0);
+
+  // Font 8 from its RLE tables when they are compiled in, then the dashboard's span fonts
+  struct { uint8_t font; const tftSpanFont *sf; const char *chars, *text; } cases[] = {
+    { 8, nullptr,    "0123456789.:",       "12:3.4 5" },
+    { 8, &dashFont8, " 0123456789",        " 9 87" },
+    { 6, &dashFont6, "0123456789",         "0123456789" },
+    { 4, &dashFont4, "0123456789:,.- nan", "12:34, nan-" },
+    { 2, nullptr,    "0123456789.:",       "1.2:3 ab" },
+    { 1, nullptr,    "0123456789",         "907 x" },
+    { 7, nullptr,    "0123456789.:",       "12.:9" },
+  };
+
+  long bad = 0;
+  for (auto &c : cases) {
+    tft.setSpanFont(c.font, c.sf);
+    if (!c.sf && c.font > 1 && !(tft.fontsLoaded() & (1 << c.font))) continue;
+
+    for (int size = 1; size <= 2; size++) for (int opaque = 0; opaque < 2; opaque++) {
+      if (!atlas.createAtlas(c.font, size, c.chars)) {
+        printf("font %d size %d: no atlas\n", c.font, size);
+        bad++;
+        continue;
+      }
+      if (opaque) tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+      else tft.setTextColor(TFT_YELLOW);
+
+      int wa, wt;
+      panel.resetCounters();
+      uint64_t ha = scene(true, c.font, size, c.text, &wa);
+      unsigned long ba = panel.cmdBytes + panel.dataBytes, ra = panel.ramwr, ea = panel.errors;
+      panel.resetCounters();
+      uint64_t ht = scene(false, c.font, size, c.text, &wt);
+      unsigned long bt = panel.cmdBytes + panel.dataBytes, rt = panel.ramwr, et = panel.errors;
+
+      bool same = ha == ht && wa == wt && atlas.textWidth(c.text) == wt &&
+                  atlas.fontHeight() == tft.fontHeight(c.font) * size && !ea && !et;
+      bad += !same;
+      printf("font %d%s size %d %s: %s, atlas %u bytes, bus %lu/%lu bytes, %lu/%lu windows\n", c.font,
+             c.sf ? " span" : "", size, opaque ? "opaque" : "transp", same ? "same" : "DIFFERENT",
+             atlas.atlasBytes(), ba, bt, ra, rt);
+    }
+    tft.setSpanFont(c.font, nullptr);
+  }
+
+  printf("%s\n", bad ? "FAILED" : "ok");
+  return bad != 0;
+}
@@ -0,0 +1,191 @@
+// Panel model and the Arduino, HAL and register stubs behind it, see panel_emu.h
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#include "panel_emu.h"
+
+PanelModel panel;
+unsigned long busCalls = 0;
+unsigned long csRises = 0;
+
+GPIO_TypeDef gpiox;
+SPIClass SPI;
+HardwareSerial Serial, Serial1, Serial2;
+
+static DMA_Channel_TypeDef ch[8];
+static DMA_TypeDef dma1;
+static SPI_TypeDef spi1, spi2;
+static USART_TypeDef u1, u2, u3;
+DMA_Channel_TypeDef *DMA1_Channel2 = &ch[2], *DMA1_Channel3 = &ch[3], *DMA1_Channel4 = &ch[4],
+                    *DMA1_Channel5 = &ch[5], *DMA1_Channel7 = &ch[7];
+DMA_TypeDef *DMA1 = &dma1;
+SPI_TypeDef *SPI1 = &spi1, *SPI2 = &spi2;
+USART_TypeDef *USART1 = &u1, *USART2 = &u2, *USART3 = &u3;
+
+// Pin numbers of TFT_DC and TFT_CS in User_Setup.h, as GPIO bits
+static const uint32_t DC_BIT = 1 << 3, CS_BIT = 1 << 4;
+
+void BsrrReg::operator=(uint32_t v)
+{
+  if (v & DC_BIT) { if (!panel.dc) panel.dcToggles++; panel.dc = true; }
+  if (v & (DC_BIT << 16)) { if (panel.dc) panel.dcToggles++; panel.dc = false; }
+  if (v & CS_BIT) { if (!panel.cs) csRises++; panel.cs = true; }
+  if (v & (CS_BIT << 16)) panel.cs = false;
+}
+
+void PanelModel::byte(uint8_t b)
+{
+  totalBytes++;
+  if (cs) { errors++; return; }
+
+  if (!dc) {
+    cmdBytes++;
+    cmd = b;
+    param = 0;
+    hiByte = true;
+    if (b == 0x2C) { ramwr++; px = xs; py = ys; }
+    return;
+  }
+
+  dataBytes++;
+  if (cmd == 0x2A || cmd == 0x2B) { // CASET, PASET
+    if (param < 4) pb[param] = b;
+    if (++param == 4) {
+      int s = pb[0] << 8 | pb[1], e = pb[2] << 8 | pb[3];
+      if (cmd == 0x2A) { xs = s; xe = e; caset++; }
+      else { ys = s; ye = e; paset++; }
+    }
+    return;
+  }
+
+  if (cmd == 0x2C || cmd == 0x3C) { // RAMWR, RAMWR continue
+    if (hiByte) { hi = b; hiByte = false; return; }
+    hiByte = true;
+    if (px >= 0 && px < W && py >= 0 && py < H && py <= ye) fb[py * W + px] = hi << 8 | b;
+    else errors++;
+    pixels++;
+    if (++px > xe) { px = xs; py++; }
+  }
+}
+
+void SpiDrReg::operator=(uint32_t b)
+{
+  v = b;
+  if (spi1.CR1 & SPI_CR1_DFF) { panel.byte(b >> 8); panel.byte(b); }
+  else panel.byte(b);
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *, uint8_t *d, uint16_t n, uint32_t)
+{
+  busCalls++;
+  while (n--) panel.byte(*d++);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *, uint8_t *d, uint16_t n)
+{
+  while (n--) panel.byte(*d++);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *) { return HAL_OK; }
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *) { return HAL_OK; }
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *, uint32_t, uint32_t, uint32_t) { return HAL_OK; }
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *) {}
+void HAL_NVIC_SetPriority(int, int, int) {}
+void HAL_NVIC_EnableIRQ(int) {}
+void HAL_NVIC_DisableIRQ(int) {}
+
+uint8_t SPIClass::transfer(uint8_t b) { busCalls++; panel.byte(b); return 0; }
+void SPIClass::transfer(void *d, uint32_t n) { uint8_t *p = (uint8_t *)d; while (n--) panel.byte(*p++); }
+
+void pinMode(int, int) {}
+void digitalWrite(int, int) {}
+int digitalRead(int) { return 1; }
+
+// Time is the SPI bus time at 36 MHz, nothing else is modelled
+unsigned long micros() { return panel.totalBytes * 8 / 36; }
+unsigned long millis() { return micros() / 1000; }
+void delay(unsigned long) {}
+void delayMicroseconds(unsigned) {}
+void yield() {}
+
+long random(long m) { return rand() % m; }
+long random(long a, long b) { return a + rand() % (b - a); }
+
+size_t Print::printf(const char *format, ...)
+{
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  return write((const uint8_t *)buf, n);
+}
+
+// The DMA1 channel 3 end of transfer interrupt is called with this held, as
+// __disable_irq() holds it in the library
+static std::recursive_mutex irqLock;
+void emuIrqOff() { irqLock.lock(); }
+void emuIrqOn() { irqLock.unlock(); }
+
+extern "C" void DMA1_Channel3_IRQHandler();
+
+// Runs an enabled channel 3 transfer to SPI1 as the DMA controller would, after
+// letting the CPU side carry on for a while. CMAR is 32 bits, so the buffers sent
+// by DMA must be static: build.sh links with -no-pie to keep them in the low 4 GB
+static std::atomic<bool> dmaStop{false};
+
+static void dmaThread()
+{
+  while (!dmaStop) {
+    DMA_Channel_TypeDef &c = ch[3];
+    if (!(c.CCR & DMA_CCR_EN) || !(c.CCR & DMA_CCR_TCIE) || !c.CNDTR || !(spi1.CR2 & SPI_CR2_TXDMAEN)) continue;
+
+    usleep(100);
+    uint32_t n = c.CNDTR;
+    const uint8_t *p = (const uint8_t *)(uintptr_t)c.CMAR;
+    bool inc = c.CCR & DMA_CCR_MINC;
+    if (c.CCR & DMA_CCR_MSIZE_0) {
+      for (uint32_t i = 0; i < n; i++) {
+        uint16_t v = ((const uint16_t *)p)[inc ? i : 0];
+        panel.byte(v >> 8);
+        panel.byte(v);
+      }
+    }
+    else for (uint32_t i = 0; i < n; i++) panel.byte(p[inc ? i : 0]);
+
+    c.CNDTR = 0;
+    dma1.ISR |= DMA_ISR_TCIF3;
+    irqLock.lock();
+    DMA1_Channel3_IRQHandler();
+    irqLock.unlock();
+  }
+}
+
+static struct DmaStart {
+  std::thread t;
+  DmaStart() { spi1.SR = SPI_SR_TXE; t = std::thread(dmaThread); }
+  ~DmaStart() { dmaStop = true; t.join(); }
+} dmaStart;
+
+// FB=file writes the final frame buffer, W x H little endian RGB565, on exit
+static struct FbDump {
+  ~FbDump()
+  {
+    const char *name = getenv("FB");
+    if (!name) return;
+    FILE *f = fopen(name, "wb");
+    if (!f) return;
+    fwrite(panel.fb, 2, PanelModel::W * PanelModel::H, f);
+    fclose(f);
+  }
+} fbDump;
@@ -0,0 +1,46 @@
+// Host model of the ILI9341 panel on the STM32F103 SPI bus, for checking TFT_eSPI
+// drawing on a PC.
+//
+// lib/TFT_eSPI is compiled for STM32F1xx against the stubs in arduino/. The bus
+// macros of Processors/TFT_eSPI_STM32.h write GPIO and SPI registers that are C++
+// objects here, so every byte reaches PanelModel::byte() with the chip select and
+// data/command lines as they would be on the board. CASET, PASET and RAMWR are
+// decoded into a frame buffer and the bytes, windows and deselects are counted.
+// DMA1 channel 3 transfers run on a thread, so the DMA queue sees real concurrency.
+//
+// What is compared is pixels and bus traffic, not time. The counts are the figures
+// quoted for TFT_eSPI changes in the git log; CPU time on the STM32 is not modelled.
+// See build.sh for how a check is built and run.
+
+#pragma once
+#include <stdint.h>
+
+struct PanelModel {
+  static const int W = 320, H = 320;
+  uint16_t fb[W * H];
+  bool dc = true, cs = true;
+  uint8_t cmd = 0; int param = 0; uint8_t pb[4];
+  int xs = 0, xe = W - 1, ys = 0, ye = H - 1, px = 0, py = 0;
+  bool hiByte = true; uint8_t hi = 0;
+  unsigned long long totalBytes = 0;
+  unsigned long cmdBytes = 0, dataBytes = 0, caset = 0, paset = 0, ramwr = 0, pixels = 0, dcToggles = 0;
+  unsigned long errors = 0; // Bytes sent with CS high, pixels outside the window or frame
+
+  void byte(uint8_t b);
+  void resetCounters() { cmdBytes = dataBytes = caset = paset = ramwr = pixels = errors = dcToggles = 0; }
+
+  // FNV-1a of the frame buffer, equal hashes are taken as equal frames
+  uint64_t hash() const
+  {
+    uint64_t h = 1469598103934665603ull;
+    for (int i = 0; i < W * H; i++) { h ^= fb[i]; h *= 1099511628211ull; }
+    return h;
+  }
+
+  // Bus time in microseconds at the given SPI clock
+  double busUs(double hz = 36e6) const { return (cmdBytes + dataBytes) * 8 / hz * 1e6; }
+};
+
+extern PanelModel panel;
+extern unsigned long busCalls; // HAL_SPI_Transmit() and SPI.transfer() calls
+extern unsigned long csRises;  // Chip select deselects
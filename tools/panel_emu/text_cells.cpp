@@ -0,0 +1,136 @@
+// Opaque free font text, which drawString() sends one glyph cell per window.
+//
+// - 3000 random strings of glyphs that overhang their cells, in free fonts
+//   including oblique and italic ones, at sizes 1 and 2. Each is drawn opaque and
+//   transparent on a cleared screen, and no ink of the transparent text may be
+//   missing from the opaque one.
+// - "123 km/h" in FreeSansBold24: bus bytes and windows, and the same pixels as
+//   filling the text box and drawing the text transparent over it.
+// - The same strings drawn into a Sprite, which fills its text box once, and
+//   into a viewport of the same size on the TFT, clipped at both edges.
+//
+//   tools/panel_emu/build.sh text_cells.cpp
+
+#include <TFT_eSPI.h>
+
+#include "panel_emu.h"
+#include "Free_Fonts.h"
+
+TFT_eSPI tft;
+TFT_eSprite spr(&tft);
+
+static uint16_t frame[PanelModel::W * PanelModel::H];
+
+static long overhangs()
+{
+  const GFXfont *fonts[] = { FSS9, FSSB24, FSSO18, FSBI24, FMO12, FSS12, FSI24, FSSBO24 };
+  const char *set = "fjiTlAVWy.,'|/_ 1ffl";
+  const int n = 3000;
+  long bad = 0;
+
+  srand(4);
+  for (int k = 0; k < n; k++) {
+    char s[8];
+    int len = 1 + rand() % 6;
+    for (int i = 0; i < len; i++) s[i] = set[rand() % 20];
+    s[len] = 0;
+    tft.setFreeFont(fonts[rand() % 8]);
+    tft.setTextSize(1 + rand() % 2);
+    int x = 20 + rand() % 60, y = 100;
+
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_WHITE);
+    tft.drawString(s, x, y);
+    memcpy(frame, panel.fb, sizeof(frame));
+
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_WHITE, TFT_BLUE);
+    tft.drawString(s, x, y);
+
+    int missing = 0;
+    for (int i = 0; i < PanelModel::W * PanelModel::H; i++) missing += frame[i] && panel.fb[i] != frame[i];
+    if (missing && bad++ < 5) printf("'%s' loses %d ink pixels\n", s, missing);
+  }
+
+  printf("overhanging glyphs: %ld of %d strings lose ink\n", bad, n);
+  return bad;
+}
+
+static long speedText()
+{
+  tft.setFreeFont(FSSB24);
+  tft.setTextSize(1);
+
+  // The text box as drawString() fills it, then the glyphs over it
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextColor(TFT_WHITE);
+  tftRect box = { 0, 0, 0, 0 };
+  tft.redrawString("123 km/h", 10, 100, 1, &box); // Transparent, only records the box
+  tft.fillScreen(TFT_BLACK);
+  tft.fillRect(box.x, box.y, box.w, box.h, TFT_BLUE);
+  tft.drawString("123 km/h", 10, 100);
+  uint64_t filled = panel.hash();
+
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextColor(TFT_WHITE, TFT_BLUE);
+  panel.resetCounters();
+  tft.drawString("123 km/h", 10, 100);
+
+  bool same = panel.hash() == filled;
+  printf("\"123 km/h\" FreeSansBold24 opaque: %lu bytes in %lu windows, %s\n", panel.cmdBytes + panel.dataBytes,
+         panel.ramwr, same ? "same pixels as fill and draw" : "DIFFERENT from fill and draw");
+  return !same + panel.errors;
+}
+
+static void sprScene(TFT_eSPI &t)
+{
+  t.drawString("fj_Wy{}|A 12.5", 4, 10);
+  t.drawString("__x__", 250, 100);
+  t.drawString("Tfy", -10, 150);
+}
+
+static long spriteText()
+{
+  const GFXfont *fonts[] = { FSS12, FSBI12, FMO9, FSSB18 };
+  long bad = 0;
+
+  tft.setRotation(1);
+  spr.createSprite(300, 200);
+  for (const GFXfont *f : fonts) for (int size = 1; size <= 2; size++) {
+    spr.fillSprite(TFT_NAVY);
+    spr.setFreeFont(f);
+    spr.setTextSize(size);
+    spr.setTextColor(TFT_YELLOW, TFT_RED);
+    sprScene(spr);
+    tft.fillScreen(TFT_BLACK);
+    spr.pushSprite(0, 0);
+    memcpy(frame, panel.fb, sizeof(frame));
+
+    tft.fillScreen(TFT_BLACK);
+    tft.setViewport(0, 0, 300, 200);
+    tft.fillScreen(TFT_NAVY);
+    tft.setFreeFont(f);
+    tft.setTextSize(size);
+    tft.setTextColor(TFT_YELLOW, TFT_RED);
+    sprScene(tft);
+    tft.resetViewport();
+
+    bad += memcmp(frame, panel.fb, sizeof(frame)) != 0;
+  }
+  spr.deleteSprite();
+  tft.setRotation(0);
+
+  printf("Sprite text: %ld of 8 font and size pairs differ from the TFT\n", bad);
+  return bad;
+}
+
+int main()
+{
+  tft.init();
+  tft.setRotation(0);
+
+  long bad = overhangs() + speedText() + spriteText() + panel.errors;
+
+  printf("%s\n", bad ? "FAILED" : "ok");
+  return bad != 0;
+}
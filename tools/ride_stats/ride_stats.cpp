@@ -0,0 +1,864 @@
+// Ride log analytics for files exported with tools/log_receiver.
+//
+// Log files are memory mapped and only the blocks inside the requested date
+// range are touched, found by a binary search of each file's block index.
+// Varint columns are decoded with SIMD: AVX2 takes runs of single byte values,
+// which is nearly every altitude delta, and SSSE3 shuffles take mixed runs of
+// one and two byte values, which covers the speed and distance columns.
+//
+//   g++ -O2 -std=c++17 -I../../include ride_stats.cpp ../../src/log_protocol.cpp -o ride_stats
+//
+//   ./ride_stats [--from YYYY-MM-DD] [--to YYYY-MM-DD] [--csv out.csv|-]
+//                [--columns prefix] [--scalar] log...
+//   ./ride_stats --generate out.rlog [--days N]
+//
+// The report covers trips, a speed histogram, climbs and idle segments.
+// --csv streams every sample as a row, --columns writes one little endian
+// binary file per field (prefix.time.u32, prefix.speed.i32, ...).
+
+#include "ride_log_format.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RIDE_X86
+#endif
+
+static const uint32_t TRIP_GAP_S = 600;       // a longer pause starts a new trip
+static const uint32_t IDLE_MIN_MS = 60000;    // shortest idle segment reported
+static const int32_t CLIMB_MIN_DM = 100;      // shortest climb reported, 10 m
+static const int32_t CLIMB_END_DROP_DM = 30;  // descent that ends a climb
+static const int HIST_BINS = 100;             // 1 km/h bins
+
+//------------------------------------------------------------------------------
+// Column decoders
+//------------------------------------------------------------------------------
+
+// Decodes n varints into out. With delta set the values are zigzag deltas and
+// out receives the running sum. Returns the end of the column or nullptr if
+// the data runs past end.
+typedef const uint8_t *(*ColumnDecoder)(const uint8_t *p, const uint8_t *end,
+                                          int32_t *out, size_t n, bool delta);
+
+static inline const uint8_t *decodeOne(const uint8_t *p, const uint8_t *end, uint32_t &v)
+{
+  v = 0;
+  for (int shift = 0; shift < 35 && p < end; shift += 7)
+  {
+    uint8_t b = *p++;
+    v |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80))
+      return p;
+  }
+  return nullptr;
+}
+
+static const uint8_t *decodeScalar(const uint8_t *p, const uint8_t *end,
+                                   int32_t *out, size_t n, bool delta)
+{
+  int32_t acc = 0;
+  for (size_t i = 0; i < n; i++)
+  {
+    uint32_t v;
+    if (!(p = decodeOne(p, end, v)))
+      return nullptr;
+    if (delta)
+      out[i] = acc += rideUnzigzag(v);
+    else
+      out[i] = v;
+  }
+  return p;
+}
+
+#ifdef RIDE_X86
+
+// Four lane inclusive prefix sum plus the carry from earlier lanes
+static inline __m128i prefix4(__m128i v, __m128i carry)
+{
+  v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+  v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+  return _mm_add_epi32(v, carry);
+}
+
+static inline __m128i unzigzag4(__m128i v)
+{
+  __m128i sign = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, _mm_set1_epi32(1)));
+  return _mm_xor_si128(_mm_srli_epi32(v, 1), sign);
+}
+
+static const uint8_t *decodeSSE2(const uint8_t *p, const uint8_t *end,
+                                 int32_t *out, size_t n, bool delta)
+{
+  const __m128i zero = _mm_setzero_si128();
+  __m128i carry = zero;
+  int32_t acc = 0;
+  size_t i = 0;
+
+  while (i < n)
+  {
+    // Sixteen single byte varints in a row: no continuation bits set
+    if (n - i >= 16 && end - p >= 16)
+    {
+      __m128i bytes = _mm_loadu_si128((const __m128i *)p);
+      if (_mm_movemask_epi8(bytes) == 0)
+      {
+        __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        __m128i v[4] = {_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+                        _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero)};
+        for (int k = 0; k < 4; k++)
+        {
+          if (delta)
+          {
+            v[k] = prefix4(unzigzag4(v[k]), carry);
+            carry = _mm_shuffle_epi32(v[k], 0xFF);
+          }
+          _mm_storeu_si128((__m128i *)(out + i + 4 * k), v[k]);
+        }
+        p += 16;
+        i += 16;
+        continue;
+      }
+    }
+
+    uint32_t v;
+    if (!(p = decodeOne(p, end, v)))
+      return nullptr;
+    if (delta)
+    {
+      acc = _mm_cvtsi128_si32(carry) + rideUnzigzag(v);
+      carry = _mm_set1_epi32(acc);
+      out[i++] = acc;
+    }
+    else
+      out[i++] = v;
+  }
+  return p;
+}
+
+// Mixed one and two byte varints. Real speed deltas at 1 Hz run to a few
+// km/h a second, several hundred in 0.01 km/h, and distances are a few
+// hundred cm, so those columns are mostly two byte values. For every pattern
+// of continuation bits in the next 12 bytes the table holds the pshufb mask
+// that moves up to eight whole one or two byte varints into 16 bit lanes,
+// how many there are and how many bytes they take. Patterns starting with a
+// longer varint have no entry and go through decodeOne().
+struct PairTable
+{
+  uint8_t shuffle[4096][16];
+  uint8_t count[4096];
+  uint8_t bytes[4096];
+
+  PairTable()
+  {
+    for (int m = 0; m < 4096; m++)
+    {
+      int pos = 0, k = 0;
+      memset(shuffle[m], 0x80, 16); // pshufb writes zero for these
+      while (k < 8 && pos < 12)
+      {
+        if (!(m >> pos & 1))
+        {
+          shuffle[m][2 * k] = pos;
+          pos += 1;
+        }
+        else if (pos + 1 < 12 && !(m >> (pos + 1) & 1))
+        {
+          shuffle[m][2 * k] = pos;
+          shuffle[m][2 * k + 1] = pos + 1;
+          pos += 2;
+        }
+        else
+          break;
+        k++;
+      }
+      count[m] = k;
+      bytes[m] = pos;
+    }
+  }
+};
+
+static const PairTable pairTable;
+
+// Decodes the next run of one and two byte varints into out[i..i + 8), lanes
+// past the run come out as zero so they leave the delta carry unchanged.
+// Needs 16 readable bytes at p and room for 8 values, returns false when the
+// next varint is longer than two bytes.
+__attribute__((target("ssse3")))
+static inline bool decodePairs(const uint8_t *&p, int32_t *out, size_t &i, bool delta, __m128i &carry)
+{
+  __m128i bytes = _mm_loadu_si128((const __m128i *)p);
+  unsigned m = _mm_movemask_epi8(bytes) & 0xFFF;
+  if (!pairTable.count[m])
+    return false;
+
+  // Lane j holds (second byte << 8) | first byte, fold out the continuation bit
+  __m128i x = _mm_shuffle_epi8(bytes, _mm_loadu_si128((const __m128i *)pairTable.shuffle[m]));
+  x = _mm_or_si128(_mm_and_si128(x, _mm_set1_epi16(0x007F)),
+                   _mm_and_si128(_mm_srli_epi16(x, 1), _mm_set1_epi16(0x3F80)));
+  __m128i lo = _mm_unpacklo_epi16(x, _mm_setzero_si128());
+  __m128i hi = _mm_unpackhi_epi16(x, _mm_setzero_si128());
+  if (delta)
+  {
+    lo = prefix4(unzigzag4(lo), carry);
+    hi = prefix4(unzigzag4(hi), _mm_shuffle_epi32(lo, 0xFF));
+    carry = _mm_shuffle_epi32(hi, 0xFF);
+  }
+  _mm_storeu_si128((__m128i *)(out + i), lo);
+  _mm_storeu_si128((__m128i *)(out + i + 4), hi);
+  p += pairTable.bytes[m];
+  i += pairTable.count[m];
+  return true;
+}
+
+__attribute__((target("ssse3")))
+static const uint8_t *decodeSSSE3(const uint8_t *p, const uint8_t *end,
+                                  int32_t *out, size_t n, bool delta)
+{
+  __m128i carry = _mm_setzero_si128();
+  size_t i = 0;
+
+  while (i < n)
+  {
+    if (n - i >= 8 && end - p >= 16 && decodePairs(p, out, i, delta, carry))
+      continue;
+
+    uint32_t v;
+    if (!(p = decodeOne(p, end, v)))
+      return nullptr;
+    if (delta)
+    {
+      int32_t acc = _mm_cvtsi128_si32(carry) + rideUnzigzag(v);
+      carry = _mm_set1_epi32(acc);
+      out[i++] = acc;
+    }
+    else
+      out[i++] = v;
+  }
+  return p;
+}
+
+__attribute__((target("avx2")))
+static const uint8_t *decodeAVX2(const uint8_t *p, const uint8_t *end,
+                                 int32_t *out, size_t n, bool delta)
+{
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i lastLane = _mm256_set1_epi32(7);
+  const __m256i halfCarry = _mm256_setr_epi32(3, 3, 3, 3, 3, 3, 3, 3);
+  const __m256i upperMask = _mm256_setr_epi32(0, 0, 0, 0, -1, -1, -1, -1);
+  __m256i carry = _mm256_setzero_si256();
+  size_t i = 0;
+
+  while (i < n)
+  {
+    if (n - i >= 32 && end - p >= 32)
+    {
+      __m256i bytes = _mm256_loadu_si256((const __m256i *)p);
+      if (_mm256_movemask_epi8(bytes) == 0)
+      {
+        for (int k = 0; k < 4; k++)
+        {
+          __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(p + 8 * k)));
+          if (delta)
+          {
+            v = _mm256_xor_si256(_mm256_srli_epi32(v, 1),
+                                 _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(v, one)));
+            // In lane scans, then carry the low half's total into the high half
+            v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+            v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+            v = _mm256_add_epi32(v, _mm256_and_si256(_mm256_permutevar8x32_epi32(v, halfCarry), upperMask));
+            v = _mm256_add_epi32(v, carry);
+            carry = _mm256_permutevar8x32_epi32(v, lastLane);
+          }
+          _mm256_storeu_si256((__m256i *)(out + i + 8 * k), v);
+        }
+        p += 32;
+        i += 32;
+        continue;
+      }
+    }
+
+    if (n - i >= 8 && end - p >= 16)
+    {
+      __m128i c = _mm256_castsi256_si128(carry);
+      if (decodePairs(p, out, i, delta, c))
+      {
+        carry = _mm256_broadcastd_epi32(c);
+        continue;
+      }
+    }
+
+    uint32_t v;
+    if (!(p = decodeOne(p, end, v)))
+      return nullptr;
+    if (delta)
+    {
+      int32_t acc = _mm256_extract_epi32(carry, 0) + rideUnzigzag(v);
+      carry = _mm256_set1_epi32(acc);
+      out[i++] = acc;
+    }
+    else
+      out[i++] = v;
+  }
+  return p;
+}
+
+#endif
+
+static ColumnDecoder pickDecoder(bool scalar, const char **name)
+{
+#ifdef RIDE_X86
+  if (!scalar)
+  {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+      *name = "avx2";
+      return decodeAVX2;
+    }
+    if (__builtin_cpu_supports("ssse3"))
+    {
+      *name = "ssse3";
+      return decodeSSSE3;
+    }
+    *name = "sse2";
+    return decodeSSE2;
+  }
+#endif
+  (void)scalar;
+  *name = "scalar";
+  return decodeScalar;
+}
+
+//------------------------------------------------------------------------------
+// Mapped log files
+//------------------------------------------------------------------------------
+
+struct LogFile
+{
+  std::string path;
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+  const uint8_t *index = nullptr;
+  uint32_t blocks = 0;
+
+  // The mapping is owned, a copy would unmap it twice. The vector of logs only needs
+  // default construction, it is sized once and never grows
+  LogFile() = default;
+  LogFile(const LogFile &) = delete;
+  LogFile &operator=(const LogFile &) = delete;
+
+  ~LogFile()
+  {
+    if (data)
+      munmap((void *)data, size);
+  }
+
+  bool open(const char *name)
+  {
+    path = name;
+    int fd = ::open(name, O_RDONLY);
+    if (fd < 0)
+      return fail(strerror(errno));
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < RIDE_FOOTER_SIZE)
+    {
+      close(fd);
+      return fail("too short");
+    }
+    size = st.st_size;
+    void *m = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (m == MAP_FAILED)
+      return fail(strerror(errno));
+    data = (const uint8_t *)m;
+    madvise(m, size, MADV_RANDOM);
+
+    const uint8_t *footer = data + size - RIDE_FOOTER_SIZE;
+    if (rideGet32(footer) != RIDE_INDEX_MAGIC)
+      return fail("no block index");
+    blocks = rideGet32(footer + 4);
+    uint32_t at = rideGet32(footer + 8);
+    if (at > size - RIDE_FOOTER_SIZE || (size - RIDE_FOOTER_SIZE - at) / RIDE_INDEX_ENTRY_SIZE < blocks)
+      return fail("bad block index");
+    index = data + at;
+    return true;
+  }
+
+  uint32_t blockTime(uint32_t i) const { return rideGet32(index + i * RIDE_INDEX_ENTRY_SIZE); }
+  uint32_t blockOffset(uint32_t i) const { return rideGet32(index + i * RIDE_INDEX_ENTRY_SIZE + 4); }
+
+  // First block that can hold samples at or after t
+  uint32_t seek(uint32_t t) const
+  {
+    uint32_t lo = 0, hi = blocks;
+    while (lo < hi)
+    {
+      uint32_t mid = (lo + hi) / 2;
+      if (blockTime(mid) < t)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo > 0 ? lo - 1 : 0; // the previous block may run past t
+  }
+
+  bool fail(const char *why)
+  {
+    fprintf(stderr, "ride_stats: %s: %s\n", path.c_str(), why);
+    return false;
+  }
+};
+
+//------------------------------------------------------------------------------
+// Analysis
+//------------------------------------------------------------------------------
+
+struct Trip
+{
+  uint64_t startMs = 0, endMs = 0;
+  uint64_t distanceCm = 0;
+  uint64_t movingMs = 0, idleMs = 0;
+  int32_t maxSpeed = 0;
+  int64_t ascentDm = 0;
+};
+
+struct Segment
+{
+  uint64_t startMs, endMs;
+  int32_t value; // climb gain in dm, unused for idle
+};
+
+struct Report
+{
+  std::vector<Trip> trips;
+  std::vector<Segment> climbs, idles;
+  uint64_t histogram[HIST_BINS] = {};
+  uint64_t samples = 0;
+  uint32_t badBlocks = 0;
+
+  // Per sample state
+  bool haveLast = false;
+  uint64_t lastMs = 0;
+  int32_t lastAlt = 0;
+  int32_t climbLow = 0, climbHigh = 0;
+  uint64_t climbLowMs = 0, climbHighMs = 0;
+  bool climbing = false;
+  uint64_t idleStart = 0;
+  bool idle = false;
+
+  void add(uint64_t ms, int32_t speed, int32_t distance, int32_t alt, uint32_t intervalMs)
+  {
+    if (!haveLast || ms - lastMs > TRIP_GAP_S * 1000ull)
+    {
+      closeTrip();
+      trips.emplace_back();
+      trips.back().startMs = ms;
+      climbLow = climbHigh = alt;
+      climbLowMs = climbHighMs = ms;
+      climbing = false;
+      haveLast = true;
+      lastAlt = alt;
+    }
+
+    Trip &trip = trips.back();
+    trip.endMs = ms;
+    trip.distanceCm += distance;
+    trip.maxSpeed = std::max(trip.maxSpeed, speed);
+    samples++;
+
+    // Same drive/idle threshold as calculateDriveTime() in main.cpp
+    bool moving = speed / 100 > 4;
+    if (moving)
+      trip.movingMs += intervalMs;
+    else
+      trip.idleMs += intervalMs;
+
+    histogram[std::min(speed / 100, HIST_BINS - 1)]++;
+
+    if (alt > lastAlt)
+      trip.ascentDm += alt - lastAlt;
+    lastAlt = alt;
+
+    // Climbs: rise from the lowest point until a descent ends it
+    if (!climbing)
+    {
+      if (alt < climbLow)
+      {
+        climbLow = alt;
+        climbLowMs = ms;
+      }
+      if (alt - climbLow >= CLIMB_MIN_DM / 2)
+      {
+        climbing = true;
+        climbHigh = alt;
+        climbHighMs = ms;
+      }
+    }
+    else if (alt > climbHigh)
+    {
+      climbHigh = alt;
+      climbHighMs = ms;
+    }
+    else if (climbHigh - alt >= CLIMB_END_DROP_DM)
+      endClimb(alt, ms);
+
+    if (!moving && !idle)
+    {
+      idle = true;
+      idleStart = ms;
+    }
+    else if (moving && idle)
+      endIdle(ms);
+
+    lastMs = ms;
+  }
+
+  void endClimb(int32_t alt, uint64_t ms)
+  {
+    if (climbing && climbHigh - climbLow >= CLIMB_MIN_DM)
+      climbs.push_back({climbLowMs, climbHighMs, climbHigh - climbLow});
+    climbing = false;
+    climbLow = alt;
+    climbLowMs = ms;
+  }
+
+  void endIdle(uint64_t ms)
+  {
+    if (idle && ms - idleStart >= IDLE_MIN_MS)
+      idles.push_back({idleStart, ms, 0});
+    idle = false;
+  }
+
+  void closeTrip()
+  {
+    if (!haveLast)
+      return;
+    endClimb(lastAlt, lastMs);
+    endIdle(lastMs);
+  }
+};
+
+// Streams the decoded columns of every block in range
+struct Sink
+{
+  FILE *csv = nullptr;
+  FILE *cols[4] = {};
+
+  void write(uint64_t ms, int32_t speed, int32_t distance, int32_t alt)
+  {
+    if (csv)
+      // Sign written on its own so -0.5 m does not come out as 0.5
+      fprintf(csv, "%llu.%03u,%d.%02d,%d,%s%d.%d\n", (unsigned long long)(ms / 1000), (unsigned)(ms % 1000),
+              speed / 100, speed % 100, distance, alt < 0 ? "-" : "", abs(alt / 10), abs(alt % 10));
+    if (cols[0])
+    {
+      uint32_t t = ms / 1000;
+      fwrite(&t, 4, 1, cols[0]);
+      fwrite(&speed, 4, 1, cols[1]);
+      fwrite(&distance, 4, 1, cols[2]);
+      fwrite(&alt, 4, 1, cols[3]);
+    }
+  }
+};
+
+// Blocks that fail their checks are reported and skipped, the index still
+// locates every block after them
+static void scanFile(const LogFile &log, uint32_t from, uint32_t to, ColumnDecoder decode,
+                     Report &report, Sink &sink)
+{
+  int32_t speed[RIDE_BLOCK_MAX_SAMPLES], dist[RIDE_BLOCK_MAX_SAMPLES], alt[RIDE_BLOCK_MAX_SAMPLES];
+
+  for (uint32_t b = log.seek(from); b < log.blocks && log.blockTime(b) <= to; b++)
+  {
+    uint32_t off = log.blockOffset(b);
+    RideBlockHeader h;
+    const char *bad = nullptr;
+    if ((uint64_t)off + RIDE_BLOCK_HEADER_SIZE > log.size || !rideParseHeader(log.data + off, h))
+      bad = "bad header";
+    else if ((uint64_t)off + RIDE_BLOCK_HEADER_SIZE + h.payloadBytes > log.size)
+      bad = "truncated";
+    else if ((uint16_t)logCrc32(log.data + off + RIDE_BLOCK_HEADER_SIZE, h.payloadBytes) != h.crc)
+      bad = "CRC mismatch";
+    else
+    {
+      const uint8_t *p = log.data + off + RIDE_BLOCK_HEADER_SIZE;
+      const uint8_t *end = p + h.payloadBytes;
+      if (!(p = decode(p, end, speed, h.samples, true)) ||
+          !(p = decode(p, end, dist, h.samples, false)) ||
+          !(p = decode(p, end, alt, h.samples, true)))
+        bad = "corrupt";
+    }
+    if (bad)
+    {
+      fprintf(stderr, "ride_stats: %s: block %u %s, skipped\n", log.path.c_str(), b, bad);
+      report.badBlocks++;
+      continue;
+    }
+
+    uint64_t t0 = (uint64_t)h.startTime * 1000;
+    for (uint32_t i = 0; i < h.samples; i++)
+    {
+      uint64_t ms = t0 + (uint64_t)i * h.intervalMs;
+      if (ms < from * 1000ull || ms >= (to + 1ull) * 1000)
+        continue;
+      report.add(ms, speed[i], dist[i], alt[i], h.intervalMs);
+      sink.write(ms, speed[i], dist[i], alt[i]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Output
+//------------------------------------------------------------------------------
+
+static std::string stamp(uint64_t ms)
+{
+  time_t t = ms / 1000;
+  char buf[32];
+  strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M", gmtime(&t));
+  return buf;
+}
+
+static std::string duration(uint64_t ms)
+{
+  char buf[32];
+  unsigned s = ms / 1000;
+  snprintf(buf, sizeof(buf), "%u:%02u:%02u", s / 3600, s / 60 % 60, s % 60);
+  return buf;
+}
+
+static void printReport(const Report &r)
+{
+  printf("%zu trips, %llu samples\n\n", r.trips.size(), (unsigned long long)r.samples);
+
+  printf("%-16s %9s %9s %9s %9s %9s %7s\n", "trip start", "km", "moving", "idle", "avg km/h", "max km/h", "climb m");
+  uint64_t totalCm = 0, totalMoving = 0;
+  for (const Trip &t : r.trips)
+  {
+    double hours = t.movingMs / 3600000.0;
+    printf("%-16s %9.2f %9s %9s %9.1f %9.1f %7lld\n", stamp(t.startMs).c_str(), t.distanceCm / 100000.0,
+           duration(t.movingMs).c_str(), duration(t.idleMs).c_str(),
+           hours > 0 ? t.distanceCm / 100000.0 / hours : 0.0, t.maxSpeed / 100.0, (long long)(t.ascentDm / 10));
+    totalCm += t.distanceCm;
+    totalMoving += t.movingMs;
+  }
+  printf("%-16s %9.2f %9s\n\n", "total", totalCm / 100000.0, duration(totalMoving).c_str());
+
+  uint64_t peak = 1;
+  int last = 0;
+  for (int i = 0; i < HIST_BINS; i++)
+  {
+    peak = std::max(peak, r.histogram[i]);
+    if (r.histogram[i])
+      last = i;
+  }
+  printf("speed histogram (samples per km/h)\n");
+  for (int i = 0; i <= last; i++)
+    printf("%3d %10llu %s\n", i, (unsigned long long)r.histogram[i],
+           std::string(r.histogram[i] * 50 / peak, '#').c_str());
+
+  printf("\nclimbs over %d m\n", CLIMB_MIN_DM / 10);
+  for (const Segment &c : r.climbs)
+    printf("  %s  +%d.%d m in %s\n", stamp(c.startMs).c_str(), c.value / 10, c.value % 10,
+           duration(c.endMs - c.startMs).c_str());
+
+  printf("\nidle segments over %u s\n", IDLE_MIN_MS / 1000);
+  for (const Segment &s : r.idles)
+    printf("  %s  %s\n", stamp(s.startMs).c_str(), duration(s.endMs - s.startMs).c_str());
+}
+
+//------------------------------------------------------------------------------
+// Synthetic logs for trying the tool without a device
+//------------------------------------------------------------------------------
+
+static int generate(const char *path, int days)
+{
+  FILE *out = fopen(path, "wb");
+  if (!out)
+  {
+    fprintf(stderr, "ride_stats: cannot create %s: %s\n", path, strerror(errno));
+    return 1;
+  }
+
+  std::vector<uint8_t> index;
+  uint8_t block[RIDE_BLOCK_HEADER_SIZE + RIDE_BLOCK_MAX_PAYLOAD];
+  RideSample s[RIDE_BLOCK_MAX_SAMPLES];
+  uint32_t offset = 0, blocks = 0;
+  uint32_t seed = 1;
+  auto rnd = [&seed](int range) { seed = seed * 1103515245 + 12345; return (int)((seed >> 16) % range); };
+
+  const uint32_t day0 = 1735689600; // 2025-01-01
+  for (int d = 0; d < days; d++)
+  {
+    // Two commutes a day, 1 Hz samples
+    for (int trip = 0; trip < 2; trip++)
+    {
+      uint32_t t = day0 + d * 86400 + (trip ? 17 : 8) * 3600 + rnd(1800);
+      int32_t speed = 0, alt = 1200 + rnd(200);
+      int len = 1800 + rnd(1800);
+      for (int i = 0; i < len; i += RIDE_BLOCK_MAX_SAMPLES)
+      {
+        uint16_t n = std::min(len - i, RIDE_BLOCK_MAX_SAMPLES);
+        for (uint16_t k = 0; k < n; k++)
+        {
+          bool stopped = (i + k) % 600 > 560; // traffic lights
+          speed = stopped ? 0 : std::max(0, std::min(4500, speed + rnd(201) - 90));
+          alt += rnd(5) - 2 + (((i + k) / 300) % 2 ? 1 : -1) * (rnd(4) == 0);
+          s[k].speed = speed;
+          s[k].distance = speed * 1000 / 3600; // 0.01 km/h over 1 s in cm
+          s[k].altitude = alt;
+        }
+        size_t len = rideEncodeBlock(block, t + i, 1000, s, n);
+        fwrite(block, 1, len, out);
+
+        uint8_t entry[RIDE_INDEX_ENTRY_SIZE];
+        ridePut32(entry, t + i);
+        ridePut32(entry + 4, offset);
+        index.insert(index.end(), entry, entry + sizeof(entry));
+        offset += len;
+        blocks++;
+      }
+    }
+  }
+
+  fwrite(index.data(), 1, index.size(), out);
+  uint8_t footer[RIDE_FOOTER_SIZE];
+  ridePut32(footer, RIDE_INDEX_MAGIC);
+  ridePut32(footer + 4, blocks);
+  ridePut32(footer + 8, offset);
+  fwrite(footer, 1, sizeof(footer), out);
+  fclose(out);
+  printf("wrote %u blocks, %u bytes to %s\n", blocks, offset + (uint32_t)index.size() + RIDE_FOOTER_SIZE, path);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+
+static bool parseDate(const char *s, uint32_t &t, bool endOfDay)
+{
+  struct tm tm = {};
+  if (sscanf(s, "%d-%d-%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday) != 3)
+    return false;
+  tm.tm_year -= 1900;
+  tm.tm_mon -= 1;
+  t = timegm(&tm) + (endOfDay ? 86399 : 0);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t from = 0, to = UINT32_MAX;
+  const char *csvPath = nullptr;
+  const char *colPrefix = nullptr;
+  bool scalar = false;
+  std::vector<const char *> paths;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--generate") && i + 1 < argc)
+    {
+      const char *out = argv[++i];
+      int days = 90;
+      if (i + 2 < argc && !strcmp(argv[i + 1], "--days"))
+        days = atoi(argv[i + 2]);
+      return generate(out, days);
+    }
+    else if (!strcmp(argv[i], "--from") && i + 1 < argc)
+    {
+      if (!parseDate(argv[++i], from, false))
+        return fprintf(stderr, "ride_stats: bad date %s\n", argv[i]), 2;
+    }
+    else if (!strcmp(argv[i], "--to") && i + 1 < argc)
+    {
+      if (!parseDate(argv[++i], to, true))
+        return fprintf(stderr, "ride_stats: bad date %s\n", argv[i]), 2;
+    }
+    else if (!strcmp(argv[i], "--csv") && i + 1 < argc)
+      csvPath = argv[++i];
+    else if (!strcmp(argv[i], "--columns") && i + 1 < argc)
+      colPrefix = argv[++i];
+    else if (!strcmp(argv[i], "--scalar"))
+      scalar = true;
+    else
+      paths.push_back(argv[i]);
+  }
+
+  if (paths.empty())
+  {
+    fprintf(stderr, "usage: ride_stats [--from YYYY-MM-DD] [--to YYYY-MM-DD] [--csv file|-] "
+                    "[--columns prefix] [--scalar] log...\n"
+                    "       ride_stats --generate out.rlog [--days N]\n");
+    return 2;
+  }
+
+  const char *decoderName;
+  ColumnDecoder decode = pickDecoder(scalar, &decoderName);
+
+  Sink sink;
+  if (csvPath)
+  {
+    sink.csv = strcmp(csvPath, "-") ? fopen(csvPath, "w") : stdout;
+    if (!sink.csv)
+      return fprintf(stderr, "ride_stats: cannot create %s\n", csvPath), 1;
+    fprintf(sink.csv, "time,speed_kmh,distance_cm,altitude_m\n");
+  }
+  if (colPrefix)
+  {
+    static const char *names[4] = {"time.u32", "speed.i32", "distance.i32", "altitude.i32"};
+    for (int c = 0; c < 4; c++)
+    {
+      std::string name = std::string(colPrefix) + "." + names[c];
+      if (!(sink.cols[c] = fopen(name.c_str(), "wb")))
+        return fprintf(stderr, "ride_stats: cannot create %s\n", name.c_str()), 1;
+    }
+  }
+
+  // Logs are analysed in time order, whatever order they were given in
+  std::vector<LogFile> logs(paths.size());
+  for (size_t i = 0; i < paths.size(); i++)
+    if (!logs[i].open(paths[i]))
+      return 1;
+  std::vector<const LogFile *> order;
+  for (const LogFile &l : logs)
+    if (l.blocks)
+      order.push_back(&l);
+  std::sort(order.begin(), order.end(),
+            [](const LogFile *a, const LogFile *b) { return a->blockTime(0) < b->blockTime(0); });
+
+  auto started = std::chrono::steady_clock::now();
+  Report report;
+  for (const LogFile *l : order)
+    scanFile(*l, from, to, decode, report, sink);
+  report.closeTrip();
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+
+  if (sink.csv && sink.csv != stdout)
+    fclose(sink.csv);
+  for (FILE *f : sink.cols)
+    if (f)
+      fclose(f);
+
+  // Keep stdout clean when it carries the CSV
+  if (!(sink.csv == stdout))
+    printReport(report);
+  fprintf(stderr, "scanned %llu samples in %.1f ms (%s decoder)\n",
+          (unsigned long long)report.samples, ms, decoderName);
+  if (report.badBlocks)
+    fprintf(stderr, "ride_stats: %u bad blocks skipped\n", report.badBlocks);
+  return report.badBlocks ? 1 : 0;
+}
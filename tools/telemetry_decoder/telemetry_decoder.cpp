@@ -0,0 +1,223 @@
+// Decoder for the bench telemetry stream (include/telemetry_frame.h).
+//
+//   g++ -O2 -std=c++17 -I../../include telemetry_decoder.cpp ../../src/log_protocol.cpp -o telemetry_decoder
+//
+//   ./telemetry_decoder /dev/ttyUSB1 [--baud 460800] [--csv] [--stats]
+//   ./telemetry_decoder capture.bin --csv > run.csv
+//
+// Default output is one line per frame. --csv prints a header and comma
+// separated values for plotting, e.g.
+//
+//   gnuplot -e "set datafile separator ','; plot 'run.csv' using 1:3 with lines"
+//
+// --stats prints one summary line per second instead: frame rate, frames lost
+// in transit (sequence gaps), frames dropped on the device, CRC errors, the
+// frame interval jitter, stack and heap figures and wheel pulse to pixel
+// latency percentiles. The
+// device repeats its newest latency sample in every frame, so a sample is
+// counted when its sequence number changes. Samples taken between two frames
+// are reported as missed.
+
+#include "log_protocol.h"
+#include "telemetry_frame.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+struct Frame
+{
+  uint8_t seq;
+  uint32_t timeUs, pulseMs, distanceCm, loopUs, latencyUs;
+  uint16_t speed, idle, dropped, latencySeq;
+  uint16_t stackUsed, heapUsed, heapPeak, largestFree, fragmentation;
+};
+
+static bool parseFrame(const uint8_t *f, Frame &out)
+{
+  if (f[0] != (TELEMETRY_SYNC & 0xFF) || f[1] != (TELEMETRY_SYNC >> 8) || f[2] != TELEMETRY_VERSION)
+    return false;
+  if ((logCrc32(f, 42) & 0xFFFF) != (uint32_t)(f[42] | f[43] << 8))
+    return false;
+  out.seq = f[3];
+  out.timeUs = logGet32(f + 4);
+  out.pulseMs = logGet32(f + 8);
+  out.distanceCm = logGet32(f + 12);
+  out.speed = f[16] | f[17] << 8;
+  out.idle = f[18] | f[19] << 8;
+  out.loopUs = logGet32(f + 20);
+  out.latencyUs = logGet32(f + 24);
+  out.dropped = f[28] | f[29] << 8;
+  out.latencySeq = f[30] | f[31] << 8;
+  out.stackUsed = f[32] | f[33] << 8;
+  out.heapUsed = f[34] | f[35] << 8;
+  out.heapPeak = f[36] | f[37] << 8;
+  out.largestFree = f[38] | f[39] << 8;
+  out.fragmentation = f[40] | f[41] << 8;
+  return true;
+}
+
+static double percentileMs(std::vector<uint32_t> &v, int pct)
+{
+  if (v.empty())
+    return 0;
+  std::sort(v.begin(), v.end());
+  return v[v.size() * pct / 100] / 1000.0;
+}
+
+static int openInput(const char *path, long baud)
+{
+  if (!strcmp(path, "-"))
+    return 0;
+  int fd = open(path, O_RDONLY | O_NOCTTY);
+  if (fd < 0)
+  {
+    fprintf(stderr, "telemetry_decoder: cannot open %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+  termios tio;
+  if (tcgetattr(fd, &tio) == 0)
+  {
+    cfmakeraw(&tio);
+    speed_t speed = baud == 921600 ? B921600 : baud == 230400 ? B230400 : baud == 115200 ? B115200 : B460800;
+    cfsetispeed(&tio, speed);
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  return fd;
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = nullptr;
+  long baud = 460800;
+  bool csv = false, stats = false;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--baud") && i + 1 < argc)
+      baud = atol(argv[++i]);
+    else if (!strcmp(argv[i], "--csv"))
+      csv = true;
+    else if (!strcmp(argv[i], "--stats"))
+      stats = true;
+    else
+      path = argv[i];
+  }
+  if (!path)
+  {
+    fprintf(stderr, "usage: telemetry_decoder <port|file|-> [--baud N] [--csv] [--stats]\n");
+    return 2;
+  }
+
+  int fd = openInput(path, baud);
+  if (fd < 0)
+    return 1;
+
+  if (csv && !stats)
+    printf("time_s,seq,speed_kmh,pulse_ms,distance_m,loop_ms,idle_pct,latency_ms,dropped,"
+           "stack_b,heap_b,heap_peak_b,largest_free_b,frag_pct\n");
+
+  uint8_t buf[4096];
+  size_t have = 0;
+  bool first = true;
+  Frame last = {};
+  unsigned long frames = 0, lost = 0, crcErrors = 0, latencyMissed = 0;
+  uint32_t windowStart = 0, minGap = UINT32_MAX, maxGap = 0;
+  uint16_t droppedAtStart = 0;
+  std::vector<uint32_t> latency;
+
+  for (;;)
+  {
+    ssize_t got = read(fd, buf + have, sizeof(buf) - have);
+    if (got <= 0)
+      break;
+    have += got;
+
+    size_t pos = 0;
+    while (have - pos >= TELEMETRY_FRAME_SIZE)
+    {
+      Frame f;
+      if (!parseFrame(buf + pos, f))
+      {
+        // Count a bad frame only where a sync word was seen
+        if (buf[pos] == (TELEMETRY_SYNC & 0xFF) && buf[pos + 1] == (TELEMETRY_SYNC >> 8))
+          crcErrors++;
+        pos++;
+        continue;
+      }
+      pos += TELEMETRY_FRAME_SIZE;
+      frames++;
+
+      if (first)
+      {
+        windowStart = f.timeUs;
+        droppedAtStart = f.dropped;
+      }
+      else
+      {
+        if (f.latencySeq != last.latencySeq)
+        {
+          latency.push_back(f.latencyUs);
+          latencyMissed += (uint16_t)(f.latencySeq - last.latencySeq - 1);
+        }
+        lost += (uint8_t)(f.seq - last.seq - 1);
+        uint32_t gap = f.timeUs - last.timeUs;
+        if (gap < minGap)
+          minGap = gap;
+        if (gap > maxGap)
+          maxGap = gap;
+      }
+
+      if (!stats)
+      {
+        if (csv)
+          printf("%.6f,%u,%.2f,%u,%.2f,%.3f,%.2f,%.3f,%u,%u,%u,%u,%u,%.2f\n", f.timeUs / 1e6, f.seq, f.speed / 100.0,
+                 f.pulseMs, f.distanceCm / 100.0, f.loopUs / 1000.0, f.idle / 100.0, f.latencyUs / 1000.0, f.dropped,
+                 f.stackUsed, f.heapUsed, f.heapPeak, f.largestFree, f.fragmentation / 100.0);
+        else
+          printf("%10.3f s  #%3u  %6.2f km/h  pulse %5u ms  trip %9.2f m  loop %7.3f ms  idle %6.2f %%  "
+                 "latency %7.1f ms\n",
+                 f.timeUs / 1e6, f.seq, f.speed / 100.0, f.pulseMs, f.distanceCm / 100.0, f.loopUs / 1000.0,
+                 f.idle / 100.0, f.latencyUs / 1000.0);
+      }
+      else if (f.timeUs - windowStart >= 1000000)
+      {
+        printf("%4lu frames/s  lost %lu  device dropped %u  crc errors %lu  interval %.2f..%.2f ms  "
+               "loop %.1f ms  idle %.1f %%\n",
+               frames, lost, (uint16_t)(f.dropped - droppedAtStart), crcErrors, minGap / 1000.0, maxGap / 1000.0,
+               f.loopUs / 1000.0, f.idle / 100.0);
+        printf("     memory stack %u  heap %u peak %u  largest free %u  fragmentation %.2f %%\n", f.stackUsed,
+               f.heapUsed, f.heapPeak, f.largestFree, f.fragmentation / 100.0);
+        if (!latency.empty())
+        {
+          size_t n = latency.size();
+          double p50 = percentileMs(latency, 50), p90 = percentileMs(latency, 90), p99 = percentileMs(latency, 99);
+          printf("     latency %zu samples  missed %lu  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f ms\n", n,
+                 latencyMissed, p50, p90, p99, latency.back() / 1000.0);
+          latency.clear();
+        }
+        latencyMissed = 0;
+        frames = lost = crcErrors = 0;
+        minGap = UINT32_MAX;
+        maxGap = 0;
+        windowStart = f.timeUs;
+        droppedAtStart = f.dropped;
+      }
+
+      fflush(stdout);
+      last = f;
+      first = false;
+    }
+
+    memmove(buf, buf + pos, have - pos);
+    have -= pos;
+  }
+  return 0;
+}
@@ -0,0 +1,123 @@
+// Times the UTF-8 decoding of the TFT_eSPI text functions on the strings the
+// dashboard draws, on the host.
+//
+// drawString(), textWidth(), print() and the Sprite text functions used to
+// decode every byte. They now look for the first byte that needs decoding with
+// tftAsciiLength(), four bytes at a time, take the bytes before it as they are
+// and only decode from there (lib/TFT_eSPI/Fonts/Utf8.h). Both loops are timed
+// here over the same strings and must give the same characters.
+//
+//   g++ -O2 -std=c++17 -I../../lib/TFT_eSPI text_bench.cpp -o text_bench
+//
+//   ./text_bench [rounds [off]]
+//
+// The host is much faster than the Cortex-M3 and predicts branches better, so
+// the ratio is the figure to look at. On the panel the glyphs cost far more
+// than the decoding, this is the text pipeline overhead alone.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "Fonts/Utf8.h"
+
+// What the firmware draws, plus two strings that are not pure ASCII
+static const char *const strings[] = {
+  "Avg speed ", "23.4", " km/h", "Trip start ", "Drive time ", "Idle time ",
+  "01:23:45", "0123,", "456", "21.5", " C", "12:34", "42", "7",
+  "caf\xC3\xA9", "21.5\xC2\xB0" "C",
+};
+static const int count = sizeof(strings) / sizeof(strings[0]);
+
+static bool utf8 = true; // TFT_eSPI _utf8, set at run time
+
+// As TFT_eSPI::decodeUTF8(), a member function called once per character
+__attribute__((noinline)) static uint16_t decodeUTF8(const uint8_t *buf, uint16_t *index, uint16_t remaining)
+{
+  if (!utf8) return buf[(*index)++];
+  return tftDecodeUTF8(buf, index, remaining);
+}
+
+// As TFT_eSPI::asciiLength()
+__attribute__((noinline)) static uint16_t asciiLength(const char *string, uint16_t len)
+{
+  if (!utf8) return len;
+  return tftAsciiLength((const uint8_t *)string, len);
+}
+
+// Every byte through the decoder, as before. The characters are added up in place of
+// drawing them
+static uint32_t decodeAll(const char *string, uint16_t len)
+{
+  uint32_t sum = 0;
+  uint16_t n = 0;
+  while (n < len) sum += decodeUTF8((const uint8_t *)string, &n, len - n);
+  return sum;
+}
+
+// The ASCII start as it is, the rest through the decoder
+static uint32_t decodeRest(const char *string, uint16_t len)
+{
+  uint32_t sum = 0;
+  uint16_t n = 0;
+  uint16_t ascii = asciiLength(string, len);
+  while (n < ascii) sum += (uint8_t)string[n++];
+  while (n < len) sum += decodeUTF8((const uint8_t *)string, &n, len - n);
+  return sum;
+}
+
+template <typename F>
+static double nsPerString(F decode, long rounds, uint32_t &check)
+{
+  uint16_t len[count];
+  for (int i = 0; i < count; i++) len[i] = strlen(strings[i]);
+
+  auto start = std::chrono::steady_clock::now();
+  uint32_t sum = 0;
+  for (long r = 0; r < rounds; r++) {
+    for (int i = 0; i < count; i++) sum += decode(strings[i], len[i]);
+    asm volatile("" : : "r"(sum) : "memory"); // Keep the loop from being folded
+  }
+  auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  check = sum;
+  return ns / ((double)rounds * count);
+}
+
+int main(int argc, char **argv)
+{
+  long rounds = argc > 1 ? atol(argv[1]) : 2000000;
+  utf8 = argc < 3; // A second argument times the decoding switched off, as with UTF8_SWITCH
+  if (rounds < 1) {
+    fprintf(stderr, "usage: text_bench [rounds [off]]\n");
+    return 2;
+  }
+
+  for (int i = 0; i < count; i++) {
+    uint16_t len = strlen(strings[i]);
+    if (decodeAll(strings[i], len) != decodeRest(strings[i], len)) {
+      fprintf(stderr, "text_bench: \"%s\" decodes differently\n", strings[i]);
+      return 1;
+    }
+  }
+
+  // Best of five, the host has other work to do
+  uint32_t a, b;
+  double all = 1e9, rest = 1e9;
+  for (int run = 0; run < 5; run++) {
+    all  = std::min(all, nsPerString(decodeAll, rounds, a));
+    rest = std::min(rest, nsPerString(decodeRest, rounds, b));
+  }
+  if (a != b) {
+    fprintf(stderr, "text_bench: the loops decoded different characters\n");
+    return 1;
+  }
+
+  printf("%d strings, %ld rounds\n", count, rounds);
+  printf("Decode every byte      %6.2f ns per string\n", all);
+  printf("ASCII start as it is   %6.2f ns per string  (%.2fx)\n", rest, all / rest);
+  return 0;
+}